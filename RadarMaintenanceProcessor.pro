@@ -7,12 +7,19 @@
 #
 #-------------------------------------------------
 
-QT += core gui qml quick quickcontrols2 charts network
+# Headless state server (qmake CONFIG+=headless): QCoreApplication only,
+# no Qt GUI/Quick/Charts
+headless {
+    QT = core network
+    DEFINES += RMP_HEADLESS
+} else {
+    QT += core gui qml quick quickcontrols2 charts network
+}
 
 greaterThan(QT_MAJOR_VERSION, 5): QT += core5compat
 
 CONFIG += c++17
-CONFIG += qmltypes
+!headless: CONFIG += qmltypes
 
 # Application info
 TARGET = RadarMaintenanceProcessor
@@ -51,6 +58,21 @@ HEADERS += \
     include/core/HealthDataPipeline.h \
     include/core/TelemetryData.h \
     include/core/FaultManager.h \
+    include/core/ActiveFaultSet.h \
+    include/core/RingBuffer.h \
+    include/core/Timestamp.h \
+    include/core/SignalCoalescer.h \
+    include/core/SelfTestRunner.h \
+    include/core/FleetStore.h \
+    include/core/HealthRuleEngine.h \
+    include/core/SharedStateLayout.h \
+    include/core/SharedStateExporter.h \
+    include/core/SubsystemIndex.h \
+    include/core/HealthRollup.h \
+    include/core/FaultDependencyGraph.h \
+    include/core/TelemetryListModel.h \
+    include/core/FaultListModel.h \
+    include/core/StateServer.h \
     # Subsystems
     include/subsystems/TransmitterSubsystem.h \
     include/subsystems/ReceiverSubsystem.h \
@@ -85,6 +107,18 @@ SOURCES += \
     src/core/HealthDataPipeline.cpp \
     src/core/TelemetryData.cpp \
     src/core/FaultManager.cpp \
+    src/core/ActiveFaultSet.cpp \
+    src/core/SignalCoalescer.cpp \
+    src/core/SelfTestRunner.cpp \
+    src/core/FleetStore.cpp \
+    src/core/HealthRuleEngine.cpp \
+    src/core/SharedStateExporter.cpp \
+    src/core/SubsystemIndex.cpp \
+    src/core/HealthRollup.cpp \
+    src/core/FaultDependencyGraph.cpp \
+    src/core/TelemetryListModel.cpp \
+    src/core/FaultListModel.cpp \
+    src/core/StateServer.cpp \
     # Subsystems
     src/subsystems/TransmitterSubsystem.cpp \
     src/subsystems/ReceiverSubsystem.cpp \
@@ -105,12 +139,20 @@ SOURCES += \
     src/analytics/TrendAnalyzer.cpp \
     src/analytics/UptimeTracker.cpp
 
+# Chart feeding needs Qt Charts
+!headless {
+    HEADERS += include/analytics/ChartFeeder.h
+    SOURCES += src/analytics/ChartFeeder.cpp
+}
+
 #-------------------------------------------------
 # Resources
 #-------------------------------------------------
 
-RESOURCES += \
-    qml.qrc
+!headless {
+    RESOURCES += \
+        qml.qrc
+}
 
 #-------------------------------------------------
 # QML Files (for IDE support)
@@ -177,6 +219,8 @@ macx {
 unix:!macx {
     # Linux-specific settings
     QMAKE_LFLAGS += -Wl,-rpath,\'\$$ORIGIN\'
+    # shm_open/shm_unlink for the shared-memory state export
+    LIBS += -lrt
 }
 
 #-------------------------------------------------
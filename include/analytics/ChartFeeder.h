@@ -0,0 +1,84 @@
+#ifndef CHARTFEEDER_H
+#define CHARTFEEDER_H
+
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QPointer>
+#include <QPointF>
+#include <QtCharts/QXYSeries>
+#include "core/TelemetryData.h"
+
+namespace RadarRMP {
+
+class SubsystemManager;
+class HealthAnalytics;
+class TrendAnalyzer;
+
+/**
+ * @brief Fills QML chart series straight from the analytics stores
+ *
+ * The feed*() calls take a LineSeries/ScatterSeries from QML and swap its
+ * contents with one QXYSeries::replace(), so a chart of thousands of
+ * points costs one redraw instead of a per-point JS append loop over
+ * QVariantMaps. x values are msecs since epoch (DateTimeAxis).
+ *
+ * attachTelemetry() keeps a series live: new samples of the parameter are
+ * buffered as they arrive and appended in one batch per frame (via
+ * SignalCoalescer), with the oldest points dropped beyond maxPoints.
+ *
+ * GUI thread only.
+ */
+class ChartFeeder : public QObject {
+    Q_OBJECT
+
+public:
+    ChartFeeder(SubsystemManager* manager, HealthAnalytics* analytics,
+                TrendAnalyzer* trendAnalyzer, QObject* parent = nullptr);
+    ~ChartFeeder() override = default;
+
+    // One-shot fills; return the number of points set, -1 if series is not an XY series
+    Q_INVOKABLE int feedHealthScoreTrend(QObject* series, int hours = 24);
+    Q_INVOKABLE int feedTemperatureTrend(QObject* series, int hours = 24);
+    Q_INVOKABLE int feedFaultRateTrend(QObject* series, int hours = 24);
+    Q_INVOKABLE int feedTrendData(QObject* series, const QString& subsystemId,
+                                  const QString& parameter, int maxPoints = 100);
+    Q_INVOKABLE int feedTrendLine(QObject* series, const QString& subsystemId,
+                                  const QString& parameter, int points = 100);
+    Q_INVOKABLE int feedTelemetryHistory(QObject* series, const QString& subsystemId,
+                                         const QString& parameter, int maxSamples = 0);
+
+    /**
+     * @brief Fill from the telemetry history, then append live samples
+     * @param maxPoints Points kept in the series; 0 = unbounded
+     */
+    Q_INVOKABLE bool attachTelemetry(QObject* series, const QString& subsystemId,
+                                     const QString& parameter, int maxPoints = 1000);
+    Q_INVOKABLE void detach(QObject* series);
+
+    int liveFeedCount() const { return m_feeds.size(); }
+
+private:
+    struct LiveFeed {
+        QPointer<QXYSeries> series;
+        int parameterIndex = -1;
+        int maxPoints = 0;
+        QList<QPointF> pending;
+        QMetaObject::Connection valuesConnection;
+        QMetaObject::Connection destroyedConnection;
+    };
+
+    static int replace(QObject* target, const QList<QPointF>& points);
+    void onValuesChanged(QObject* key, const TelemetryChangeSet& changes);
+    void flushFeeds();
+
+    SubsystemManager* m_manager;
+    HealthAnalytics* m_analytics;
+    TrendAnalyzer* m_trendAnalyzer;
+
+    QHash<QObject*, LiveFeed> m_feeds;     // Keyed by series
+};
+
+} // namespace RadarRMP
+
+#endif // CHARTFEEDER_H
@@ -5,6 +5,8 @@
 #include <QMap>
 #include <QDateTime>
 #include <QVariantList>
+#include <QList>
+#include <QPointF>
 #include <QTimer>
 #include "core/HealthStatus.h"
 
@@ -63,6 +65,11 @@ public:
     Q_INVOKABLE QVariantList getTemperatureTrend(int hours = 24) const;
     Q_INVOKABLE QVariantList getFaultRateTrend(int hours = 24) const;
     
+    // Same trends as chart points (x = msecs since epoch), for ChartFeeder
+    QList<QPointF> chartHealthScoreTrend(int hours = 24) const;
+    QList<QPointF> chartTemperatureTrend(int hours = 24) const;
+    QList<QPointF> chartFaultRateTrend(int hours = 24) const;
+    
     // Reports
     Q_INVOKABLE QVariantMap generateReport(const QDateTime& startTime, 
                                            const QDateTime& endTime) const;
@@ -85,6 +92,7 @@ private:
     void initializeTracking();
     void computeMetrics();
     void checkAlertConditions();
+    void notifyAnalyticsUpdated();
     
     SubsystemManager* m_manager;
     
@@ -4,11 +4,16 @@
 #include <QObject>
 #include <QMap>
 #include <QVariantList>
+#include <QList>
+#include <QPointF>
 #include <QDateTime>
 #include <deque>
+#include "core/TelemetryData.h"
 
 namespace RadarRMP {
 
+class RadarSubsystem;
+
 /**
  * @brief Trend analysis for telemetry parameters
  * 
@@ -54,8 +59,16 @@ public:
     
     // Data input
     void addDataPoint(const QString& subsystemId, const QString& parameter, 
-                     double value, const QDateTime& timestamp = QDateTime::currentDateTime());
+                     double value, Timestamp timestamp = Timestamp::now());
+    void addDataPoint(const QString& subsystemId, const QString& parameter, 
+                     double value, const QDateTime& timestamp);
     void addDataPoints(const QString& subsystemId, const QVariantMap& values);
+    void addChanges(const RadarSubsystem* subsystem, const TelemetryChangeSet& changes);
+    
+    /**
+     * @brief Feed the subsystem's telemetry change sets into addChanges()
+     */
+    void trackSubsystem(RadarSubsystem* subsystem);
     
     // Analysis
     TrendResult analyzeTrend(const QString& subsystemId, const QString& parameter) const;
@@ -84,6 +97,16 @@ public:
     QVariantList getTrendLine(const QString& subsystemId, const QString& parameter,
                              int points = 100) const;
     
+    // Same data as chart points (x = msecs since epoch), for ChartFeeder
+    QList<QPointF> chartDataPoints(const QString& subsystemId, const QString& parameter,
+                                   int maxPoints = 100) const;
+    QList<QPointF> chartTrendLine(const QString& subsystemId, const QString& parameter,
+                                  int points = 100) const;
+    
+    // Chart points as the {timestamp, value} maps QML trend lists use;
+    // shared with HealthAnalytics
+    static QVariantList toVariantList(const QList<QPointF>& points);
+    
     // Maintenance
     void clearData(const QString& subsystemId);
     void clearAllData();
@@ -100,9 +123,13 @@ signals:
 private:
     struct DataPoint {
         double value;
-        qint64 timestampMs;
+        qint64 timestampMs;         // Monotonic msecs (Timestamp scale)
     };
     
+    static qint64 toMonotonicMs(Timestamp timestamp);
+    static QDateTime toDateTime(qint64 monotonicMs);
+    static qint64 toEpochMs(qint64 monotonicMs);
+    
     // Linear regression
     void computeLinearRegression(const std::deque<DataPoint>& data,
                                 double& slope, double& intercept, double& rSquared) const;
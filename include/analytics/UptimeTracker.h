@@ -23,11 +23,11 @@ public:
      */
     struct UptimeRecord {
         QString subsystemId;
-        QDateTime startTime;
+        Timestamp startTime;
         qint64 totalUptimeMs;
         qint64 totalDowntimeMs;
         HealthState currentState;
-        QDateTime lastStateChange;
+        Timestamp lastStateChange;
         int stateTransitions;
         
         double getAvailability() const {
@@ -88,17 +88,17 @@ private:
     
     QMap<QString, UptimeRecord> m_records;
     QTimer* m_tickTimer;
-    QDateTime m_trackingStartTime;
+    Timestamp m_trackingStartTime;
     
     // Historical snapshots
     struct HistorySnapshot {
-        QDateTime timestamp;
+        Timestamp timestamp;
         double systemAvailability;
         QMap<QString, double> subsystemAvailability;
     };
     QList<HistorySnapshot> m_history;
     int m_snapshotIntervalMs;
-    qint64 m_lastSnapshotTime;
+    Timestamp m_lastSnapshotTime;
 };
 
 } // namespace RadarRMP
@@ -0,0 +1,88 @@
+#ifndef ACTIVEFAULTSET_H
+#define ACTIVEFAULTSET_H
+
+#include <QHash>
+#include <QList>
+#include <QVector>
+#include <QString>
+#include <QStringList>
+#include <QtAlgorithms>
+#include "HealthStatus.h"
+
+namespace RadarRMP {
+
+/**
+ * @brief Keyed set of active faults for a single subsystem
+ *
+ * Fault codes that the subsystem declares up front (registerCode) are
+ * assigned a bit in a 64-bit mask and a fixed slot, so membership tests,
+ * inserts and removals are a hash lookup plus a bit operation. Codes
+ * that were never registered (e.g. injected faults) go to an overflow
+ * hash keyed by code.
+ *
+ * Not thread-safe; the owning RadarSubsystem guards it with its mutex.
+ */
+class ActiveFaultSet {
+public:
+    static constexpr int MAX_INDEXED_CODES = 64;
+
+    ActiveFaultSet() = default;
+
+    /**
+     * @brief Reserve a bit for a known fault code
+     * @return Bit index, or -1 if all indexed slots are taken
+     */
+    int registerCode(const QString& code);
+    int indexOf(const QString& code) const;
+
+    // Registered codes in bit order, and the bits currently active
+    QStringList registeredCodes() const;
+    quint64 activeMask() const { return m_activeBits; }
+
+    bool contains(const QString& code) const;
+
+    /**
+     * @brief Insert a fault keyed by its code
+     * @return False if a fault with the same code is already active
+     */
+    bool insert(const FaultCode& fault);
+
+    /**
+     * @brief Remove a fault by code
+     * @param taken Receives the removed fault if non-null
+     * @return False if the code was not active
+     */
+    bool take(const QString& code, FaultCode* taken = nullptr);
+
+    int size() const;
+    bool isEmpty() const;
+    void clear();
+
+    QList<FaultCode> values() const;
+
+    /**
+     * @brief Visit every active fault without building a list
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        quint64 bits = m_activeBits;
+        while (bits != 0) {
+            fn(m_slots.at(qCountTrailingZeroBits(bits)));
+            bits &= bits - 1;
+        }
+        for (const FaultCode& fault : m_overflow) {
+            fn(fault);
+        }
+    }
+
+private:
+    QHash<QString, int> m_codeIndex;        // Registered code -> bit index
+    QVector<FaultCode> m_slots;             // One slot per registered code
+    quint64 m_activeBits = 0;
+    QHash<QString, FaultCode> m_overflow;   // Unregistered codes
+};
+
+} // namespace RadarRMP
+
+#endif // ACTIVEFAULTSET_H
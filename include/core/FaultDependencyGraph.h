@@ -0,0 +1,70 @@
+#ifndef FAULTDEPENDENCYGRAPH_H
+#define FAULTDEPENDENCYGRAPH_H
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVariantMap>
+
+namespace RadarRMP {
+
+/**
+ * @brief Directed acyclic "depends on" graph between subsystems
+ *
+ * An edge upstream -> downstream means the downstream subsystem cannot
+ * work without the upstream one (PSU-001 -> TX-001). FaultManager uses it
+ * to classify faults on downstream subsystems as consequences of an
+ * active upstream root fault. Edges that would close a cycle are
+ * rejected.
+ *
+ * Not thread-safe; owned by FaultManager on the GUI thread.
+ */
+class FaultDependencyGraph {
+public:
+    /**
+     * @brief Declare that downstream depends on upstream
+     * @return False for self-edges, duplicates and edges creating a cycle
+     */
+    bool addDependency(const QString& downstream, const QString& upstream);
+    bool removeDependency(const QString& downstream, const QString& upstream);
+    void removeSubsystem(const QString& subsystemId);
+    void clear();
+
+    /**
+     * @brief Replace the graph from {downstreamId: [upstreamIds...]}
+     * @return Number of edges accepted
+     */
+    int load(const QVariantMap& upstreamByDownstream);
+    QVariantMap toVariantMap() const;
+
+    bool isEmpty() const { return m_upstream.isEmpty(); }
+    QStringList directUpstream(const QString& subsystemId) const { return m_upstream.value(subsystemId); }
+    QStringList directDownstream(const QString& subsystemId) const { return m_downstream.value(subsystemId); }
+
+    /**
+     * @brief All transitive upstream subsystems, nearest first
+     */
+    QStringList upstreamOf(const QString& subsystemId) const;
+
+    /**
+     * @brief All transitive downstream subsystems in topological order
+     *
+     * Every subsystem is listed after all of its upstreams that are
+     * themselves downstream of subsystemId.
+     */
+    QStringList downstreamOf(const QString& subsystemId) const;
+
+    bool dependsOn(const QString& downstream, const QString& upstream) const;
+
+private:
+    void visitDownstream(const QString& subsystemId, QSet<QString>& visited,
+                         QStringList& postOrder) const;
+
+    QHash<QString, QStringList> m_upstream;     // downstream -> direct upstreams
+    QHash<QString, QStringList> m_downstream;   // upstream -> direct downstreams
+};
+
+} // namespace RadarRMP
+
+#endif // FAULTDEPENDENCYGRAPH_H
@@ -0,0 +1,125 @@
+#ifndef FAULTLISTMODEL_H
+#define FAULTLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QPointer>
+#include <QSet>
+#include <QVector>
+#include "HealthStatus.h"
+
+namespace RadarRMP {
+
+class FaultManager;
+
+/**
+ * @brief Incremental list model over FaultManager's active faults or history
+ *
+ * FaultManager pushes each change into its models as it happens, so a
+ * registered fault is one row insert and a cleared fault one row removal;
+ * existing delegates are never re-created. Consequential faults are not
+ * listed (see FaultManager); an active row's suppressedCount role is
+ * refreshed once per frame when the faults it explains change.
+ *
+ * Filtering by subsystem and minimum severity and, for active faults,
+ * sorting happen here rather than in QML; changing either rebuilds the
+ * rows. History rows are newest first and loaded a page at a time via
+ * canFetchMore()/fetchMore(), which ListView calls as it scrolls.
+ *
+ * Created and owned by FaultManager. GUI thread only.
+ */
+class FaultListModel : public QAbstractListModel {
+    Q_OBJECT
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+    Q_PROPERTY(QString subsystemFilter READ getSubsystemFilter WRITE setSubsystemFilter NOTIFY filterChanged)
+    Q_PROPERTY(QString minimumSeverity READ getMinimumSeverity WRITE setMinimumSeverity NOTIFY filterChanged)
+    Q_PROPERTY(SortOrder sortOrder READ getSortOrder WRITE setSortOrder NOTIFY sortOrderChanged)
+
+public:
+    enum Source {
+        ActiveFaults,
+        FaultHistory
+    };
+    Q_ENUM(Source)
+
+    enum SortOrder {
+        NewestFirst,
+        SeverityFirst       // Most severe first, newest first within a severity
+    };
+    Q_ENUM(SortOrder)
+
+    enum Roles {
+        CodeRole = Qt::UserRole + 1,
+        DescriptionRole,
+        SeverityRole,
+        SeverityLevelRole,
+        TimestampRole,
+        SubsystemIdRole,
+        ActiveRole,
+        SuppressedCountRole
+    };
+
+    static constexpr int HISTORY_PAGE_SIZE = 50;
+
+    FaultListModel(FaultManager* manager, Source source, QObject* parent = nullptr);
+    ~FaultListModel() override;
+
+    // QAbstractListModel interface
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+    Source getSource() const { return m_source; }
+
+    // Filtering and sorting
+    QString getSubsystemFilter() const { return m_subsystemFilter; }
+    void setSubsystemFilter(const QString& subsystemId);
+    QString getMinimumSeverity() const;
+    void setMinimumSeverity(const QString& severity);
+    SortOrder getSortOrder() const { return m_sortOrder; }
+    void setSortOrder(SortOrder order);
+
+    /**
+     * @brief Rebuild the rows from FaultManager
+     */
+    Q_INVOKABLE void reload();
+
+    // Change feed from FaultManager
+    void faultAdded(const FaultCode& fault);
+    void faultRemoved(const QString& subsystemId, const QString& faultCode);
+    void historyAppended(qint64 sequence);
+    void historyTrimmed(qint64 firstSequence);
+    void suppressionChanged(const QSet<QString>& rootSubsystemIds);
+
+signals:
+    void countChanged();
+    void filterChanged();
+    void sortOrderChanged();
+
+private:
+    struct Row {
+        FaultCode fault;
+        qint64 sequence = -1;   // History position; -1 for active rows
+    };
+
+    bool accepts(const FaultCode& fault) const;
+    bool before(const FaultCode& a, const FaultCode& b) const;
+    void insertAt(int row, const Row& entry);
+    QVector<Row> takeHistoryPage();
+
+    QPointer<FaultManager> m_manager;
+    Source m_source;
+    QVector<Row> m_rows;
+
+    QString m_subsystemFilter;
+    int m_minimumSeverity;          // -1 = all
+    SortOrder m_sortOrder;
+
+    // History: every entry at or after this sequence has been considered
+    qint64 m_nextOlder;
+};
+
+} // namespace RadarRMP
+
+#endif // FAULTLISTMODEL_H
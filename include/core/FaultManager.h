@@ -6,7 +6,11 @@
 #include <QList>
 #include <QDateTime>
 #include <QTimer>
+#include <QHash>
+#include <QSet>
 #include "HealthStatus.h"
+#include "FaultDependencyGraph.h"
+#include "FaultListModel.h"
 
 namespace RadarRMP {
 
@@ -15,13 +19,25 @@ namespace RadarRMP {
  * 
  * Manages fault tracking, history, and statistics across all subsystems.
  * Provides centralized fault logging, correlation, and reporting.
+ *
+ * With a dependency graph declared, a fault on a subsystem whose upstream
+ * already has an active root fault is recorded as consequential
+ * (FaultCode::causedBy). Consequential faults stay queryable but do not
+ * enter the history, are left out of the UI counts and lists, and emit
+ * nothing, so a cascading failure surfaces as its root faults only. They
+ * are promoted to root faults if the upstream cause clears first.
+ *
+ * QML lists bind FaultListModels rather than QVariantList snapshots:
+ * every change is pushed into the attached models as a row insert or
+ * removal at the point it happens.
  */
 class FaultManager : public QObject {
     Q_OBJECT
     Q_PROPERTY(int totalActiveFaults READ getTotalActiveFaults NOTIFY faultsChanged)
     Q_PROPERTY(int criticalFaultCount READ getCriticalFaultCount NOTIFY faultsChanged)
-    Q_PROPERTY(QVariantList activeFaults READ getActiveFaultsVariant NOTIFY faultsChanged)
-    Q_PROPERTY(QVariantList recentFaults READ getRecentFaultsVariant NOTIFY faultsChanged)
+    Q_PROPERTY(FaultListModel* activeFaultModel READ getActiveFaultModel CONSTANT)
+    Q_PROPERTY(FaultListModel* faultHistoryModel READ getFaultHistoryModel CONSTANT)
+    Q_PROPERTY(int suppressedFaultCount READ getSuppressedFaultCount NOTIFY faultsChanged)
     
 public:
     explicit FaultManager(QObject* parent = nullptr);
@@ -42,15 +58,51 @@ public:
     bool hasFault(const QString& faultCode) const;
     FaultCode getFault(const QString& faultCode) const;
     
-    // Statistics
+    // Dependency graph; edits reclassify the active faults
+    Q_INVOKABLE bool addDependency(const QString& downstreamId, const QString& upstreamId);
+    Q_INVOKABLE bool removeDependency(const QString& downstreamId, const QString& upstreamId);
+    Q_INVOKABLE int loadDependencies(const QVariantMap& upstreamByDownstream);
+    Q_INVOKABLE QVariantMap getDependencies() const;
+    Q_INVOKABLE QStringList getUpstream(const QString& subsystemId) const;
+    Q_INVOKABLE QStringList getDownstream(const QString& subsystemId) const;
+    const FaultDependencyGraph& getDependencyGraph() const { return m_dependencies; }
+    
+    // Root-cause queries
+    bool isConsequential(const QString& subsystemId, const QString& faultCode) const;
+    int getSuppressedFaultCount() const { return m_suppressedCount; }
+    Q_INVOKABLE QVariantList getConsequentialFaultsVariant(const QString& rootSubsystemId) const;
+    
+    // Statistics (root faults only)
     int getTotalActiveFaults() const;
     int getCriticalFaultCount() const;
     int getFaultCount(FaultSeverity severity) const;
     int getFaultCount(const QString& subsystemId) const;
     
-    // QML helpers
-    QVariantList getActiveFaultsVariant() const;
-    QVariantList getRecentFaultsVariant(int maxCount = 10) const;
+    // Incremental models for QML
+    FaultListModel* getActiveFaultModel() const { return m_activeModel; }
+    FaultListModel* getFaultHistoryModel() const { return m_historyModel; }
+    
+    /**
+     * @brief Active faults of one subsystem, created on first use
+     */
+    Q_INVOKABLE FaultListModel* getSubsystemFaultModel(const QString& subsystemId);
+    void releaseSubsystemFaultModel(const QString& subsystemId);
+    
+    // Model feed (FaultListModel only)
+    void attachModel(FaultListModel* model);
+    void detachModel(FaultListModel* model);
+    qint64 historyBegin() const { return m_historyBase; }
+    qint64 historyEnd() const { return m_historyBase + m_faultHistory.size(); }
+    const FaultCode& historyAt(qint64 sequence) const {
+        return m_faultHistory.at(static_cast<int>(sequence - m_historyBase));
+    }
+    int getConsequentialCount(const QString& rootSubsystemId) const {
+        return m_consequentialCounts.value(rootSubsystemId, 0);
+    }
+    
+    // One-off snapshots
+    Q_INVOKABLE QVariantList getActiveFaultsVariant() const;
+    Q_INVOKABLE QVariantList getRecentFaultsVariant(int maxCount = 10) const;
     QVariantMap getFaultStatistics() const;
     
     // MTBF estimation
@@ -70,12 +122,44 @@ signals:
 private:
     QMap<QString, FaultCode> m_activeFaults;  // Key: "subsystemId:faultCode"
     QList<FaultCode> m_faultHistory;
-    QMap<QString, QDateTime> m_subsystemLastFault;
+    qint64 m_historyBase;                   // Sequence number of m_faultHistory.first()
+    QMap<QString, Timestamp> m_subsystemLastFault;
     QMap<QString, int> m_subsystemFaultCounts;
     
     static constexpr int MAX_HISTORY_SIZE = 10000;
     
+    // Root-fault bookkeeping
+    QHash<QString, int> m_rootFaultCounts;          // subsystemId -> active root faults
+    QHash<QString, int> m_consequentialCounts;      // root subsystemId -> faults it explains
+    int m_suppressedCount;
+    FaultDependencyGraph m_dependencies;
+    
+    // Models fed incrementally; all are children of this manager
+    FaultListModel* m_activeModel;
+    FaultListModel* m_historyModel;
+    QHash<QString, FaultListModel*> m_subsystemModels;
+    QList<FaultListModel*> m_models;
+    
+    // Published once per frame by publishChanges()
+    bool m_faultsDirty;
+    QSet<QString> m_suppressionChanged;     // Roots whose consequential count moved
+    
     QString makeFaultKey(const QString& subsystemId, const QString& faultCode) const;
+    void notifyFaultsChanged();
+    void schedulePublish();
+    void publishChanges();
+    void publishAdded(const FaultCode& fault);
+    void publishRemoved(const FaultCode& fault);
+    void reloadActiveModels();
+    QMap<QString, FaultCode>::iterator subsystemBegin(const QString& subsystemId);
+    QString findRootCause(const QString& subsystemId) const;
+    void account(const FaultCode& fault, int sign);
+    void setCause(FaultCode& fault, const QString& cause);
+    void recordHistory(const FaultCode& fault);
+    void announce(const FaultCode& fault);
+    void demoteDownstream(const QString& rootSubsystemId);
+    void promoteDownstream(const QString& formerRootId);
+    void reclassifyAll();
 };
 
 } // namespace RadarRMP
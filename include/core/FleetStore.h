@@ -0,0 +1,187 @@
+#ifndef FLEETSTORE_H
+#define FLEETSTORE_H
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include <QStringList>
+#include <QVariantMap>
+#include "HealthStatus.h"
+
+namespace RadarRMP {
+
+class RadarSubsystem;
+class FleetStore;
+
+/**
+ * @brief Lightweight QML facade over one FleetStore row
+ *
+ * Holds only a back-pointer and a dense index; every property reads
+ * straight from the store's columns. Views exist only for instances the
+ * UI has asked for (FleetStore::acquireView) and are notified when their
+ * row was touched since the last FleetStore::publishChanges().
+ */
+class FleetSubsystemView : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int index READ getIndex CONSTANT)
+    Q_PROPERTY(QString id READ getId CONSTANT)
+    Q_PROPERTY(QString typeName READ getTypeName CONSTANT)
+    Q_PROPERTY(QString healthState READ getHealthStateString NOTIFY changed)
+    Q_PROPERTY(double healthScore READ getHealthScore NOTIFY changed)
+    Q_PROPERTY(QVariantMap telemetry READ getTelemetry NOTIFY changed)
+    Q_PROPERTY(int alarmCount READ getAlarmCount NOTIFY changed)
+
+public:
+    FleetSubsystemView(FleetStore* store, int index);
+
+    int getIndex() const { return m_index; }
+    QString getId() const;
+    QString getTypeName() const;
+    QString getHealthStateString() const;
+    double getHealthScore() const;
+    QVariantMap getTelemetry() const;
+    int getAlarmCount() const;
+
+signals:
+    void changed();
+
+private:
+    friend class FleetStore;
+
+    FleetStore* m_store;
+    int m_index;
+    int m_refCount;
+};
+
+/**
+ * @brief Struct-of-arrays store for large subsystem fleets
+ *
+ * RadarSubsystem is a full QObject with its own mutex, TelemetryData
+ * child and fault containers, which does not scale to tens of thousands
+ * of instances. FleetStore keeps the hot state in flat columns keyed by a
+ * dense subsystem index:
+ *
+ * - state / score / alarm bitmaps: one entry per subsystem
+ * - parameter values: fixed stride per subsystem, row-major
+ *
+ * Parameter names and limits are shared per SubsystemType and taken from
+ * a prototype RadarSubsystem (defineLayout), so thresholds live in one
+ * place - the TelemetryParameter definitions.
+ *
+ * Not thread-safe: a single writer (the ingest loop) updates rows on the
+ * GUI thread; the first touched row schedules publishChanges() for the
+ * next SignalCoalescer frame.
+ */
+class FleetStore : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(int healthyCount READ getHealthyCount NOTIFY fleetChanged)
+    Q_PROPERTY(int degradedCount READ getDegradedCount NOTIFY fleetChanged)
+    Q_PROPERTY(int failedCount READ getFailedCount NOTIFY fleetChanged)
+
+public:
+    static constexpr int DEFAULT_PARAMETER_STRIDE = 10;
+    static constexpr int MAX_PARAMETER_STRIDE = 32;     // One alarm bit per parameter
+
+    /**
+     * @brief Shared per-type parameter layout
+     */
+    struct ParameterLayout {
+        QStringList names;
+        QStringList units;
+        QVector<double> warningLow;     // NaN = no limit
+        QVector<double> warningHigh;
+        QVector<double> criticalLow;
+        QVector<double> criticalHigh;
+        QString idPrefix;
+
+        int size() const { return names.size(); }
+        int indexOf(const QString& name) const { return names.indexOf(name); }
+    };
+
+    explicit FleetStore(int parameterStride = DEFAULT_PARAMETER_STRIDE,
+                        QObject* parent = nullptr);
+    ~FleetStore() override = default;
+
+    // Layout
+    void defineLayout(SubsystemType type, const RadarSubsystem* prototype);
+    const ParameterLayout& layout(SubsystemType type) const;
+    int parameterStride() const { return m_stride; }
+
+    // Population
+    void reserve(int subsystemCount);
+    int addSubsystem(const QString& id, SubsystemType type);
+    int populate(SubsystemType type, int instanceCount);
+    int count() const { return m_ids.size(); }
+    int indexOf(const QString& id) const;
+
+    // Hot path - ingest
+    void setValues(int index, const double* values, int valueCount);
+    void setValues(int index, const QVariantMap& values);
+    void setValue(int index, int parameter, double value);
+
+    // Column access
+    QString id(int index) const { return m_ids.at(index); }
+    SubsystemType type(int index) const { return m_types.at(index); }
+    HealthState state(int index) const { return static_cast<HealthState>(m_states.at(index)); }
+    double score(int index) const { return m_scores.at(index); }
+    const double* values(int index) const { return m_values.constData() + index * m_stride; }
+    quint32 warningBits(int index) const { return m_warningBits.at(index); }
+    quint32 criticalBits(int index) const { return m_criticalBits.at(index); }
+
+    // Aggregates (maintained on state transitions)
+    int getHealthyCount() const { return m_healthyCount; }
+    int getDegradedCount() const { return m_degradedCount; }
+    int getFailedCount() const { return m_failedCount; }
+
+    // Facades for the UI
+    Q_INVOKABLE FleetSubsystemView* acquireView(int index);
+    Q_INVOKABLE FleetSubsystemView* acquireViewById(const QString& id);
+    Q_INVOKABLE void releaseView(int index);
+    int viewCount() const { return m_views.size(); }
+
+    Q_INVOKABLE QVariantMap getSummary() const;
+
+public slots:
+    /**
+     * @brief Notify views and listeners of everything touched since last call
+     */
+    void publishChanges();
+
+signals:
+    void countChanged();
+    void fleetChanged(int changedCount);
+
+private:
+    void evaluate(int index);
+    void adjustStateCounts(HealthState state, int delta);
+    void markDirty(int index);
+
+    int m_stride;
+    QVector<ParameterLayout> m_layouts;     // Indexed by SubsystemType
+
+    // Columns - one entry per subsystem
+    QVector<QString> m_ids;
+    QVector<SubsystemType> m_types;
+    QVector<quint8> m_states;
+    QVector<double> m_scores;
+    QVector<quint32> m_warningBits;
+    QVector<quint32> m_criticalBits;
+    QVector<quint8> m_dirty;
+
+    // Parameter values - m_stride entries per subsystem
+    QVector<double> m_values;
+
+    QHash<QString, int> m_indexById;
+    QVector<int> m_typeInstanceCounts;      // Indexed by SubsystemType, for id generation
+    QVector<int> m_dirtyList;
+    QHash<int, FleetSubsystemView*> m_views;
+
+    int m_healthyCount;
+    int m_degradedCount;
+    int m_failedCount;
+};
+
+} // namespace RadarRMP
+
+#endif // FLEETSTORE_H
@@ -111,7 +111,7 @@ private:
     struct QueueItem {
         QString subsystemId;
         QVariantMap data;
-        qint64 timestamp;
+        Timestamp timestamp;
     };
     
     QQueue<QueueItem> m_dataQueue;
@@ -0,0 +1,144 @@
+#ifndef HEALTHROLLUP_H
+#define HEALTHROLLUP_H
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include <QStringList>
+#include <QVariantMap>
+#include "HealthStatus.h"
+
+namespace RadarRMP {
+
+/**
+ * @brief Hierarchical health aggregation (site -> radar -> cabinet -> subsystem)
+ *
+ * A forest of aggregation nodes whose leaves are subsystems. Every node
+ * keeps per-state child counts and a weighted score sum, i.e. the same
+ * incremental aggregate SubsystemManager keeps for the whole system, plus
+ * its own cached state and score. A leaf update subtracts the child's
+ * previously reported value from its parent, adds the new one and
+ * re-evaluates that parent only; propagation continues up the ancestor
+ * path while a node's value actually changes. A change therefore costs
+ * O(depth), independent of fan-out.
+ *
+ * Leaves are fed by SubsystemManager. GUI thread only.
+ */
+class HealthRollup : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int nodeCount READ getNodeCount NOTIFY structureChanged)
+
+public:
+    enum RollupFunction {
+        WorstOf,        // Worst child state; score is the weighted mean
+        WeightedMean,   // State from the weighted mean score and thresholds
+        KOfN            // FAIL below quorum available, DEGRADED until all OK
+    };
+    Q_ENUM(RollupFunction)
+
+    static constexpr double DEFAULT_DEGRADED_BELOW = 80.0;
+    static constexpr double DEFAULT_FAIL_BELOW = 50.0;
+
+    explicit HealthRollup(QObject* parent = nullptr);
+    ~HealthRollup() override = default;
+
+    /**
+     * @brief Add an aggregation node
+     * @param parentId Empty for a root
+     * @param quorum Required available children for KOfN
+     * @param weight Weight of this node in its parent's mean
+     */
+    bool addNode(const QString& id, const QString& name, const QString& parentId,
+                 RollupFunction function = WorstOf, int quorum = 1, double weight = 1.0);
+
+    /**
+     * @brief Remove a node together with its subtree
+     */
+    void removeNode(const QString& id);
+
+    bool setRollupFunction(const QString& id, RollupFunction function, int quorum = 1);
+    bool setScoreThresholds(const QString& id, double degradedBelow, double failBelow);
+
+    // Leaves (subsystems)
+    bool attachLeaf(const QString& subsystemId, const QString& parentId, double weight = 1.0);
+    void detachLeaf(const QString& subsystemId);
+    bool hasLeaf(const QString& subsystemId) const;
+
+    /**
+     * @brief Report a subsystem's health; no-op for unattached subsystems
+     * @param scored Whether the score counts (disabled subsystems do not)
+     */
+    void updateLeaf(const QString& subsystemId, HealthState state, double score, bool scored);
+
+    // Cached per-node values
+    bool hasNode(const QString& id) const;
+    HealthState nodeState(const QString& id) const;
+    double nodeScore(const QString& id) const;
+    int getNodeCount() const { return m_nodeIndex.size(); }
+
+    // QML access
+    Q_INVOKABLE bool addNodeVariant(const QVariantMap& spec);
+    Q_INVOKABLE QVariantMap getNodeSummary(const QString& id) const;
+    Q_INVOKABLE QStringList getRootNodes() const;
+    Q_INVOKABLE QStringList getChildNodes(const QString& id) const;
+    Q_INVOKABLE QStringList getLeaves(const QString& id) const;
+    Q_INVOKABLE QString getParentNode(const QString& id) const;
+    Q_INVOKABLE QString getNodeStateString(const QString& id) const;
+
+    static QString rollupFunctionToString(RollupFunction function);
+    static RollupFunction rollupFunctionFromString(const QString& text);
+
+signals:
+    void nodeChanged(const QString& nodeId);
+    void structureChanged();
+
+private:
+    static constexpr int STATE_COUNT = static_cast<int>(HealthState::UNKNOWN) + 1;
+
+    struct Node {
+        QString id;
+        QString name;
+        int parent = -1;
+        bool leaf = false;
+        QVector<int> children;
+
+        RollupFunction function = WorstOf;
+        int quorum = 1;
+        double weight = 1.0;
+        double degradedBelow = DEFAULT_DEGRADED_BELOW;
+        double failBelow = DEFAULT_FAIL_BELOW;
+
+        // Aggregate over children's reported values
+        int stateCounts[STATE_COUNT] = {0, 0, 0, 0};
+        double weightedScoreSum = 0.0;
+        double scoredWeight = 0.0;
+
+        // Own value
+        HealthState state = HealthState::UNKNOWN;
+        double score = 100.0;
+        bool scored = false;
+
+        // Value currently folded into the parent's aggregate
+        HealthState reportedState = HealthState::UNKNOWN;
+        double reportedScore = 100.0;
+        bool reportedScored = false;
+    };
+
+    int allocate(const QString& id, int parentIndex, bool leaf, double weight);
+    void release(int index);
+    void contribute(Node& parent, const Node& child, int sign) const;
+    bool evaluate(Node& node) const;
+    bool differsFromReported(const Node& node) const;
+    void propagateFrom(int index);
+    void emitChanged(const QStringList& changed);
+    QStringList idsOf(const QVector<int>& indices, bool leaves) const;
+
+    QVector<Node> m_nodes;
+    QVector<int> m_freeNodes;
+    QHash<QString, int> m_nodeIndex;    // Aggregation nodes by id
+    QHash<QString, int> m_leafIndex;    // Leaves by subsystem id
+};
+
+} // namespace RadarRMP
+
+#endif // HEALTHROLLUP_H
@@ -0,0 +1,179 @@
+#ifndef HEALTHRULEENGINE_H
+#define HEALTHRULEENGINE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVariantMap>
+#include <QVector>
+#include <QHash>
+#include <limits>
+#include "HealthStatus.h"
+
+namespace RadarRMP {
+
+class TelemetryData;
+
+/**
+ * @brief Declarative health rule definition
+ *
+ * Rules are plain data: subsystems build their defaults in
+ * initializeHealthRules() and sites can replace them at runtime from a
+ * QVariantList (e.g. parsed JSON) via RadarSubsystem::loadHealthRules().
+ *
+ * Kinds:
+ * - Threshold:    parameter against low/high warning and critical limits.
+ *                 Limits left as NaN are taken from the TelemetryParameter.
+ * - RateOfChange: |d(parameter)/dt| per second against warningHigh/criticalHigh
+ * - Boolean:      parameter compared with an expected value; mismatch fires
+ *                 at the rule's level
+ * - Combination:  All (lowest operand level) or Any (highest operand level)
+ *                 over previously defined rules
+ *
+ * A rule at critical level raises its fault code (if any); the fault is
+ * cleared when the rule drops back out of critical, but only if the rule
+ * raised it - a fault with the same code injected or raised by an
+ * operator is left alone.
+ */
+struct HealthRule {
+    enum class Kind { Threshold, RateOfChange, Boolean, Combination };
+    enum class Bound { Both, Low, High };
+    enum class Combine { All, Any };
+    enum Level : quint8 { Normal = 0, Warning = 1, Critical = 2 };
+
+    QString id;
+    Kind kind = Kind::Threshold;
+    QString parameter;
+    QString ratioOf;                // Threshold: evaluate 100 * parameter / ratioOf
+
+    // Threshold / RateOfChange limits (NaN = inherit from telemetry, or none)
+    Bound bound = Bound::Both;
+    bool inclusive = true;          // Fire at the limit itself, as telemetry zones do
+    double warningLow = std::numeric_limits<double>::quiet_NaN();
+    double warningHigh = std::numeric_limits<double>::quiet_NaN();
+    double criticalLow = std::numeric_limits<double>::quiet_NaN();
+    double criticalHigh = std::numeric_limits<double>::quiet_NaN();
+
+    // Boolean
+    bool expected = true;
+    Level level = Critical;
+
+    // Combination
+    Combine combine = Combine::All;
+    QStringList operands;
+
+    // Contribution to state and score. Condition-only rules (operands of a
+    // combination, fault triggers) set affectsHealth = false.
+    bool affectsHealth = true;
+    double warningPenalty = 0.0;    // Scaled by how far into the warning band
+    double criticalPenalty = 0.0;
+
+    // Fault raised while the rule is critical
+    QString faultCode;
+    QString faultDescription;
+    FaultSeverity faultSeverity = FaultSeverity::CRITICAL;
+
+    // Status text while firing; "%1" is replaced by the parameter value
+    QString warningMessage;
+    QString criticalMessage;
+    int precision = 1;
+
+    static HealthRule threshold(const QString& parameter, double criticalPenalty = 0.0,
+                                double warningPenalty = 0.0);
+    static HealthRule rateOfChange(const QString& parameter, double warningRate,
+                                   double criticalRate);
+    static HealthRule boolean(const QString& parameter, bool expected, Level level = Critical);
+    static HealthRule combination(const QString& id, Combine combine, const QStringList& operands);
+
+    QVariantMap toVariantMap() const;
+    static HealthRule fromVariantMap(const QVariantMap& map);
+};
+
+/**
+ * @brief Rules compiled into a flat program over parameter indices
+ *
+ * Compilation resolves parameter names to dense indices, inherits limits
+ * from TelemetryData and orders combinations after their operands. The
+ * evaluator is then a single pass over a contiguous instruction array
+ * reading a double per parameter - no map lookups, no QVariant, and a cost
+ * proportional to the rule count.
+ */
+class HealthRuleProgram {
+public:
+    struct Evaluation {
+        HealthState state = HealthState::OK;
+        double score = 100.0;
+        QVector<quint8> levels;     // HealthRule::Level per rule
+    };
+
+    HealthRuleProgram() = default;
+
+    static HealthRuleProgram compile(const QList<HealthRule>& rules,
+                                     const TelemetryData* telemetry,
+                                     QStringList* errors = nullptr);
+
+    bool isEmpty() const { return m_instructions.isEmpty(); }
+    int ruleCount() const { return m_instructions.size(); }
+
+    // Input layout
+    const QStringList& parameters() const { return m_parameters; }
+    int parameterIndex(const QString& name) const { return m_parameterIndex.value(name, -1); }
+
+    /**
+     * @brief Evaluate all rules
+     * @param inputs Current value per parameter index
+     * @param previous Previous value per parameter index (RateOfChange)
+     * @param dtSeconds Time between previous and inputs; <= 0 disables rates
+     */
+    void evaluate(const double* inputs, const double* previous, double dtSeconds,
+                  Evaluation* result) const;
+
+    // Per-rule metadata for fault sync and status text
+    QString ruleId(int rule) const { return m_ruleIds.at(rule); }
+    bool raisesFault(int rule) const { return !m_faults.at(rule).code.isEmpty(); }
+    FaultCode makeFault(int rule, const QString& subsystemId) const;
+    QString faultCode(int rule) const { return m_faults.at(rule).code; }
+
+    /**
+     * @brief Status text of the most severe firing rule (first in rule order)
+     */
+    QString message(const Evaluation& result, const double* inputs) const;
+
+private:
+    struct Instruction {
+        HealthRule::Kind kind;
+        HealthRule::Combine combine;
+        quint8 level;
+        bool inclusive;
+        bool affectsHealth;
+        bool expected;
+        int parameter;
+        int ratioOf;                // -1 = none
+        int firstOperand;
+        int operandCount;
+        double warningLow;          // -inf/+inf when absent
+        double warningHigh;
+        double criticalLow;
+        double criticalHigh;
+        double warningPenalty;
+        double criticalPenalty;
+    };
+
+    int internParameter(const QString& name);
+
+    QVector<Instruction> m_instructions;
+    QVector<int> m_operands;
+
+    QStringList m_parameters;
+    QHash<QString, int> m_parameterIndex;
+
+    // Cold per-rule data, only touched on level changes
+    QStringList m_ruleIds;
+    QVector<FaultCode> m_faults;
+    QStringList m_warningMessages;
+    QStringList m_criticalMessages;
+    QVector<int> m_precisions;
+};
+
+} // namespace RadarRMP
+
+#endif // HEALTHRULEENGINE_H
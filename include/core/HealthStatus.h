@@ -5,6 +5,8 @@
 #include <QString>
 #include <QDateTime>
 #include <QVariantMap>
+#include <memory>
+#include "Timestamp.h"
 
 namespace RadarRMP {
 
@@ -56,37 +58,47 @@ struct FaultCode {
     QString code;           // Unique fault identifier (e.g., "TX-001")
     QString description;    // Human-readable description
     FaultSeverity severity; // Severity level
-    QDateTime timestamp;    // When the fault occurred
+    Timestamp timestamp;    // When the fault occurred (monotonic)
     QString subsystemId;    // Which subsystem reported the fault
     bool active;            // Is the fault currently active
     QVariantMap metadata;   // Additional fault-specific data
+    QString causedBy;       // Upstream subsystem holding the root fault; empty for root faults
     
     FaultCode() : severity(FaultSeverity::INFO), active(false) {}
     
     FaultCode(const QString& c, const QString& desc, FaultSeverity sev, 
               const QString& subsys)
         : code(c), description(desc), severity(sev), 
-          timestamp(QDateTime::currentDateTime()), subsystemId(subsys), 
+          timestamp(Timestamp::now()), subsystemId(subsys), 
           active(true) {}
 };
 
 /**
  * @brief Health status snapshot for a subsystem
+ *
+ * Published snapshots are immutable and shared (HealthSnapshotPtr); the
+ * epoch identifies the subsystem state they were taken from.
  */
 struct HealthSnapshot {
     HealthState state;
-    QDateTime timestamp;
+    Timestamp timestamp;
     QVariantMap telemetry;
     QList<FaultCode> activeFaults;
     double healthScore;     // 0.0 to 100.0
     QString statusMessage;
+    quint64 faultMask;      // Active registered fault codes, by bit index
+    quint64 epoch;          // Subsystem state epoch at capture time
     
     HealthSnapshot() 
         : state(HealthState::UNKNOWN), 
-          timestamp(QDateTime::currentDateTime()),
-          healthScore(100.0) {}
+          timestamp(Timestamp::now()),
+          healthScore(100.0),
+          faultMask(0),
+          epoch(0) {}
 };
 
+using HealthSnapshotPtr = std::shared_ptr<const HealthSnapshot>;
+
 // Qt Meta-type declarations for use in signals/slots
 inline QString healthStateToString(HealthState state) {
     switch (state) {
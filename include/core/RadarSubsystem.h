@@ -2,10 +2,20 @@
 #define RADARSUBSYSTEM_H
 
 #include <QObject>
-#include <QTimer>
 #include <QMutex>
+#include <QRecursiveMutex>
+#include <QPointer>
+#include <QAtomicInteger>
+#include <QPointF>
+#include <QSet>
+#include <functional>
 #include "IRadarSubsystem.h"
 #include "TelemetryData.h"
+#include "ActiveFaultSet.h"
+#include "RingBuffer.h"
+#include "SignalCoalescer.h"
+#include "HealthRuleEngine.h"
+#include "SelfTestRunner.h"
 
 namespace RadarRMP {
 
@@ -18,8 +28,15 @@ namespace RadarRMP {
  * 
  * Features:
  * - Thread-safe telemetry and fault management
- * - Automatic health state computation
- * - Signal emission for QML binding
+ * - updateData()/postData() callable from worker threads: evaluation runs
+ *   on the writing thread, and every signal is emitted on the owning (GUI)
+ *   thread - property notifications coalesced per frame, fault/state
+ *   events and telemetryValuesChanged queued in order
+ * - Health state computed by a compiled HealthRuleProgram; derived classes
+ *   declare rules in initializeHealthRules() instead of hand-coding checks
+ * - Signal emission for QML binding, coalesced per frame by SignalCoalescer
+ * - Immutable HealthSnapshot published per state epoch; readers share it
+ *   without taking the subsystem mutex
  * - Configurable update intervals
  */
 class RadarSubsystem : public QObject, public IRadarSubsystem {
@@ -73,19 +90,77 @@ public:
     void reset() override;
     bool runSelfTest() override;
     
+    /**
+     * @brief Build this subsystem's BIT for SelfTestRunner's pool
+     *
+     * Runs on the GUI thread and copies what the test checks; the returned
+     * procedure runs on a pool thread and must not touch the subsystem.
+     * The base test checks the health state and every telemetry parameter
+     * for validity and limits. Overrides may add their own checks.
+     */
+    virtual SelfTestProcedure prepareSelfTest() const;
+    
     void updateData(const QVariantMap& data) override;
     void processHealthData() override;
     
+    /**
+     * @brief Non-blocking ingest from any thread
+     *
+     * Merges data into a per-subsystem mailbox (latest value per key wins).
+     * If no other thread is applying updates to this subsystem, the caller
+     * becomes the writer and drains the mailbox itself; otherwise it
+     * returns immediately and the active writer picks the data up.
+     */
+    void postData(const QVariantMap& data);
+    
     // Additional methods
     QString getTypeName() const;
     void setDescription(const QString& desc);
     
+    /**
+     * @brief Current published snapshot
+     *
+     * Lock-free when nothing changed since the last publication; otherwise
+     * the snapshot is rebuilt once and shared by all subsequent readers.
+     */
+    HealthSnapshotPtr healthSnapshot() const;
+    
+    /**
+     * @brief Monotonic counter bumped on every health/telemetry/fault change
+     */
+    quint64 healthEpoch() const { return m_healthEpoch.loadAcquire(); }
+    bool isUnchangedSince(quint64 epoch) const { return healthEpoch() == epoch; }
+    
+    // Declared fault codes; bit i of HealthSnapshot::faultMask is code i
+    QStringList getRegisteredFaultCodes() const;
+    
+    // Index used by TelemetryChange entries
+    QString getTelemetryParameterName(int index) const;
+    
+    // Short-term telemetry history (disabled until a capacity is set)
+    void setTelemetryHistoryCapacity(int samples);
+    int getTelemetryHistoryCapacity() const;
+    TelemetryHistorySpan telemetryHistory(const QString& paramName) const;
+    QList<QPointF> telemetryHistoryPoints(const QString& paramName, int maxSamples = 0) const;
+    
+    /**
+     * @brief Recent history as points (x = msecs since epoch, y = value)
+     * @param maxSamples Newest samples to return; 0 = all retained
+     */
+    Q_INVOKABLE QVariantList getTelemetryHistory(const QString& paramName, int maxSamples = 0) const;
+    
+    // Health rules - replaceable per site, e.g. from a JSON rule file
+    Q_INVOKABLE bool loadHealthRules(const QVariantList& rules);
+    Q_INVOKABLE QVariantList getHealthRules() const;
+    Q_INVOKABLE QVariantMap getHealthRuleStats() const;
+    
 public slots:
     void onUpdate();
     
 signals:
     void healthChanged();
     void telemetryChanged();
+    void telemetryValuesChanged(const RadarRMP::TelemetryChangeSet& changes);
     void faultsChanged();
     void enabledChanged();
     void faultOccurred(const QString& faultCode, const QString& description);
@@ -95,6 +170,7 @@ signals:
 protected:
     // Override in derived classes for subsystem-specific behavior
     virtual void initializeTelemetryParameters();
+    virtual void initializeHealthRules();
     virtual HealthState computeHealthState() const;
     virtual double computeHealthScore() const;
     virtual QString computeStatusMessage() const;
@@ -104,15 +180,23 @@ protected:
     void addFault(const FaultCode& fault);
     void removeFault(const QString& faultCode);
     void updateFault(const QString& faultCode, bool active);
+    void registerFaultCodes(const QStringList& faultCodes);
     
     // Telemetry helpers
     void setTelemetryValue(const QString& name, const QVariant& value);
     void addTelemetryParameter(const TelemetryParameter& param);
     
+    // Health rule helpers
+    void addHealthRule(const HealthRule& rule);
+    QString healthRuleMessage() const;
+    
     // State management
     void setHealthState(HealthState state);
     void setStatusMessage(const QString& message);
     
+    // Queue signals for the next SignalCoalescer frame
+    void scheduleNotification(SignalCoalescer::PendingSignals pending);
+    
 protected:
     QString m_id;
     QString m_name;
@@ -124,25 +208,74 @@ protected:
     QString m_statusMessage;
     
     TelemetryData* m_telemetryData;
-    QList<FaultCode> m_activeFaults;
-    QList<FaultCode> m_faultHistory;
+    ActiveFaultSet m_activeFaults;
+    RingBuffer<FaultCode> m_faultHistory;
     
     bool m_enabled;
     mutable QMutex m_mutex;
     
-    // Prevent recursive/cascading processHealthData calls
+    // Serializes writers (updateData, processHealthData, reset, rule
+    // changes) across threads. Taken before m_mutex, never after.
+    mutable QRecursiveMutex m_updateMutex;
+    
+    // Prevent recursive/cascading processHealthData calls (m_updateMutex)
     bool m_processingHealth;
     bool m_healthUpdatePending;
     
-    // Signal debouncing to prevent signal storms
-    QTimer* m_signalDebounceTimer;
-    bool m_pendingHealthSignal;
-    bool m_pendingTelemetrySignal;
-    qint64 m_lastHealthSignalTime;
-    qint64 m_lastTelemetrySignalTime;
-    static constexpr int SIGNAL_DEBOUNCE_MS = 50;  // Minimum 50ms between signals
+    // Signals owed to QML/listeners, emitted once per coalescer frame
+    QPointer<SignalCoalescer> m_coalescer;
+    SignalCoalescer::PendingSignals m_pendingSignals;
+    bool m_notificationQueued;
+    bool m_workQueued;              // In the coalescer's work queue
+    
+    // Published snapshot; swapped atomically, never modified in place
+    QAtomicInteger<quint64> m_healthEpoch;
+    mutable HealthSnapshotPtr m_snapshot;
+    
+    // Declarative health rules and their compiled form. Inputs hold one
+    // double per program parameter, updated in place from updateData();
+    // rules are re-evaluated only after an input moved (m_updateMutex).
+    QList<HealthRule> m_healthRules;
+    HealthRuleProgram m_healthProgram;
+    HealthRuleProgram::Evaluation m_ruleEvaluation;
+    QVector<double> m_ruleInputs;
+    QVector<double> m_rulePrevious;
+    Timestamp m_ruleSampleTime;
+    double m_ruleSampleInterval;
+    bool m_healthProgramDirty;
+    bool m_ruleInputsChanged;
+    qint64 m_ruleEvaluationNs;
+    quint64 m_ruleEvaluationCount;
     
     static constexpr int MAX_FAULT_HISTORY = 1000;
+    
+private:
+    // Active fault codes a health rule raised (m_mutex). Rules clear only
+    // these, never a fault injected or raised by an operator.
+    QSet<QString> m_ruleRaisedFaults;
+    
+    // postData() mailbox
+    QMutex m_mailboxMutex;
+    QVariantMap m_mailbox;
+    bool m_mailboxDraining;
+    
+    // Signals raised by off-thread writers, not yet handed to the coalescer
+    QAtomicInt m_postedSignals;
+    
+    friend class SignalCoalescer;
+    friend class SubsystemManager;
+    void runPendingWork();
+    void flushPendingNotifications();
+    void receivePostedSignals();
+    void emitOnOwnerThread(std::function<void()> emitter);
+    HealthSnapshotPtr publishHealthSnapshot() const;
+    
+    void compileHealthRules();
+    void installHealthProgram(const HealthRuleProgram& program);
+    void updateHealthRuleInputs(const QVariantMap& data);
+    void evaluateHealthRules();
+    bool raiseRuleFault(const FaultCode& fault);
+    bool takeFault(const QString& faultCode, bool ruleRaisedOnly);
 };
 
 } // namespace RadarRMP
@@ -0,0 +1,138 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <QVector>
+
+namespace RadarRMP {
+
+/**
+ * @brief Fixed-capacity circular buffer
+ *
+ * Storage is allocated once by setCapacity(). When the buffer is full,
+ * push() overwrites the oldest element in place, so inserts stay O(1)
+ * instead of shifting the whole container like QList::removeFirst().
+ *
+ * Indexing with at() is oldest-first; fromNewest() is newest-first.
+ * span() exposes the contents in place as at most two contiguous runs.
+ */
+template <typename T>
+class RingBuffer {
+public:
+    /**
+     * @brief Zero-copy read view, oldest-first
+     *
+     * The stored elements form at most two contiguous runs: [first] up to
+     * the end of the allocation, then [second] wrapped around from its
+     * start. Valid until the buffer is next modified.
+     */
+    struct Span {
+        const T* first = nullptr;
+        int firstSize = 0;
+        const T* second = nullptr;
+        int secondSize = 0;
+
+        int size() const { return firstSize + secondSize; }
+        bool isEmpty() const { return size() == 0; }
+        const T& operator[](int i) const
+        {
+            return i < firstSize ? first[i] : second[i - firstSize];
+        }
+    };
+
+    explicit RingBuffer(int capacity = 0)
+    {
+        setCapacity(capacity);
+    }
+
+    /**
+     * @brief Resize the buffer (discards current contents)
+     */
+    void setCapacity(int capacity)
+    {
+        m_data.clear();
+        m_data.resize(qMax(0, capacity));
+        m_head = 0;
+        m_size = 0;
+    }
+
+    int capacity() const { return m_data.size(); }
+    int size() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+    bool isFull() const { return m_size == m_data.size(); }
+
+    void push(const T& value)
+    {
+        if (m_data.isEmpty()) {
+            return;
+        }
+
+        if (m_size < m_data.size()) {
+            m_data[physicalIndex(m_size)] = value;
+            ++m_size;
+        } else {
+            // Full - overwrite the oldest slot and advance the head
+            m_data[m_head] = value;
+            m_head = (m_head + 1) % m_data.size();
+        }
+    }
+
+    /**
+     * @brief Element by age, 0 = oldest
+     */
+    const T& at(int i) const
+    {
+        return m_data.at(physicalIndex(i));
+    }
+
+    /**
+     * @brief Element by recency, 0 = newest
+     */
+    const T& fromNewest(int i) const
+    {
+        return at(m_size - 1 - i);
+    }
+
+    const T& newest() const
+    {
+        return fromNewest(0);
+    }
+
+    Span span() const
+    {
+        Span view;
+        if (m_size == 0) {
+            return view;
+        }
+
+        const T* data = m_data.constData();
+        view.first = data + m_head;
+        view.firstSize = qMin(m_size, m_data.size() - m_head);
+        view.second = data;
+        view.secondSize = m_size - view.firstSize;
+        return view;
+    }
+
+    void clear()
+    {
+        // Keep the allocation; just release the stored values
+        for (int i = 0; i < m_data.size(); ++i) {
+            m_data[i] = T();
+        }
+        m_head = 0;
+        m_size = 0;
+    }
+
+private:
+    int physicalIndex(int i) const
+    {
+        return (m_head + i) % m_data.size();
+    }
+
+    QVector<T> m_data;
+    int m_head = 0;     // Physical index of the oldest element
+    int m_size = 0;
+};
+
+} // namespace RadarRMP
+
+#endif // RINGBUFFER_H
@@ -0,0 +1,171 @@
+#ifndef SELFTESTRUNNER_H
+#define SELFTESTRUNNER_H
+
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QVariantList>
+#include <QAtomicInt>
+#include <functional>
+#include <memory>
+#include "HealthStatus.h"
+
+class QThreadPool;
+
+namespace RadarRMP {
+
+class RadarSubsystem;
+
+/**
+ * @brief Outcome of one subsystem built-in test (BIT)
+ */
+struct SelfTestResult {
+    QString subsystemId;
+    bool passed;
+    bool timedOut;
+    bool cancelled;
+    HealthState state;
+    QString message;
+    qint64 durationMs;
+
+    SelfTestResult()
+        : passed(false), timedOut(false), cancelled(false),
+          state(HealthState::UNKNOWN), durationMs(0) {}
+
+    QVariantMap toVariantMap() const;
+};
+
+/**
+ * @brief Pool-thread body of one BIT
+ *
+ * Built on the GUI thread by RadarSubsystem::prepareSelfTest() from a
+ * copy of the state it checks; it must not reference the subsystem, so a
+ * running test never delays removing or destroying it.
+ */
+using SelfTestProcedure = std::function<SelfTestResult()>;
+
+/**
+ * @brief Progress/future handle for one asynchronous self-test run
+ *
+ * Lives on the GUI thread. Results arrive one by one (resultReady) as
+ * subsystems finish; finished() fires once every subsystem has either
+ * reported, timed out or been cancelled.
+ */
+class SelfTestOperation : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int total READ getTotal CONSTANT)
+    Q_PROPERTY(int completed READ getCompleted NOTIFY progressChanged)
+    Q_PROPERTY(int passedCount READ getPassedCount NOTIFY progressChanged)
+    Q_PROPERTY(int failedCount READ getFailedCount NOTIFY progressChanged)
+    Q_PROPERTY(double progress READ getProgress NOTIFY progressChanged)
+    Q_PROPERTY(bool running READ isRunning NOTIFY runningChanged)
+    Q_PROPERTY(bool passed READ hasPassed NOTIFY runningChanged)
+    Q_PROPERTY(qint64 elapsedMs READ getElapsedMs NOTIFY progressChanged)
+    Q_PROPERTY(QVariantList results READ getResults NOTIFY progressChanged)
+
+public:
+    int getTotal() const { return m_total; }
+    int getCompleted() const { return m_results.size(); }
+    int getPassedCount() const { return m_passedCount; }
+    int getFailedCount() const { return m_results.size() - m_passedCount; }
+    double getProgress() const;
+    bool isRunning() const { return m_running; }
+    bool hasPassed() const;
+    qint64 getElapsedMs() const;
+    QVariantList getResults() const;
+
+    QList<SelfTestResult> results() const { return m_results; }
+
+    /**
+     * @brief Report every outstanding subsystem as cancelled
+     *
+     * Tests not yet started are skipped; tests already running complete
+     * on their worker but their result is discarded.
+     */
+    Q_INVOKABLE void cancel();
+
+    /**
+     * @brief Report one subsystem as cancelled, e.g. because it was removed
+     */
+    void cancel(const QString& subsystemId, const QString& reason);
+
+signals:
+    void resultReady(const QVariantMap& result);
+    void progressChanged();
+    void runningChanged();
+    void finished(bool passed);
+
+private:
+    friend class SelfTestRunner;
+
+    SelfTestOperation(const QStringList& subsystemIds, QObject* parent);
+
+    // First report per subsystem wins; later ones (late workers) are dropped
+    void report(const SelfTestResult& result);
+
+    int m_total;
+    QHash<QString, bool> m_outstanding;     // Subsystem id -> awaiting result
+    QList<SelfTestResult> m_results;
+    int m_passedCount;
+    bool m_running;
+    QElapsedTimer m_clock;
+    qint64 m_elapsedMs;
+    std::shared_ptr<QAtomicInt> m_cancelled;    // Read by queued workers
+};
+
+/**
+ * @brief Runs subsystem self-tests concurrently on a worker pool
+ *
+ * Each subsystem's RadarSubsystem::prepareSelfTest() procedure runs on a
+ * pool thread, so a system-wide BIT takes roughly as long as its slowest
+ * test instead of the sum, and the GUI thread never blocks. A per-test
+ * timeout reports a hung test as failed without waiting for it.
+ *
+ * Must be created and used on the GUI thread.
+ */
+class SelfTestRunner : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int maxConcurrency READ getMaxConcurrency WRITE setMaxConcurrency NOTIFY maxConcurrencyChanged)
+
+public:
+    static constexpr int DEFAULT_TIMEOUT_MS = 5000;
+
+    explicit SelfTestRunner(QObject* parent = nullptr);
+    ~SelfTestRunner() override;
+
+    int getMaxConcurrency() const;
+    void setMaxConcurrency(int threads);
+
+    /**
+     * @brief Start self-tests for the given subsystems
+     * @return Operation owned by the runner; valid until the runner is
+     *         destroyed or release() is called
+     */
+    SelfTestOperation* start(const QList<RadarSubsystem*>& subsystems,
+                             int timeoutMs = DEFAULT_TIMEOUT_MS);
+
+    /**
+     * @brief Dispose of a finished (or cancelled) operation
+     */
+    void release(SelfTestOperation* operation);
+
+    /**
+     * @brief Cancel a subsystem's outstanding tests in every operation
+     *
+     * Call before deleting the subsystem. Never waits: workers hold only
+     * their procedure's copy, and any late result is dropped.
+     */
+    void retire(const QString& subsystemId);
+
+signals:
+    void maxConcurrencyChanged();
+
+private:
+    QThreadPool* m_pool;
+};
+
+} // namespace RadarRMP
+
+#endif // SELFTESTRUNNER_H
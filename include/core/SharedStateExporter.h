@@ -0,0 +1,114 @@
+#ifndef SHAREDSTATEEXPORTER_H
+#define SHAREDSTATEEXPORTER_H
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include <QStringList>
+#include "HealthStatus.h"
+#include "SharedStateLayout.h"
+
+namespace RadarRMP {
+
+class RadarSubsystem;
+
+/**
+ * @brief Publishes live subsystem state to a POSIX shared-memory segment
+ *
+ * Recorders, gateways and watchdogs on the same host map the segment
+ * read-only and poll it without touching this process (see
+ * SharedStateLayout.h for the format and the reader-side seqlock).
+ *
+ * Each tracked subsystem gets a fixed slot. Its state is rewritten after
+ * each SignalCoalescer work pass that covered it (SignalCoalescer::
+ * workFlushed, at most once per frameInterval and independent of window
+ * visibility), and only if its health epoch moved since the last write. A write is a copy from the
+ * subsystem's published HealthSnapshot into the slot, so it never takes
+ * the subsystem mutex beyond what the snapshot needs.
+ *
+ * Must be created and used on the GUI thread. Only available where POSIX
+ * shared memory is; open() fails elsewhere.
+ */
+class SharedStateExporter : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(bool open READ isOpen NOTIFY openChanged)
+    Q_PROPERTY(QString segmentName READ getSegmentName NOTIFY openChanged)
+    Q_PROPERTY(QString errorString READ getErrorString NOTIFY openChanged)
+
+public:
+    static constexpr const char* DEFAULT_SEGMENT_NAME = "/radar_rmp_state";
+    static constexpr int DEFAULT_CAPACITY = 256;
+
+    explicit SharedStateExporter(QObject* parent = nullptr);
+    ~SharedStateExporter() override;
+
+    /**
+     * @brief Create the segment and reset all slots
+     *
+     * An existing segment of that name is replaced only if its writer
+     * process has exited; one held by a live writer, or not in this
+     * format, makes open() fail.
+     *
+     * @param name POSIX shm name, starting with '/'
+     * @param capacity Number of subsystem slots
+     */
+    bool open(const QString& name = QString::fromLatin1(DEFAULT_SEGMENT_NAME),
+              int capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Unmap and unlink the segment; attached readers keep their mapping
+     */
+    void close();
+
+    bool isOpen() const { return m_segment != nullptr; }
+    QString getSegmentName() const { return m_name; }
+    QString getErrorString() const { return m_error; }
+    int getCapacity() const { return m_capacity; }
+    int getSubsystemCount() const { return m_slots.size(); }
+
+    // Slot management
+    bool addSubsystem(RadarSubsystem* subsystem);
+    void removeSubsystem(RadarSubsystem* subsystem);
+    void setOnCanvas(RadarSubsystem* subsystem, bool onCanvas);
+
+    // Writers
+    void publish(RadarSubsystem* subsystem);
+    void publishSystem(HealthState state, double score, int subsystemCount,
+                       int healthyCount, int degradedCount, int failedCount,
+                       int activeFaultCount);
+
+signals:
+    void openChanged();
+
+private slots:
+    void onWorkFlushed(const QVector<RadarSubsystem*>& subsystems);
+
+private:
+    SharedState::SegmentHeader* header() const;
+    SharedState::SubsystemSlot* slotAt(int index) const;
+    void writeStatic(SharedState::SubsystemSlot* slot, RadarSubsystem* subsystem,
+                     const QStringList& parameters, const QStringList& faultCodes);
+    void writeDynamic(SharedState::SubsystemSlot* slot, RadarSubsystem* subsystem,
+                      const QStringList& parameters);
+    void touch();
+
+    QString m_name;
+    QString m_error;
+    int m_capacity;
+    void* m_segment;
+    size_t m_size;
+
+    struct Binding {
+        int index;
+        QStringList parameters;     // Order of SubsystemRecord::values
+        int faultCodeCount;         // SubsystemRecord::faultCodes entries written
+    };
+
+    QHash<RadarSubsystem*, Binding> m_slots;
+    QVector<int> m_freeSlots;
+    int m_highWater;
+};
+
+} // namespace RadarRMP
+
+#endif // SHAREDSTATEEXPORTER_H
@@ -0,0 +1,191 @@
+#ifndef SHAREDSTATELAYOUT_H
+#define SHAREDSTATELAYOUT_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace RadarRMP {
+namespace SharedState {
+
+/**
+ * @brief Binary layout of the live-state shared-memory segment
+ *
+ * Written by SharedStateExporter, read by any process on the host that
+ * maps the segment (shm_open + mmap, read-only). This header deliberately
+ * has no Qt dependency so external readers can include it on its own.
+ *
+ * Segment = SegmentHeader followed by slotCapacity SubsystemSlots. Each
+ * slot, and the system block in the header, is protected by a seqlock:
+ * the writer makes the sequence odd, updates the record in place and
+ * makes it even again. Readers copy the record and retry if the sequence
+ * was odd or changed meanwhile (readSlot/readSystem below), so reading
+ * needs no syscalls and never blocks the writer.
+ *
+ * Times are CLOCK_MONOTONIC nanoseconds (RadarRMP::Timestamp), comparable
+ * across processes on the same host. A reader should check magic and
+ * versionMajor, and size its view from headerSize/slotSize rather than
+ * sizeof, so minor versions can append fields.
+ */
+
+constexpr uint32_t MAGIC = 0x53504D52;      // "RMPS" little-endian
+constexpr uint16_t VERSION_MAJOR = 1;
+constexpr uint16_t VERSION_MINOR = 0;
+
+constexpr int ID_LENGTH = 32;
+constexpr int NAME_LENGTH = 48;
+constexpr int CODE_LENGTH = 16;
+constexpr int MAX_PARAMETERS = 48;
+constexpr int MAX_FAULT_CODES = 64;         // ActiveFaultSet::MAX_INDEXED_CODES
+
+// HealthState values
+enum State : int32_t {
+    StateOk = 0,
+    StateDegraded = 1,
+    StateFail = 2,
+    StateUnknown = 3
+};
+
+// SubsystemRecord::flags
+enum SlotFlag : uint32_t {
+    SlotInUse    = 0x1,     // Slot describes a registered subsystem
+    SlotEnabled  = 0x2,
+    SlotOnCanvas = 0x4
+};
+
+/**
+ * @brief System-wide aggregate, as shown in the UI header
+ */
+struct SystemRecord {
+    int32_t state;
+    uint32_t subsystemCount;
+    uint32_t healthyCount;
+    uint32_t degradedCount;
+    uint32_t failedCount;
+    uint32_t activeFaultCount;
+    double score;
+    int64_t updatedNs;
+};
+
+/**
+ * @brief One subsystem's state
+ *
+ * Names are written when the slot is assigned. The fault-code table is
+ * appended to in the same seqlock write that first sets a faultMask bit
+ * for a newly registered code. The dynamic fields are written on every
+ * publication.
+ *
+ * faultMask bit i is set while faultCodes[i] is active; faults outside
+ * the table only count towards activeFaultCount. values[i] belongs to
+ * parameterNames[i] and is NaN for non-numeric or not yet received
+ * parameters.
+ */
+struct SubsystemRecord {
+    uint32_t flags;
+    int32_t state;
+    double score;
+    uint64_t epoch;                 // RadarSubsystem::healthEpoch()
+    int64_t updatedNs;
+    uint64_t faultMask;
+    uint32_t activeFaultCount;
+    uint32_t parameterCount;
+    char id[ID_LENGTH];
+    char name[NAME_LENGTH];
+    char type[NAME_LENGTH];
+    char faultCodes[MAX_FAULT_CODES][CODE_LENGTH];
+    char parameterNames[MAX_PARAMETERS][ID_LENGTH];
+    double values[MAX_PARAMETERS];
+};
+
+struct SubsystemSlot {
+    std::atomic<uint64_t> sequence;
+    SubsystemRecord record;
+};
+
+struct SegmentHeader {
+    uint32_t magic;                 // Stored last on creation
+    uint16_t versionMajor;
+    uint16_t versionMinor;
+    uint32_t headerSize;
+    uint32_t slotSize;
+    uint32_t slotCapacity;
+    uint32_t reserved;
+    int64_t writerPid;              // Live writer owns the name
+    std::atomic<uint32_t> slotHighWater;    // Slots [0, slotHighWater) may be in use
+    std::atomic<uint32_t> reserved2;
+    std::atomic<uint64_t> heartbeat;        // Bumped on every publication
+    std::atomic<uint64_t> sequence;         // Seqlock for system
+    SystemRecord system;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "seqlock counters must be address-free in shared memory");
+
+inline SubsystemSlot* slotAt(void* segment, uint32_t index)
+{
+    auto* header = static_cast<SegmentHeader*>(segment);
+    return reinterpret_cast<SubsystemSlot*>(static_cast<char*>(segment) + header->headerSize
+                                            + static_cast<size_t>(index) * header->slotSize);
+}
+
+inline const SubsystemSlot* slotAt(const void* segment, uint32_t index)
+{
+    return slotAt(const_cast<void*>(segment), index);
+}
+
+inline size_t segmentSize(uint32_t slotCapacity)
+{
+    return sizeof(SegmentHeader) + static_cast<size_t>(slotCapacity) * sizeof(SubsystemSlot);
+}
+
+// ----------------------------------------------------------------------------
+// Seqlock helpers
+// ----------------------------------------------------------------------------
+
+inline void beginWrite(std::atomic<uint64_t>& sequence)
+{
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+inline void endWrite(std::atomic<uint64_t>& sequence)
+{
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+template <typename Record>
+inline bool readConsistent(const std::atomic<uint64_t>& sequence, const Record& source,
+                           Record* out, int maxAttempts)
+{
+    for (int attempt = 0; attempt < maxAttempts; ++attempt) {
+        const uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;   // Writer in progress
+        }
+        std::memcpy(out, &source, sizeof(Record));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Consistent copy of one subsystem slot
+ * @return False if the writer kept it busy for maxAttempts tries
+ */
+inline bool readSlot(const SubsystemSlot* slot, SubsystemRecord* out, int maxAttempts = 64)
+{
+    return readConsistent(slot->sequence, slot->record, out, maxAttempts);
+}
+
+inline bool readSystem(const SegmentHeader* header, SystemRecord* out, int maxAttempts = 64)
+{
+    return readConsistent(header->sequence, header->system, out, maxAttempts);
+}
+
+} // namespace SharedState
+} // namespace RadarRMP
+
+#endif // SHAREDSTATELAYOUT_H
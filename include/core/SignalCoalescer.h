@@ -0,0 +1,179 @@
+#ifndef SIGNALCOALESCER_H
+#define SIGNALCOALESCER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+#include <QSet>
+#include <QPointer>
+#include <functional>
+
+#ifndef RMP_HEADLESS
+class QQuickWindow;
+#endif
+
+namespace RadarRMP {
+
+class RadarSubsystem;
+
+/**
+ * @brief Shared frame clock that coalesces subsystem notifications
+ *
+ * Subsystems no longer own debounce timers. Instead they mark themselves
+ * dirty here with the set of signals they owe (healthChanged,
+ * telemetryChanged, faultsChanged) and whether a health recompute is
+ * pending. Once per frame the coalescer walks the dirty queue and lets
+ * each subsystem emit its pending signals exactly once.
+ *
+ * The cost per frame is one timer event plus one pass over the subsystems
+ * that actually changed, independent of how many subsystems exist. When
+ * nothing is dirty the timer is not running at all.
+ *
+ * Other C++ components publishing to QML (manager aggregates, fault and
+ * analytics summaries, fleet views) schedule() a publish callback instead
+ * of emitting per event; callbacks run once per frame after the subsystem
+ * pass, so QML re-evaluates bindings at most once per frame.
+ *
+ * With a window attached the frame is the window's own: dirty state asks
+ * for an update and is flushed from afterAnimating, in step with vsync,
+ * with a backstop timer at backstopFrameInterval in case the window stops
+ * rendering. While the window is hidden or minimized, or without a window
+ * (headless), a timer stands in - at frameInterval, or hiddenFrameInterval
+ * when the window exists but is not visible. Headless builds (RMP_HEADLESS)
+ * have no window support and always run on the timer.
+ *
+ * Window visibility only throttles what QML sees. Work that is not for
+ * QML - pending health recomputes, and listeners of workFlushed() such as
+ * the shared-memory export - runs on its own clock at frameInterval, and
+ * every frame runs it first.
+ *
+ * Must be created and used on the GUI thread.
+ */
+class SignalCoalescer : public QObject {
+    Q_OBJECT
+    Q_MOC_INCLUDE("core/RadarSubsystem.h")
+    Q_PROPERTY(int frameInterval READ getFrameInterval WRITE setFrameInterval NOTIFY frameIntervalChanged)
+
+public:
+    /**
+     * @brief Pending work a subsystem can register for the next frame
+     */
+    enum PendingSignal {
+        NoSignal          = 0x0,
+        HealthSignal      = 0x1,    // emit healthChanged()
+        TelemetrySignal   = 0x2,    // emit telemetryChanged()
+        FaultsSignal      = 0x4,    // emit faultsChanged()
+        HealthRecompute   = 0x8     // run processHealthData() before emitting
+    };
+    Q_DECLARE_FLAGS(PendingSignals, PendingSignal)
+
+    static constexpr int DEFAULT_FRAME_INTERVAL_MS = 50;
+    static constexpr int DEFAULT_HIDDEN_FRAME_INTERVAL_MS = 1000;
+    static constexpr int DEFAULT_BACKSTOP_FRAME_INTERVAL_MS = 250;
+
+    /**
+     * @brief Process-wide coalescer, created on first use
+     */
+    static SignalCoalescer* instance();
+
+    explicit SignalCoalescer(QObject* parent = nullptr);
+    ~SignalCoalescer() override;
+
+    // Frame configuration
+    int getFrameInterval() const;
+    void setFrameInterval(int msec);
+
+    int getHiddenFrameInterval() const { return m_hiddenInterval; }
+    void setHiddenFrameInterval(int msec);
+
+    int getBackstopFrameInterval() const { return m_backstopInterval; }
+    void setBackstopFrameInterval(int msec);
+
+#ifndef RMP_HEADLESS
+    /**
+     * @brief Drive frames from a window's render cycle instead of the timer
+     */
+    void attachToWindow(QQuickWindow* window);
+    void detachWindow();
+#endif
+    bool isFrameSynced() const;
+
+    // Dirty queues - called by RadarSubsystem only
+    void enqueue(RadarSubsystem* subsystem);
+    void enqueueWork(RadarSubsystem* subsystem);
+    void cancel(RadarSubsystem* subsystem);
+
+    /**
+     * @brief Run publish once during the next frame
+     *
+     * One pending callback per context; further calls before the frame
+     * are no-ops. Skipped if context is destroyed first.
+     */
+    void schedule(QObject* context, std::function<void()> publish);
+    void unschedule(QObject* context);
+
+    int pendingCount() const;
+
+public slots:
+    /**
+     * @brief Emit all pending notifications now
+     */
+    void flush();
+
+    /**
+     * @brief Run pending recomputes now, without notifying QML
+     */
+    void flushWork();
+
+signals:
+    void frameIntervalChanged();
+    void frameFlushed(int subsystemCount);
+
+    /**
+     * @brief Subsystems whose pending work just ran
+     *
+     * Their health snapshots are current; their QML signals may still be
+     * waiting for the next frame.
+     */
+    void workFlushed(const QVector<RadarRMP::RadarSubsystem*>& subsystems);
+
+#ifndef RMP_HEADLESS
+private slots:
+    void onWindowVisibilityChanged();
+#endif
+
+private:
+    struct Task {
+        QPointer<QObject> context;
+        QObject* key;
+        std::function<void()> publish;
+    };
+
+    void requestFrame();
+
+    QTimer* m_frameTimer;
+    QTimer* m_workTimer;
+    int m_interval;
+    int m_hiddenInterval;
+    int m_backstopInterval;
+#ifndef RMP_HEADLESS
+    QPointer<QQuickWindow> m_window;
+    bool m_updateRequested;
+#endif
+
+    QVector<RadarSubsystem*> m_queue;
+    QVector<RadarSubsystem*> m_deferred;   // Marked dirty while flushing
+    QVector<RadarSubsystem*> m_work;       // Recompute or snapshot pending
+
+    QVector<Task> m_tasks;
+    QVector<Task> m_deferredTasks;         // Rescheduled after running this frame
+    QSet<QObject*> m_scheduled;
+    QSet<QObject*> m_ranThisFrame;
+    bool m_flushing;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(SignalCoalescer::PendingSignals)
+
+} // namespace RadarRMP
+
+#endif // SIGNALCOALESCER_H
@@ -0,0 +1,102 @@
+#ifndef STATESERVER_H
+#define STATESERVER_H
+
+#include <QObject>
+#include <QHash>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QVariantMap>
+
+class QTcpServer;
+class QTcpSocket;
+
+namespace RadarRMP {
+
+class SubsystemManager;
+class HealthAnalytics;
+
+/**
+ * @brief Serves live system state as JSON over HTTP to remote viewers
+ *
+ * The display-less nodes run without QML, so this is how their state
+ * leaves the box. Each request is a plain HTTP/1.1 GET answered with one
+ * JSON document and the connection closed:
+ *
+ * - /state            system summary, every subsystem and process info
+ * - /subsystems/<id>  one subsystem (the getSubsystemById() map)
+ * - /faults           active faults and recent history
+ * - /analytics        fault statistics and subsystem ranking
+ * - /process          startup time and resident memory
+ *
+ * Subsystem maps come from SubsystemManager's per-epoch cache, so polling
+ * an unchanged system does not rebuild them.
+ *
+ * There is no authentication: listen() binds to the loopback interface
+ * unless given another address. A connection still open
+ * CONNECTION_TIMEOUT_MS after it was accepted is aborted, and beyond
+ * MAX_CONNECTIONS open sockets new ones are refused.
+ *
+ * Must be created and used on the GUI (main) thread.
+ */
+class StateServer : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr quint16 DEFAULT_PORT = 8470;
+    static constexpr int MAX_REQUEST_BYTES = 8192;
+    static constexpr int CONNECTION_TIMEOUT_MS = 5000;
+    static constexpr int MAX_CONNECTIONS = 32;
+
+    StateServer(SubsystemManager* manager, HealthAnalytics* analytics,
+                QObject* parent = nullptr);
+    ~StateServer() override;
+
+    bool listen(const QHostAddress& address = QHostAddress::LocalHost, quint16 port = DEFAULT_PORT);
+    void close();
+
+    bool isListening() const;
+    quint16 serverPort() const;
+    QString getErrorString() const { return m_error; }
+
+    /**
+     * @brief Time from process start until the node was ready, for /process
+     */
+    void setStartupTime(qint64 msec) { m_startupMs = msec; }
+    qint64 getStartupTime() const { return m_startupMs; }
+
+    QVariantMap processInfo() const;
+
+    /**
+     * @brief Current and peak resident set size in kB; -1 where unknown
+     */
+    static qint64 residentMemoryKb();
+    static qint64 peakResidentMemoryKb();
+
+private slots:
+    void onNewConnection();
+
+private:
+    void onReadyRead(QTcpSocket* socket);
+    void respond(QTcpSocket* socket, int status, const QByteArray& body);
+    bool route(const QString& path, QVariant& document) const;
+
+    QVariantMap stateDocument() const;
+    QVariantMap faultsDocument() const;
+    QVariantMap analyticsDocument() const;
+
+    SubsystemManager* m_manager;
+    HealthAnalytics* m_analytics;
+
+    QTcpServer* m_server;
+    QHash<QTcpSocket*, QByteArray> m_requests;  // Partial request headers
+    int m_connectionCount;                      // Open sockets, answered or not
+    QString m_error;
+
+    QElapsedTimer m_uptime;
+    qint64 m_startupMs;
+};
+
+} // namespace RadarRMP
+
+#endif // STATESERVER_H
@@ -0,0 +1,106 @@
+#ifndef SUBSYSTEMINDEX_H
+#define SUBSYSTEMINDEX_H
+
+#include <QHash>
+#include <QSet>
+#include <QList>
+#include <QVector>
+#include <QString>
+#include <QStringList>
+#include <QVariantMap>
+#include "HealthStatus.h"
+
+namespace RadarRMP {
+
+class RadarSubsystem;
+
+/**
+ * @brief Secondary indices over registered subsystems
+ *
+ * Buckets subsystems by SubsystemType, current HealthState and free-form
+ * tags (site, rack, radar...). SubsystemManager keeps it current on
+ * registration, state transitions and tag edits, so lookups like "all
+ * failed transmitters in rack B" cost the size of the smallest matching
+ * bucket instead of a scan over every subsystem.
+ *
+ * The byType/byState/byTag sets are live views: they reflect later
+ * changes and stay valid as long as the index does, but must not be held
+ * across a modification while iterating.
+ *
+ * Not thread-safe; owned and used on the GUI thread.
+ */
+class SubsystemIndex {
+public:
+    using Set = QSet<RadarSubsystem*>;
+
+    /**
+     * @brief Conjunctive query; unset fields match everything
+     */
+    struct Filter {
+        int type = -1;              // SubsystemType, or -1
+        int state = -1;             // HealthState, or -1
+        QStringList tags;           // All must be present
+    };
+
+    /**
+     * @brief Build a filter from a QML map {type, state, tag, tags}
+     *
+     * type is a display name as returned by getTypeName(), state one of
+     * "OK"/"DEGRADED"/"FAIL"/"UNKNOWN". Unknown values match nothing.
+     */
+    Filter filterFromVariantMap(const QVariantMap& map) const;
+
+    SubsystemIndex();
+
+    void insert(RadarSubsystem* subsystem, SubsystemType type, const QString& typeName,
+                HealthState state);
+    void remove(RadarSubsystem* subsystem);
+    bool contains(RadarSubsystem* subsystem) const { return m_entries.contains(subsystem); }
+
+    /**
+     * @brief Move a subsystem between state buckets
+     * @return False if the state was already current
+     */
+    bool updateState(RadarSubsystem* subsystem, HealthState state);
+
+    bool addTag(RadarSubsystem* subsystem, const QString& tag);
+    bool removeTag(RadarSubsystem* subsystem, const QString& tag);
+    QStringList tags(RadarSubsystem* subsystem) const;
+    QStringList allTags() const { return m_byTag.keys(); }
+
+    // Live views
+    const Set& byType(SubsystemType type) const;
+    const Set& byState(HealthState state) const;
+    const Set& byTag(const QString& tag) const;
+
+    // Type lookup by display name (RadarSubsystem::getTypeName)
+    int typeForName(const QString& typeName) const { return m_typeByName.value(typeName, -1); }
+
+    QList<RadarSubsystem*> query(const Filter& filter) const;
+    int count(const Filter& filter) const;
+
+private:
+    struct Entry {
+        SubsystemType type;
+        HealthState state;
+        QStringList tags;
+    };
+
+    static constexpr int TYPE_COUNT = static_cast<int>(SubsystemType::NetworkInterface) + 1;
+    static constexpr int STATE_COUNT = static_cast<int>(HealthState::UNKNOWN) + 1;
+
+    const Set* smallestCandidateSet(const Filter& filter) const;
+    bool matches(const Entry& entry, const Filter& filter) const;
+
+    QHash<RadarSubsystem*, Entry> m_entries;
+    QVector<Set> m_byType;
+    QVector<Set> m_byState;
+    QHash<QString, Set> m_byTag;
+    QHash<QString, int> m_typeByName;
+    Set m_all;
+    Set m_empty;
+};
+
+} // namespace RadarRMP
+
+#endif // SUBSYSTEMINDEX_H
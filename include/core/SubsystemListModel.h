@@ -4,6 +4,7 @@
 #include <QAbstractListModel>
 #include <QHash>
 #include <QSet>
+#include <QVector>
 #include "RadarSubsystem.h"
 
 namespace RadarRMP {
@@ -13,6 +14,15 @@ namespace RadarRMP {
  * 
  * This model provides incremental updates to QML instead of
  * recreating the entire list on every change.
+ * 
+ * Subsystem notifications only mark (row, roles) dirty; flushChanges(),
+ * driven by SubsystemManager's per-frame update, emits one dataChanged
+ * per contiguous run of rows with the same dirty roles. Delegates thus
+ * re-read only the roles that actually changed.
+ * 
+ * Role values are pre-rendered into a per-row cache when the subsystem
+ * publishes a change, so data() is an array read that never takes a
+ * subsystem lock, converts a state to text or looks up the canvas set.
  */
 class SubsystemListModel : public QAbstractListModel {
     Q_OBJECT
@@ -30,6 +40,7 @@ public:
         EnabledRole,
         OnCanvasRole
     };
+    static constexpr int ROLE_COUNT = OnCanvasRole - IdRole + 1;
     
     explicit SubsystemListModel(QObject* parent = nullptr);
     
@@ -53,15 +64,53 @@ public:
     void setOnCanvas(const QString& id, bool onCanvas);
     bool isOnCanvas(const QString& id) const;
     
+    // Cached role value for a row (no subsystem access)
+    QVariant cachedData(int row, int role) const;
+    
+    // Dirty tracking
+    void markDirty(int row, const QVector<int>& roles);
+    bool hasPendingChanges() const { return !m_dirtyRows.isEmpty(); }
+    
 public slots:
-    void onSubsystemDataChanged();
+    /**
+     * @brief Emit the accumulated dataChanged ranges and clear the dirty set
+     */
+    void flushChanges();
+    
     void refreshSubsystem(const QString& id);
     void refreshAll();
     
+signals:
+    // First row marked dirty since the last flush
+    void changesPending();
+    
+private slots:
+    void onSubsystemHealthChanged();
+    void onSubsystemFaultsChanged();
+    void onSubsystemEnabledChanged();
+    
 private:
+    static quint32 roleBit(int role) { return quint32(1) << (role - IdRole); }
+    static QVector<int> rolesFromMask(quint32 mask);
+    void markRowDirty(int row, quint32 roleMask);
+    int senderRow(RadarSubsystem** subsystem) const;
+    
+    // Role cache refreshers; each reads the subsystem once
+    struct RowCache {
+        QVariant values[ROLE_COUNT];
+    };
+    void cacheStatic(RowCache& cache, RadarSubsystem* sub) const;
+    void cacheHealth(RowCache& cache, RadarSubsystem* sub) const;
+    void setCached(int row, int role, const QVariant& value);
+    
     QList<RadarSubsystem*> m_subsystems;
     QHash<QString, int> m_indexMap;
     QSet<QString> m_onCanvasIds;
+    QVector<RowCache> m_cache;
+    
+    // Per-row dirty role bits (bit = role - IdRole) and the rows set
+    QVector<quint32> m_dirtyMask;
+    QVector<int> m_dirtyRows;
 };
 
 /**
@@ -95,15 +144,21 @@ public:
     int count() const { return m_activeIds.size(); }
     
 public slots:
-    void onSourceDataChanged();
+    // Forwards only the affected active rows and the roles this model has
+    void onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                             const QVector<int>& roles);
     void refreshSubsystem(const QString& id);
     
 signals:
     void countChanged();
     
 private:
+    static int mapSourceRole(int sourceRole);
+    void emitRuns(QVector<int> rows, const QVector<int>& roles);
+    
     SubsystemListModel* m_sourceModel = nullptr;
     QList<QString> m_activeIds;
+    QHash<QString, int> m_activeIndex;      // Id -> row in m_activeIds
 };
 
 } // namespace RadarRMP
@@ -4,13 +4,32 @@
 #include <QObject>
 #include <QMap>
 #include <QList>
-#include <QTimer>
+#include <QPointer>
+#include <QHash>
+#include <QSet>
 #include "RadarSubsystem.h"
 #include "FaultManager.h"
 #include "SubsystemListModel.h"
+#include "SelfTestRunner.h"
+#include "SharedStateExporter.h"
+#include "SubsystemIndex.h"
+#include "HealthRollup.h"
+#include "TelemetryListModel.h"
+
+class QThreadPool;
 
 namespace RadarRMP {
 
+/**
+ * @brief One subsystem's share of an acquisition cycle
+ */
+struct SubsystemUpdate {
+    QString subsystemId;
+    QVariantMap data;
+};
+
+using SubsystemUpdateBatch = QList<SubsystemUpdate>;
+
 /**
  * @brief Central manager for all radar subsystems
  * 
@@ -20,9 +39,17 @@ namespace RadarRMP {
  * 
  * ARCHITECTURE NOTES:
  * - Uses QAbstractListModel for efficient QML binding (no QVariantList recreation)
- * - Employs signal throttling to prevent UI overload
+ * - Aggregate and model updates publish once per frame via SignalCoalescer
  * - Does NOT run its own update timer (HealthSimulator drives updates)
  * - Batches health computations to reduce redundant calculations
+ * - Aggregate counts and score sum maintained incrementally from state
+ *   transitions and canvas changes, so a system health update is O(1)
+ * - applyBatch() ingests a whole acquisition cycle with one aggregate
+ *   recompute and one model pass
+ * - Type, state and tag lookups go through a SubsystemIndex instead of
+ *   scanning every subsystem
+ * - Site/radar/cabinet health is rolled up by HealthRollup from the same
+ *   per-subsystem contributions, along the changed leaf's ancestor path
  */
 class SubsystemManager : public QObject {
     Q_OBJECT
@@ -40,6 +67,8 @@ class SubsystemManager : public QObject {
     Q_PROPERTY(int degradedSubsystemCount READ getDegradedSubsystemCount NOTIFY systemHealthChanged)
     Q_PROPERTY(int failedSubsystemCount READ getFailedSubsystemCount NOTIFY systemHealthChanged)
     Q_PROPERTY(FaultManager* faultManager READ getFaultManager CONSTANT)
+    Q_PROPERTY(SelfTestOperation* systemSelfTest READ getSystemSelfTest NOTIFY systemSelfTestChanged)
+    Q_PROPERTY(HealthRollup* healthRollup READ getHealthRollup CONSTANT)
     
 public:
     explicit SubsystemManager(QObject* parent = nullptr);
@@ -51,6 +80,21 @@ public:
     RadarSubsystem* getSubsystem(const QString& id) const;
     QList<RadarSubsystem*> getAllSubsystems() const;
     QList<RadarSubsystem*> getSubsystemsByType(SubsystemType type) const;
+    QList<RadarSubsystem*> getSubsystemsByState(HealthState state) const;
+    QList<RadarSubsystem*> getSubsystemsByTag(const QString& tag) const;
+    QList<RadarSubsystem*> findSubsystems(const SubsystemIndex::Filter& filter) const;
+    const SubsystemIndex& getIndex() const { return m_index; }
+    
+    // Hierarchical rollup; nodes are configured on the HealthRollup itself
+    HealthRollup* getHealthRollup() const { return m_rollup; }
+    Q_INVOKABLE bool placeInHierarchy(const QString& subsystemId, const QString& nodeId,
+                                      double weight = 1.0);
+    
+    // Free-form grouping labels (site, radar, rack...) used by the index
+    Q_INVOKABLE bool tagSubsystem(const QString& subsystemId, const QString& tag);
+    Q_INVOKABLE bool untagSubsystem(const QString& subsystemId, const QString& tag);
+    Q_INVOKABLE QStringList getSubsystemTags(const QString& subsystemId) const;
+    Q_INVOKABLE QStringList getAllTags() const;
     
     // Model access
     SubsystemListModel* getSubsystemModel() const { return m_subsystemModel; }
@@ -68,9 +112,25 @@ public:
     QVariantMap getSystemHealthSummary() const;
     
     // QML helpers - these now use cached data
+    
+    /**
+     * @brief Detail map for one subsystem
+     *
+     * Built from the subsystem's shared health snapshot and cached until
+     * its health epoch moves, so repeated binding evaluations between
+     * changes return the same implicitly shared map.
+     */
     Q_INVOKABLE QVariant getSubsystemById(const QString& id) const;
     Q_INVOKABLE QVariantList getSubsystemsByTypeVariant(const QString& typeName) const;
     
+    /**
+     * @brief Indexed lookup for QML
+     * @param filter Any of {type, state, tag, tags}; all given criteria must match
+     * @return Maps {id, name, type, healthState}, ordered by id
+     */
+    Q_INVOKABLE QVariantList findSubsystemsVariant(const QVariantMap& filter) const;
+    Q_INVOKABLE int countSubsystems(const QVariantMap& filter) const;
+    
     // Counts (use cached values)
     int getTotalSubsystemCount() const;
     int getActiveSubsystemCount() const;
@@ -81,7 +141,72 @@ public:
     // Fault manager access
     FaultManager* getFaultManager() const;
     
-    // Update control - now primarily for throttle interval
+    // Built-in test - runs concurrently on SelfTestRunner's pool. The
+    // manager keeps the latest operation per scope (system, or one per
+    // subsystem) and releases it when the next run of that scope starts.
+    Q_INVOKABLE SelfTestOperation* runSystemSelfTest(int timeoutMs = SelfTestRunner::DEFAULT_TIMEOUT_MS);
+    Q_INVOKABLE SelfTestOperation* runSubsystemSelfTest(const QString& subsystemId,
+                                                        int timeoutMs = SelfTestRunner::DEFAULT_TIMEOUT_MS);
+    SelfTestOperation* getSystemSelfTest() const { return m_systemSelfTest; }
+    SelfTestRunner* getSelfTestRunner() const { return m_selfTestRunner; }
+    
+    // Short-term telemetry history, applied to current and future subsystems
+    void setTelemetryHistoryCapacity(int samples);
+    int getTelemetryHistoryCapacity() const { return m_telemetryHistoryCapacity; }
+    Q_INVOKABLE QVariantList getTelemetryHistory(const QString& subsystemId, const QString& paramName,
+                                                 int maxSamples = 0) const;
+    
+    /**
+     * @brief Per-parameter telemetry model, created on first use
+     *
+     * Owned by the manager and shared by all views of the subsystem;
+     * null for unknown ids.
+     */
+    Q_INVOKABLE TelemetryListModel* getTelemetryModel(const QString& subsystemId);
+    
+    /**
+     * @brief Apply one acquisition cycle's worth of updates
+     *
+     * Each subsystem's updateData() runs once (repeated ids are merged,
+     * latest value wins), then their notifications are flushed and the
+     * aggregate health is recomputed once; listeners get a single
+     * batchApplied() instead of one subsystemHealthChanged() per subsystem.
+     *
+     * Serially, all of that happens before the call returns. With parallel
+     * the updates run on a worker pool and the call returns at once; the
+     * aggregate and batchApplied() follow on the GUI thread when the last
+     * worker finishes.
+     *
+     * Ingest API for acquisition front ends and scripts; nothing in this
+     * tree calls it (the simulator feeds subsystems directly).
+     *
+     * GUI thread only.
+     * @return Number of subsystems updated or dispatched
+     */
+    int applyBatch(const SubsystemUpdateBatch& updates, bool parallel = false);
+    
+    // QML/JSON variant: subsystem id -> data map
+    Q_INVOKABLE int applyBatch(const QVariantMap& updates, bool parallel = false);
+    
+    /**
+     * @brief Publish live state to a POSIX shared-memory segment
+     *
+     * Off by default. Registered subsystems get a slot each and the system
+     * aggregate is written after every SignalCoalescer work pass and
+     * whenever the subsystem set or the active faults change, whether or
+     * not the window is visible; see SharedStateLayout.h for the reader side.
+     * Fails if another live process already exports under that name.
+     */
+    bool enableSharedStateExport(const QString& segmentName = QString::fromLatin1(SharedStateExporter::DEFAULT_SEGMENT_NAME),
+                                 int capacity = SharedStateExporter::DEFAULT_CAPACITY);
+    void disableSharedStateExport();
+    SharedStateExporter* getSharedStateExporter() const { return m_sharedStateExporter; }
+    
+    int getBatchConcurrency() const;
+    void setBatchConcurrency(int threads);
+    
+    // Frame interval of the shared SignalCoalescer clock when no window
+    // drives it
     void setUpdateInterval(int msec);
     int getUpdateInterval() const;
     
@@ -99,26 +224,62 @@ signals:
     void systemHealthChanged();
     void subsystemHealthChanged(const QString& subsystemId);
     void subsystemFaultOccurred(const QString& subsystemId, const QString& faultCode);
+    void systemSelfTestChanged();
+    void systemSelfTestFinished(bool passed);
+    void batchApplied(const QStringList& subsystemIds);
+    void subsystemTagsChanged(const QString& subsystemId);
     
 private slots:
     void onSubsystemHealthChanged();
     void onSubsystemFaultOccurred(const QString& faultCode, const QString& description);
-    void onThrottledUpdate();
+    void onFrameUpdate();
     
 private:
     void connectSubsystemSignals(RadarSubsystem* subsystem);
     void computeSystemHealth();
-    void updateCachedCounts();
+    void evaluateSystemHealth(HealthState* state, double* score) const;
+    
+    // Incremental aggregate maintenance
+    struct Contribution {
+        HealthState state = HealthState::UNKNOWN;
+        double score = 0.0;
+        bool enabled = false;
+        bool onCanvas = false;
+    };
+    void applyContribution(const Contribution& contribution, int sign);
+    void setContribution(RadarSubsystem* subsystem, const Contribution& contribution);
+    void refreshContribution(RadarSubsystem* subsystem);
+    void setContributionOnCanvas(RadarSubsystem* subsystem, bool onCanvas);
+    void publishSharedSystemState();
+    void finishBatch(const QList<RadarSubsystem*>& targets, bool pooled);
     
     // Subsystem storage
     QMap<QString, RadarSubsystem*> m_subsystems;
     
+    // Secondary indices; state buckets follow refreshContribution()
+    SubsystemIndex m_index;
+    
+    // Site/radar/cabinet aggregation, fed from setContribution()
+    HealthRollup* m_rollup;
+    
     // Models for QML
     SubsystemListModel* m_subsystemModel;
     ActiveSubsystemModel* m_activeModel;
+    QHash<RadarSubsystem*, TelemetryListModel*> m_telemetryModels;
+    
+    // getSubsystemById() results, valid while the epoch matches
+    struct DetailCache {
+        quint64 epoch = 0;
+        QVariant value;
+    };
+    mutable QHash<RadarSubsystem*, DetailCache> m_detailCache;
     
     FaultManager* m_faultManager;
     
+    SelfTestRunner* m_selfTestRunner;
+    QPointer<SelfTestOperation> m_systemSelfTest;
+    QHash<QString, QPointer<SelfTestOperation>> m_subsystemSelfTests;  // Latest per subsystem id
+    
     // Cached health state (avoid recomputation on every access)
     HealthState m_systemHealthState;
     double m_systemHealthScore;
@@ -126,10 +287,32 @@ private:
     int m_cachedDegradedCount;
     int m_cachedFailedCount;
     
-    // Throttling mechanism - batch updates instead of immediate
-    QTimer* m_throttleTimer;
-    int m_updateInterval;
+    // Live aggregate over on-canvas subsystems; published into the cached
+    // values above by computeSystemHealth()
+    QHash<RadarSubsystem*, Contribution> m_contributions;
+    int m_healthyCount;
+    int m_degradedCount;
+    int m_failedCount;
+    int m_enabledCount;
+    double m_scoreSum;
+    
+    // Set while a publish is scheduled on the coalescer frame
     bool m_healthUpdatePending;
+    
+    int m_telemetryHistoryCapacity;
+    
+    // applyBatch() workers and the epoch each subsystem was reported at, so
+    // the queued per-subsystem healthChanged it already covered is dropped
+    QThreadPool* m_batchPool;
+    QHash<RadarSubsystem*, quint64> m_batchEpochs;
+    
+    // Parallel batches still running per subsystem, and subsystems
+    // unregistered meanwhile whose deletion waits for their worker
+    QHash<RadarSubsystem*, int> m_batchInFlight;
+    QSet<RadarSubsystem*> m_batchDeferredDeletes;
+    
+    // Null unless enableSharedStateExport() succeeded
+    SharedStateExporter* m_sharedStateExporter;
 };
 
 } // namespace RadarRMP
@@ -6,6 +6,12 @@
 #include <QVariant>
 #include <QVariantMap>
 #include <QDateTime>
+#include <QHash>
+#include <QVector>
+#include <QReadWriteLock>
+#include <memory>
+#include "RingBuffer.h"
+#include "Timestamp.h"
 
 namespace RadarRMP {
 
@@ -52,8 +58,197 @@ struct TelemetryParameter {
     }
 };
 
+/**
+ * @brief Static parameter metadata, stored once per subsystem type
+ *
+ * The compact form of a TelemetryParameter's descriptive fields: limits are
+ * plain doubles with a presence bit each instead of QVariants.
+ */
+struct TelemetryParameterInfo {
+    enum Limit : quint8 {
+        Nominal      = 0x01,
+        Min          = 0x02,
+        Max          = 0x04,
+        WarningLow   = 0x08,
+        WarningHigh  = 0x10,
+        CriticalLow  = 0x20,
+        CriticalHigh = 0x40
+    };
+    
+    QString name;
+    QString displayName;
+    QString unit;
+    double nominal = 0.0;
+    double minValue = 0.0;
+    double maxValue = 0.0;
+    double warningLow = 0.0;
+    double warningHigh = 0.0;
+    double criticalLow = 0.0;
+    double criticalHigh = 0.0;
+    quint8 limits = 0;      // Limit flags present
+    
+    bool has(Limit limit) const { return (limits & limit) != 0; }
+    
+    /**
+     * @brief The one limit comparison for zones, health rules and FleetStore
+     *
+     * A value at the limit itself has crossed it unless inclusive is false.
+     * NaN values and NaN ("no limit") limits never cross.
+     */
+    static bool belowLimit(double value, double limit, bool inclusive = true) {
+        return inclusive ? value <= limit : value < limit;
+    }
+    static bool aboveLimit(double value, double limit, bool inclusive = true) {
+        return inclusive ? value >= limit : value > limit;
+    }
+    double limitValue(Limit limit) const;
+    double limitOr(Limit limit, double fallback) const {
+        return has(limit) ? limitValue(limit) : fallback;
+    }
+    QVariant limitVariant(Limit limit) const {
+        return has(limit) ? QVariant(limitValue(limit)) : QVariant();
+    }
+    
+    static TelemetryParameterInfo fromParameter(const TelemetryParameter& param);
+    bool operator==(const TelemetryParameterInfo& other) const;
+    bool operator!=(const TelemetryParameterInfo& other) const { return !(*this == other); }
+};
+
+class TelemetrySchema;
+using TelemetrySchemaPtr = std::shared_ptr<const TelemetrySchema>;
+
+/**
+ * @brief Parameter metadata table shared by all subsystems of one type
+ *
+ * A schema is immutable once published: instances read it under their own
+ * lock only, from any thread, so nothing may change it in place. Growing
+ * or diverging copies it (copy-on-write) instead.
+ *
+ * TelemetryData instances registering the same parameters in the same
+ * order share one schema. The registry keeps the longest table for each
+ * key; extend() returns it when it already holds the requested entry, and
+ * otherwise publishes a longer copy. An instance only sees the first
+ * parameterCount() entries, so a shorter instance can share a longer
+ * table. An instance that diverges (different limits, a removed or
+ * reordered parameter) moves to a private copy.
+ */
+class TelemetrySchema {
+public:
+    QVector<TelemetryParameterInfo> parameters;
+    QHash<QString, int> indices;            // Name -> index
+    
+    int indexOf(const QString& name) const { return indices.value(name, -1); }
+    
+    /**
+     * @brief Mutable copy of the first count entries, for building a new schema
+     */
+    std::shared_ptr<TelemetrySchema> copyPrefix(int count) const;
+    void append(const TelemetryParameterInfo& info);
+    void rebuildIndices();
+    
+    /**
+     * @brief Registry lookup; creates an empty schema for a new key
+     */
+    static TelemetrySchemaPtr shared(const QString& key);
+    
+    /**
+     * @brief Schema for key whose first count entries are base's followed by info
+     */
+    static TelemetrySchemaPtr extend(const QString& key, const TelemetrySchemaPtr& base,
+                                     int count, const TelemetryParameterInfo& info);
+};
+
+/**
+ * @brief One point of a parameter's short-term history
+ */
+struct TelemetrySample {
+    Timestamp timestamp;
+    double value = 0.0;
+};
+
+using TelemetryHistorySpan = RingBuffer<TelemetrySample>::Span;
+
+/**
+ * @brief One parameter's change within a TelemetryChangeSet
+ *
+ * Values are doubles (bools as 0/1, non-numeric as NaN); read the
+ * parameter itself for string values.
+ */
+struct TelemetryChange {
+    enum Zone : quint8 {
+        Normal = 0,
+        WarningLow,
+        WarningHigh,
+        CriticalLow,
+        CriticalHigh
+    };
+    
+    int index;              // TelemetryData::indexOf(name)
+    double oldValue;
+    double newValue;
+    quint8 oldZone;
+    quint8 newZone;
+    
+    bool crossedThreshold() const { return oldZone != newZone; }
+    bool isAlarm() const { return newZone != Normal; }
+};
+
+/**
+ * @brief All parameter changes from one TelemetryData update
+ */
+struct TelemetryChangeSet {
+    Timestamp timestamp;
+    QVector<TelemetryChange> changes;
+    
+    bool isEmpty() const { return changes.isEmpty(); }
+    int size() const { return changes.size(); }
+    
+    int crossingCount() const {
+        int count = 0;
+        for (const TelemetryChange& change : changes) {
+            count += change.crossedThreshold() ? 1 : 0;
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief Point-in-time copy of a TelemetryData's values
+ *
+ * Shares the schema and the implicitly shared columns, so taking one is
+ * cheap; it stays valid after the source is modified or destroyed and
+ * may be read on any thread.
+ */
+struct TelemetrySnapshot {
+    TelemetrySchemaPtr schema;
+    QVector<QVariant> values;   // Indexed like schema->parameters
+    QVector<quint8> valid;
+};
+
 /**
  * @brief Container for telemetry data with validation and thresholds
+ *
+ * Parameters get a stable index in registration order. Bulk updates via
+ * setValues() publish a single TelemetryChangeSet (valuesChanged) listing
+ * only the parameters whose value changed, so listeners process deltas
+ * instead of re-reading the whole map.
+ *
+ * Storage is split: names, units and limits live in a TelemetrySchema
+ * shared per subsystem type (useSharedSchema), while each instance keeps
+ * only value, timestamp and validity columns indexed like the schema.
+ * TelemetryParameter remains the registration type; getParameter()
+ * assembles one on demand and is not meant for hot paths.
+ *
+ * Optionally (setHistoryCapacity, off by default) each numeric parameter
+ * also keeps a fixed-size ring of its recent changes, readable in place
+ * via history(). The GUI turns it on for its trend view; headless nodes
+ * leave it off unless started with --history.
+ *
+ * Thread safety: values may be written from one worker thread while other
+ * threads read; accessors take an internal read/write lock and signals are
+ * emitted after it is released, on the writing thread. The zero-copy
+ * history() spans and infoAt() references are the exception - use them
+ * on the writing thread, or historySamples() elsewhere.
  */
 class TelemetryData : public QObject {
     Q_OBJECT
@@ -65,26 +260,51 @@ public:
     ~TelemetryData() override = default;
     
     // Parameter management
+    void useSharedSchema(const QString& key);
     void addParameter(const TelemetryParameter& param);
     void removeParameter(const QString& name);
     bool hasParameter(const QString& name) const;
     TelemetryParameter getParameter(const QString& name) const;
     QStringList getParameterNames() const;
     
+    // Metadata without assembling a TelemetryParameter; an unknown name
+    // gives an info without limits
+    TelemetryParameterInfo parameterInfo(const QString& name) const;
+    const TelemetryParameterInfo& infoAt(int index) const;
+    QVariantMap getParameterMetadata(const QString& name) const;
+    
+    // Stable per-parameter indices (registration order)
+    int indexOf(const QString& name) const;
+    QString nameAt(int index) const;
+    int parameterCount() const;
+    
     // Value access
     QVariant getValue(const QString& name) const;
     void setValue(const QString& name, const QVariant& value);
     void setValues(const QVariantMap& values);
     
+    // Short-term history; 0 samples (the default) disables recording
+    void setHistoryCapacity(int samples);
+    int historyCapacity() const { return m_historyCapacity; }
+    TelemetryHistorySpan history(int index) const;
+    TelemetryHistorySpan history(const QString& name) const;
+    QVector<TelemetrySample> historySamples(const QString& name, int maxSamples = 0) const;
+    
     // Threshold checking
     bool isWithinLimits(const QString& name) const;
     bool isWarning(const QString& name) const;
     bool isCritical(const QString& name) const;
     
+    // Classification behind TelemetryChange values and zones
+    static double numericValue(const QVariant& value);
+    static quint8 thresholdZone(const TelemetryParameterInfo& info, double value);
+    
     // Bulk access
     QVariantMap getData() const;
     QVariantMap getMetadata() const;
-    QDateTime getLastUpdate() const;
+    TelemetrySnapshot snapshot() const;
+    QDateTime getLastUpdate() const;       // Wall clock, for QML
+    Timestamp lastUpdate() const;
     
     // Validation
     void validate();
@@ -96,12 +316,32 @@ signals:
     void parameterChanged(const QString& name, const QVariant& value);
     void thresholdExceeded(const QString& name, const QString& type);
     void validityChanged(const QString& name, bool valid);
+    void valuesChanged(const RadarRMP::TelemetryChangeSet& changes);
     
 private:
-    QMap<QString, TelemetryParameter> m_parameters;
-    QDateTime m_lastUpdate;
+    int findIndex(const QString& name) const;
+    std::shared_ptr<TelemetrySchema> detachSchema();
+    void recordSample(int index, Timestamp timestamp, double value);
+    QVariantMap metadataAt(int index) const;
+    
+    mutable QReadWriteLock m_lock;
+    TelemetrySchemaPtr m_schema;
+    QString m_schemaKey;                    // Empty once diverged from the registry
+    
+    // Hot per-instance columns, indexed like m_schema->parameters
+    QVector<QVariant> m_values;
+    QVector<Timestamp> m_timestamps;
+    QVector<quint8> m_valid;
+    
+    // Empty unless history is enabled; otherwise one ring per parameter
+    QVector<RingBuffer<TelemetrySample>> m_history;
+    int m_historyCapacity;
+    
+    Timestamp m_lastUpdate;
 };
 
 } // namespace RadarRMP
 
+Q_DECLARE_METATYPE(RadarRMP::TelemetryChangeSet)
+
 #endif // TELEMETRYDATA_H
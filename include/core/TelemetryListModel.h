@@ -0,0 +1,90 @@
+#ifndef TELEMETRYLISTMODEL_H
+#define TELEMETRYLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QPointer>
+#include <QVector>
+#include "RadarSubsystem.h"
+
+namespace RadarRMP {
+
+/**
+ * @brief One row per telemetry parameter of a single subsystem
+ *
+ * Rows follow the parameter index (registration order), so the index in
+ * a TelemetryChange is the row. Names, units and limits are read once
+ * when the model is (re)loaded; telemetryValuesChanged only marks rows
+ * dirty, and the flush on the next frame re-reads those values and emits
+ * dataChanged for them with the value roles only. Delegates therefore
+ * stay alive across updates and only the changed parameters repaint.
+ *
+ * Created by SubsystemManager::getTelemetryModel(). GUI thread only.
+ */
+class TelemetryListModel : public QAbstractListModel {
+    Q_OBJECT
+    Q_PROPERTY(QString subsystemId READ getSubsystemId CONSTANT)
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    enum Roles {
+        NameRole = Qt::UserRole + 1,
+        DisplayNameRole,
+        UnitRole,
+        ValueRole,
+        IsNumericRole,
+        NominalRole,
+        MinValueRole,
+        MaxValueRole,
+        WarningLowRole,
+        WarningHighRole,
+        CriticalLowRole,
+        CriticalHighRole,
+        AlarmStateRole,
+        RatioRole
+    };
+
+    explicit TelemetryListModel(RadarSubsystem* subsystem, QObject* parent = nullptr);
+
+    // QAbstractListModel interface
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    QString getSubsystemId() const { return m_subsystemId; }
+
+    /**
+     * @brief Rebuild all rows, e.g. after parameters were added or removed
+     */
+    Q_INVOKABLE void reload();
+
+signals:
+    void countChanged();
+
+private slots:
+    void onValuesChanged(const RadarRMP::TelemetryChangeSet& changes);
+
+private:
+    struct Row {
+        TelemetryParameterInfo info;
+        QVariant value;
+        quint8 zone = TelemetryChange::Normal;
+    };
+
+    void loadRow(Row& row, const QString& name) const;
+    void markDirty(int row);
+    void flushChanges();
+    static QString alarmStateString(quint8 zone);
+    static double ratio(const Row& row);
+
+    QPointer<RadarSubsystem> m_subsystem;
+    QString m_subsystemId;
+    QVector<Row> m_rows;
+
+    // Rows changed since the last flush
+    QVector<quint8> m_dirty;
+    QVector<int> m_dirtyRows;
+};
+
+} // namespace RadarRMP
+
+#endif // TELEMETRYLISTMODEL_H
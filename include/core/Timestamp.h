@@ -0,0 +1,103 @@
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#include <QDateTime>
+#include <QMetaType>
+#include <chrono>
+
+namespace RadarRMP {
+
+/**
+ * @brief Monotonic nanosecond timestamp
+ *
+ * A plain 64-bit count of nanoseconds on the steady clock. Taking one is a
+ * single clock read with no timezone work, durations are integer
+ * subtraction, and ordering survives NTP steps and manual clock changes.
+ *
+ * Conversion to wall-clock time happens only at presentation/export
+ * boundaries (toDateTime(), toMSecsSinceEpoch()), against an anchor pair
+ * of steady and system clock readings taken once per process. A default
+ * constructed Timestamp is invalid.
+ */
+class Timestamp {
+public:
+    constexpr Timestamp() = default;
+
+    static Timestamp now()
+    {
+        return Timestamp(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static constexpr Timestamp fromNanoseconds(qint64 ns) { return Timestamp(ns); }
+
+    /**
+     * @brief Map a wall-clock time onto the monotonic scale (import only)
+     */
+    static Timestamp fromDateTime(const QDateTime& dateTime)
+    {
+        if (!dateTime.isValid()) {
+            return Timestamp();
+        }
+        const Anchor& a = anchor();
+        return Timestamp(a.steadyNs + (dateTime.toMSecsSinceEpoch() - a.wallMs) * NS_PER_MS);
+    }
+
+    constexpr bool isValid() const { return m_ns != 0; }
+    constexpr qint64 nanoseconds() const { return m_ns; }
+
+    // Durations
+    constexpr qint64 nsecsTo(Timestamp other) const { return other.m_ns - m_ns; }
+    constexpr qint64 msecsTo(Timestamp other) const { return (other.m_ns - m_ns) / NS_PER_MS; }
+    constexpr double secsTo(Timestamp other) const { return (other.m_ns - m_ns) / 1e9; }
+    qint64 elapsedMs() const { return msecsTo(now()); }
+
+    constexpr Timestamp addMSecs(qint64 ms) const { return Timestamp(m_ns + ms * NS_PER_MS); }
+    constexpr Timestamp addSecs(qint64 s) const { return Timestamp(m_ns + s * NS_PER_MS * 1000); }
+
+    // Wall clock - presentation and export only
+    qint64 toMSecsSinceEpoch() const
+    {
+        if (!isValid()) {
+            return 0;
+        }
+        const Anchor& a = anchor();
+        return a.wallMs + (m_ns - a.steadyNs) / NS_PER_MS;
+    }
+
+    QDateTime toDateTime() const
+    {
+        return isValid() ? QDateTime::fromMSecsSinceEpoch(toMSecsSinceEpoch()) : QDateTime();
+    }
+
+    constexpr bool operator==(Timestamp other) const { return m_ns == other.m_ns; }
+    constexpr bool operator!=(Timestamp other) const { return m_ns != other.m_ns; }
+    constexpr bool operator<(Timestamp other) const { return m_ns < other.m_ns; }
+    constexpr bool operator<=(Timestamp other) const { return m_ns <= other.m_ns; }
+    constexpr bool operator>(Timestamp other) const { return m_ns > other.m_ns; }
+    constexpr bool operator>=(Timestamp other) const { return m_ns >= other.m_ns; }
+
+private:
+    static constexpr qint64 NS_PER_MS = 1000000;
+
+    struct Anchor {
+        qint64 steadyNs;
+        qint64 wallMs;
+    };
+
+    static const Anchor& anchor()
+    {
+        static const Anchor s_anchor = { now().m_ns, QDateTime::currentMSecsSinceEpoch() };
+        return s_anchor;
+    }
+
+    constexpr explicit Timestamp(qint64 ns) : m_ns(ns) {}
+
+    qint64 m_ns = 0;
+};
+
+} // namespace RadarRMP
+
+Q_DECLARE_METATYPE(RadarRMP::Timestamp)
+
+#endif // TIMESTAMP_H
@@ -53,18 +53,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double CURRENT_WARNING = 8.0;       // Amps
-    static constexpr double CURRENT_CRITICAL = 12.0;
-    static constexpr double MOTOR_TEMP_WARNING = 65.0;   // Celsius
-    static constexpr double MOTOR_TEMP_CRITICAL = 85.0;
-    static constexpr double POSITION_ERROR_WARNING = 0.5; // Degrees
-    static constexpr double POSITION_ERROR_CRITICAL = 1.0;
 };
 
 } // namespace RadarRMP
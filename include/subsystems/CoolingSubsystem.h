@@ -53,20 +53,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double COOLANT_TEMP_WARNING = 45.0;     // Celsius
-    static constexpr double COOLANT_TEMP_CRITICAL = 55.0;
-    static constexpr double FLOW_WARNING_LOW = 70.0;         // % of nominal
-    static constexpr double FLOW_CRITICAL_LOW = 50.0;
-    static constexpr double AMBIENT_WARNING = 40.0;
-    static constexpr double AMBIENT_CRITICAL = 50.0;
-    static constexpr double EFFICIENCY_WARNING = 70.0;       // Percentage
-    static constexpr double EFFICIENCY_CRITICAL = 50.0;
 };
 
 } // namespace RadarRMP
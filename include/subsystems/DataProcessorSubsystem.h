@@ -50,20 +50,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double CPU_WARNING = 75.0;
-    static constexpr double CPU_CRITICAL = 90.0;
-    static constexpr double MEMORY_WARNING = 70.0;
-    static constexpr double MEMORY_CRITICAL = 85.0;
-    static constexpr double TRACK_CAPACITY_WARNING = 80.0;  // % of max
-    static constexpr double TRACK_CAPACITY_CRITICAL = 95.0;
-    static constexpr double LATENCY_WARNING = 100.0;        // ms
-    static constexpr double LATENCY_CRITICAL = 500.0;
 };
 
 } // namespace RadarRMP
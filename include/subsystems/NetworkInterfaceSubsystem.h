@@ -54,18 +54,10 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
+    void initializeHealthRules() override;
     HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
     QString computeStatusMessage() const override;
     void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double PACKET_LOSS_WARNING = 0.1;       // Percentage
-    static constexpr double PACKET_LOSS_CRITICAL = 1.0;
-    static constexpr double LATENCY_WARNING = 50.0;          // ms
-    static constexpr double LATENCY_CRITICAL = 200.0;
-    static constexpr double UTILIZATION_WARNING = 80.0;      // Percentage
-    static constexpr double UTILIZATION_CRITICAL = 95.0;
 };
 
 } // namespace RadarRMP
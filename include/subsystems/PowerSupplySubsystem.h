@@ -56,20 +56,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double INPUT_VOLTAGE_LOW_WARNING = 200.0;
-    static constexpr double INPUT_VOLTAGE_LOW_CRITICAL = 180.0;
-    static constexpr double INPUT_VOLTAGE_HIGH_WARNING = 250.0;
-    static constexpr double INPUT_VOLTAGE_HIGH_CRITICAL = 270.0;
-    static constexpr double BATTERY_WARNING = 30.0;          // Percentage
-    static constexpr double BATTERY_CRITICAL = 10.0;
-    static constexpr double TEMP_WARNING = 50.0;
-    static constexpr double TEMP_CRITICAL = 65.0;
 };
 
 } // namespace RadarRMP
@@ -50,16 +50,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double PHASE_LOCK_WARNING = 0.8;
-    static constexpr double PHASE_LOCK_CRITICAL = 0.5;
-    static constexpr double TEMP_WARNING = 55.0;
-    static constexpr double TEMP_CRITICAL = 70.0;
 };
 
 } // namespace RadarRMP
@@ -51,18 +51,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double NOISE_FIGURE_WARNING = 4.0;    // dB
-    static constexpr double NOISE_FIGURE_CRITICAL = 6.0;
-    static constexpr double GAIN_WARNING_LOW = 25.0;       // dB
-    static constexpr double GAIN_CRITICAL_LOW = 20.0;
-    static constexpr double TEMP_WARNING = 55.0;
-    static constexpr double TEMP_CRITICAL = 70.0;
 };
 
 } // namespace RadarRMP
@@ -51,20 +51,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr double CPU_WARNING = 80.0;          // Percentage
-    static constexpr double CPU_CRITICAL = 95.0;
-    static constexpr double MEMORY_WARNING = 75.0;
-    static constexpr double MEMORY_CRITICAL = 90.0;
-    static constexpr double LATENCY_WARNING = 10.0;      // ms
-    static constexpr double LATENCY_CRITICAL = 50.0;
-    static constexpr double TEMP_WARNING = 70.0;
-    static constexpr double TEMP_CRITICAL = 85.0;
 };
 
 } // namespace RadarRMP
@@ -54,20 +54,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    static constexpr int SATELLITE_WARNING = 6;
-    static constexpr int SATELLITE_CRITICAL = 4;
-    static constexpr double ACCURACY_WARNING = 100.0;        // ns
-    static constexpr double ACCURACY_CRITICAL = 1000.0;
-    static constexpr double STABILITY_WARNING = 10.0;        // ppb
-    static constexpr double STABILITY_CRITICAL = 100.0;
-    static constexpr double TEMP_WARNING = 50.0;
-    static constexpr double TEMP_CRITICAL = 60.0;
 };
 
 } // namespace RadarRMP
@@ -56,21 +56,8 @@ public:
     
 protected:
     void initializeTelemetryParameters() override;
-    HealthState computeHealthState() const override;
-    double computeHealthScore() const override;
+    void initializeHealthRules() override;
     QString computeStatusMessage() const override;
-    void onDataUpdate(const QVariantMap& data) override;
-    
-private:
-    // Threshold values
-    static constexpr double RF_POWER_WARNING_LOW = 80.0;   // % of nominal
-    static constexpr double RF_POWER_CRITICAL_LOW = 50.0;
-    static constexpr double VSWR_WARNING = 1.5;
-    static constexpr double VSWR_CRITICAL = 2.0;
-    static constexpr double TEMP_WARNING = 60.0;           // Celsius
-    static constexpr double TEMP_CRITICAL = 80.0;
-    static constexpr double HV_WARNING_LOW = 90.0;         // % of nominal
-    static constexpr double HV_CRITICAL_LOW = 80.0;
 };
 
 } // namespace RadarRMP
@@ -5,12 +5,18 @@ import "../styles"
 
 /**
  * Displays list of active faults for a subsystem
+ *
+ * Bound to a FaultListModel; faults arrive and leave as row inserts and
+ * removals, so existing delegates persist.
  */
 Rectangle {
     id: faultList
     
-    property var faults: []
+    property var faultModel: null
+    readonly property int faultCount: faultModel ? faultModel.count : 0
     property bool showClearButton: true
+    property string title: "ACTIVE FAULTS"
+    property string emptyText: "No active faults"
     
     signal faultClicked(string faultCode)
     signal clearFault(string faultCode)
@@ -28,7 +34,7 @@ Rectangle {
             Layout.fillWidth: true
             
             Text {
-                text: "ACTIVE FAULTS"
+                text: faultList.title
                 font.family: RadarTheme.fontFamily
                 font.pixelSize: RadarTheme.fontSizeXSmall
                 font.weight: Font.Bold
@@ -42,11 +48,11 @@ Rectangle {
                 width: 24
                 height: 18
                 radius: 9
-                color: faults.length > 0 ? RadarColors.healthFail : RadarColors.textTertiary
+                color: faultCount > 0 ? RadarColors.healthFail : RadarColors.textTertiary
                 
                 Text {
                     anchors.centerIn: parent
-                    text: faults.length
+                    text: faultCount
                     font.family: RadarTheme.fontFamilyMono
                     font.pixelSize: RadarTheme.fontSizeXSmall
                     font.bold: true
@@ -61,27 +67,27 @@ Rectangle {
             Layout.fillWidth: true
             Layout.fillHeight: true
             
-            model: faults
+            model: faultList.faultModel
             spacing: RadarTheme.spacingSmall
             clip: true
             
             delegate: FaultItem {
                 width: faultListView.width
-                fault: modelData
+                fault: model
                 showClear: showClearButton
                 
-                onClearClicked: faultList.clearFault(modelData.code)
-                onItemClicked: faultList.faultClicked(modelData.code)
+                onClearClicked: faultList.clearFault(model.code)
+                onItemClicked: faultList.faultClicked(model.code)
             }
             
             // Empty state
             Text {
                 anchors.centerIn: parent
-                text: "No active faults"
+                text: faultList.emptyText
                 font.family: RadarTheme.fontFamily
                 font.pixelSize: RadarTheme.fontSizeSmall
                 color: RadarColors.textTertiary
-                visible: faults.length === 0
+                visible: faultCount === 0
             }
         }
     }
@@ -4,17 +4,16 @@ import "../styles"
 
 /**
  * Displays telemetry parameters with value bars
+ *
+ * Bound to a TelemetryListModel (SubsystemManager.getTelemetryModel), which
+ * updates only the value roles of changed parameters; delegates persist.
  */
 Item {
     id: display
     
-    property var telemetryData: null
-    property var metadata: null
+    property var telemetryModel: null
     property int maxItems: 8
     
-    // Cache the keys to avoid regenerating the model constantly
-    property var telemetryKeys: telemetryData ? Object.keys(telemetryData).slice(0, maxItems) : []
-    
     implicitHeight: telemetryColumn.implicitHeight
     
     ColumnLayout {
@@ -23,13 +22,17 @@ Item {
         spacing: RadarTheme.spacingSmall
         
         Repeater {
-            model: display.telemetryKeys
+            model: display.telemetryModel
             
             TelemetryItem {
                 Layout.fillWidth: true
-                paramName: modelData
-                paramValue: display.telemetryData ? display.telemetryData[modelData] : null
-                paramMetadata: (display.metadata && display.metadata[modelData]) ? display.metadata[modelData] : null
+                visible: index < display.maxItems
+                paramName: model.name
+                paramValue: model.value
+                paramUnit: model.unit
+                numeric: model.isNumeric
+                valueRatio: model.ratio
+                alarmState: model.alarmState
             }
         }
     }
@@ -39,7 +42,10 @@ Item {
         
         property string paramName
         property var paramValue
-        property var paramMetadata
+        property string paramUnit
+        property bool numeric: false
+        property real valueRatio: 0
+        property string alarmState: "normal"
         
         height: 44
         radius: RadarTheme.radiusSmall
@@ -67,10 +73,10 @@ Item {
                 height: 6
                 radius: 3
                 color: RadarColors.background
-                visible: isNumeric(paramValue)
+                visible: numeric
                 
                 Rectangle {
-                    width: parent.width * getValueRatio()
+                    width: parent.width * valueRatio
                     height: parent.height
                     radius: 3
                     color: getValueColor()
@@ -94,7 +100,7 @@ Item {
             // Unit
             Text {
                 Layout.preferredWidth: 40
-                text: (paramMetadata && paramMetadata.unit) ? paramMetadata.unit : ""
+                text: paramUnit
                 font.family: RadarTheme.fontFamily
                 font.pixelSize: RadarTheme.fontSizeXSmall
                 color: RadarColors.textTertiary
@@ -121,43 +127,16 @@ Item {
             return String(value)
         }
         
-        function isNumeric(value) {
-            return typeof value === 'number' && !isNaN(value)
-        }
-        
-        function getValueRatio() {
-            if (!isNumeric(paramValue)) return 0
-            
-            var min = (paramMetadata && paramMetadata.minValue !== undefined) ? paramMetadata.minValue : 0
-            var max = (paramMetadata && paramMetadata.maxValue !== undefined) ? paramMetadata.maxValue : 100
-            
-            if (max === min) return 0.5
-            return Math.max(0, Math.min(1, (paramValue - min) / (max - min)))
-        }
-        
         function getValueColor() {
-            if (!isNumeric(paramValue)) {
+            if (!numeric) {
                 return RadarColors.textPrimary
             }
-            
-            if (!paramMetadata) {
-                return RadarColors.telemetryPrimary
-            }
-            
-            // Check against thresholds
-            if (paramMetadata.criticalHigh !== undefined && paramValue >= paramMetadata.criticalHigh) {
-                return RadarColors.healthFail
-            }
-            if (paramMetadata.criticalLow !== undefined && paramValue <= paramMetadata.criticalLow) {
+            if (alarmState === "critical") {
                 return RadarColors.healthFail
             }
-            if (paramMetadata.warningHigh !== undefined && paramValue >= paramMetadata.warningHigh) {
+            if (alarmState === "warning") {
                 return RadarColors.healthDegraded
             }
-            if (paramMetadata.warningLow !== undefined && paramValue <= paramMetadata.warningLow) {
-                return RadarColors.healthDegraded
-            }
-            
             return RadarColors.telemetryPrimary
         }
     }
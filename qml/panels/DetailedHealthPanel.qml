@@ -366,7 +366,7 @@ Rectangle {
         TelemetryDisplay {
             anchors.fill: parent
             anchors.margins: RadarTheme.spacingMedium
-            telemetryData: (subsystem && subsystem.telemetry) ? subsystem.telemetry : null
+            telemetryModel: subsystem ? subsystemManager.getTelemetryModel(subsystem.id) : null
             maxItems: 20
         }
     }
@@ -379,43 +379,150 @@ Rectangle {
         FaultList {
             anchors.fill: parent
             anchors.margins: RadarTheme.spacingMedium
-            faults: (subsystem && subsystem.faults) ? subsystem.faults : []
+            faultModel: subsystem ? subsystemManager.faultManager.getSubsystemFaultModel(subsystem.id) : null
         }
     }
     
-    // Trends tab component (placeholder)
+    // Trends tab component - sparklines from the per-parameter history rings
     component TrendsTab: Rectangle {
+        id: trendsTab
         property var subsystem
-        color: "transparent"
+        property int maxSamples: 120
         
-        Column {
-            anchors.centerIn: parent
-            spacing: RadarTheme.spacingMedium
-            
-            Text {
-                text: "📈"
-                font.pixelSize: 48
-                anchors.horizontalCenter: parent.horizontalCenter
-                opacity: 0.5
+        // Bumped once a second while visible; each sparkline repaints on change
+        property int refreshTick: 0
+        
+        property var numericKeys: {
+            if (!subsystem || !subsystem.telemetry) {
+                return []
             }
-            
-            Text {
-                text: "Trend Analysis"
-                font.family: RadarTheme.fontFamily
-                font.pixelSize: RadarTheme.fontSizeLarge
-                color: RadarColors.textTertiary
-                anchors.horizontalCenter: parent.horizontalCenter
+            var keys = []
+            for (var key in subsystem.telemetry) {
+                if (typeof subsystem.telemetry[key] === "number") {
+                    keys.push(key)
+                }
             }
+            return keys
+        }
+        
+        color: "transparent"
+        
+        Timer {
+            interval: 1000
+            repeat: true
+            running: trendsTab.visible && trendsTab.subsystem !== null
+            onTriggered: trendsTab.refreshTick++
+        }
+        
+        ListView {
+            anchors.fill: parent
+            anchors.margins: RadarTheme.spacingMedium
+            spacing: RadarTheme.spacingSmall
+            clip: true
+            model: trendsTab.numericKeys
             
-            Text {
-                text: "Historical data visualization\ncoming in future release"
-                font.family: RadarTheme.fontFamily
-                font.pixelSize: RadarTheme.fontSizeSmall
-                color: RadarColors.textTertiary
-                horizontalAlignment: Text.AlignHCenter
-                anchors.horizontalCenter: parent.horizontalCenter
+            delegate: Rectangle {
+                id: trendRow
+                width: ListView.view.width
+                height: 56
+                radius: RadarTheme.radiusSmall
+                color: RadarColors.backgroundDark
+                
+                property var points: []
+                
+                function reload() {
+                    points = trendsTab.subsystem
+                        ? subsystemManager.getTelemetryHistory(trendsTab.subsystem.id, modelData, trendsTab.maxSamples)
+                        : []
+                    sparkline.requestPaint()
+                }
+                
+                Component.onCompleted: reload()
+                
+                Connections {
+                    target: trendsTab
+                    function onRefreshTickChanged() { trendRow.reload() }
+                }
+                
+                RowLayout {
+                    anchors.fill: parent
+                    anchors.leftMargin: RadarTheme.spacingMedium
+                    anchors.rightMargin: RadarTheme.spacingMedium
+                    spacing: RadarTheme.spacingMedium
+                    
+                    Text {
+                        Layout.preferredWidth: 110
+                        text: modelData
+                        font.family: RadarTheme.fontFamily
+                        font.pixelSize: RadarTheme.fontSizeSmall
+                        color: RadarColors.textSecondary
+                        elide: Text.ElideRight
+                    }
+                    
+                    Canvas {
+                        id: sparkline
+                        Layout.fillWidth: true
+                        Layout.fillHeight: true
+                        Layout.topMargin: 8
+                        Layout.bottomMargin: 8
+                        renderTarget: Canvas.Image
+                        
+                        onPaint: {
+                            var ctx = getContext("2d")
+                            ctx.reset()
+                            
+                            var pts = trendRow.points
+                            if (!pts || pts.length < 2) {
+                                return
+                            }
+                            
+                            var minX = pts[0].x, maxX = pts[pts.length - 1].x
+                            var minY = pts[0].y, maxY = pts[0].y
+                            for (var i = 1; i < pts.length; i++) {
+                                minY = Math.min(minY, pts[i].y)
+                                maxY = Math.max(maxY, pts[i].y)
+                            }
+                            var spanX = Math.max(1, maxX - minX)
+                            var spanY = Math.max(1e-9, maxY - minY)
+                            
+                            ctx.strokeStyle = RadarColors.accent
+                            ctx.lineWidth = 1.5
+                            ctx.beginPath()
+                            for (var j = 0; j < pts.length; j++) {
+                                var px = (pts[j].x - minX) / spanX * width
+                                var py = height - (pts[j].y - minY) / spanY * height
+                                if (j === 0) {
+                                    ctx.moveTo(px, py)
+                                } else {
+                                    ctx.lineTo(px, py)
+                                }
+                            }
+                            ctx.stroke()
+                        }
+                    }
+                    
+                    Text {
+                        Layout.preferredWidth: 70
+                        horizontalAlignment: Text.AlignRight
+                        text: trendRow.points.length > 0
+                              ? trendRow.points[trendRow.points.length - 1].y.toFixed(2)
+                              : "-"
+                        font.family: RadarTheme.fontFamilyMono
+                        font.pixelSize: RadarTheme.fontSizeSmall
+                        color: RadarColors.textPrimary
+                    }
+                }
             }
         }
+        
+        Text {
+            anchors.centerIn: parent
+            visible: trendsTab.numericKeys.length === 0
+            text: "No numeric telemetry"
+            font.family: RadarTheme.fontFamily
+            font.pixelSize: RadarTheme.fontSizeSmall
+            color: RadarColors.textTertiary
+        }
     }
     
     // Stat card component
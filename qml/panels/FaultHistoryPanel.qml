@@ -55,17 +55,15 @@ Rectangle {
             }
         }
         
-        // Fault list
+        // Fault history, newest first; older entries page in on scroll
         FaultList {
             Layout.fillWidth: true
             Layout.fillHeight: true
             Layout.margins: RadarTheme.spacingMedium
-            faults: subsystemManager.faultManager.activeFaults
-            showClearButton: true
-            
-            onClearFault: function(faultCode) {
-                // Would need to find subsystem and clear fault
-            }
+            faultModel: subsystemManager.faultManager.faultHistoryModel
+            title: "RECENT FAULTS"
+            emptyText: "No faults recorded"
+            showClearButton: false
         }
     }
 }
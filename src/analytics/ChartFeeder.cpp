@@ -0,0 +1,161 @@
+#include "analytics/ChartFeeder.h"
+#include "analytics/HealthAnalytics.h"
+#include "analytics/TrendAnalyzer.h"
+#include "core/SubsystemManager.h"
+#include "core/RadarSubsystem.h"
+#include "core/SignalCoalescer.h"
+#include <cmath>
+
+namespace RadarRMP {
+
+ChartFeeder::ChartFeeder(SubsystemManager* manager, HealthAnalytics* analytics,
+                         TrendAnalyzer* trendAnalyzer, QObject* parent)
+    : QObject(parent)
+    , m_manager(manager)
+    , m_analytics(analytics)
+    , m_trendAnalyzer(trendAnalyzer)
+{
+}
+
+int ChartFeeder::feedHealthScoreTrend(QObject* series, int hours)
+{
+    return m_analytics ? replace(series, m_analytics->chartHealthScoreTrend(hours)) : -1;
+}
+
+int ChartFeeder::feedTemperatureTrend(QObject* series, int hours)
+{
+    return m_analytics ? replace(series, m_analytics->chartTemperatureTrend(hours)) : -1;
+}
+
+int ChartFeeder::feedFaultRateTrend(QObject* series, int hours)
+{
+    return m_analytics ? replace(series, m_analytics->chartFaultRateTrend(hours)) : -1;
+}
+
+int ChartFeeder::feedTrendData(QObject* series, const QString& subsystemId,
+                               const QString& parameter, int maxPoints)
+{
+    return m_trendAnalyzer
+        ? replace(series, m_trendAnalyzer->chartDataPoints(subsystemId, parameter, maxPoints)) : -1;
+}
+
+int ChartFeeder::feedTrendLine(QObject* series, const QString& subsystemId,
+                               const QString& parameter, int points)
+{
+    return m_trendAnalyzer
+        ? replace(series, m_trendAnalyzer->chartTrendLine(subsystemId, parameter, points)) : -1;
+}
+
+int ChartFeeder::feedTelemetryHistory(QObject* series, const QString& subsystemId,
+                                      const QString& parameter, int maxSamples)
+{
+    RadarSubsystem* subsystem = m_manager ? m_manager->getSubsystem(subsystemId) : nullptr;
+    if (!subsystem) {
+        return -1;
+    }
+    return replace(series, subsystem->telemetryHistoryPoints(parameter, maxSamples));
+}
+
+bool ChartFeeder::attachTelemetry(QObject* series, const QString& subsystemId,
+                                  const QString& parameter, int maxPoints)
+{
+    auto* xySeries = qobject_cast<QXYSeries*>(series);
+    RadarSubsystem* subsystem = m_manager ? m_manager->getSubsystem(subsystemId) : nullptr;
+    if (!xySeries || !subsystem) {
+        return false;
+    }
+
+    // TelemetryChange indices follow registration order
+    const int parameterIndex = subsystem->getTelemetryParameters().indexOf(parameter);
+    if (parameterIndex < 0) {
+        return false;
+    }
+
+    detach(xySeries);
+    xySeries->replace(subsystem->telemetryHistoryPoints(parameter, maxPoints));
+
+    LiveFeed& feed = m_feeds[xySeries];
+    feed.series = xySeries;
+    feed.parameterIndex = parameterIndex;
+    feed.maxPoints = qMax(0, maxPoints);
+
+    // Context object this: queued onto the GUI thread when ingest runs on a worker
+    feed.valuesConnection = connect(subsystem, &RadarSubsystem::telemetryValuesChanged, this,
+                                    [this, xySeries](const TelemetryChangeSet& changes) {
+                                        onValuesChanged(xySeries, changes);
+                                    });
+    feed.destroyedConnection = connect(xySeries, &QObject::destroyed, this, [this, xySeries]() {
+        detach(xySeries);
+    });
+    return true;
+}
+
+void ChartFeeder::detach(QObject* series)
+{
+    // Only used as a key; the series may already be mid-destruction
+    auto it = m_feeds.find(series);
+    if (it == m_feeds.end()) {
+        return;
+    }
+
+    disconnect(it->valuesConnection);
+    disconnect(it->destroyedConnection);
+    m_feeds.erase(it);
+}
+
+int ChartFeeder::replace(QObject* target, const QList<QPointF>& points)
+{
+    auto* series = qobject_cast<QXYSeries*>(target);
+    if (!series) {
+        return -1;
+    }
+
+    // One pointsReplaced() and one redraw for the whole set
+    series->replace(points);
+    return points.size();
+}
+
+void ChartFeeder::onValuesChanged(QObject* key, const TelemetryChangeSet& changes)
+{
+    auto it = m_feeds.find(key);
+    if (it == m_feeds.end()) {
+        return;
+    }
+
+    for (const TelemetryChange& change : changes.changes) {
+        if (change.index != it->parameterIndex || std::isnan(change.newValue)) {
+            continue;
+        }
+
+        it->pending.append(QPointF(static_cast<double>(changes.timestamp.toMSecsSinceEpoch()),
+                                   change.newValue));
+        if (it->maxPoints > 0 && it->pending.size() > it->maxPoints) {
+            it->pending.removeFirst();
+        }
+
+        SignalCoalescer::instance()->schedule(this, [this]() {
+            flushFeeds();
+        });
+    }
+}
+
+void ChartFeeder::flushFeeds()
+{
+    for (auto it = m_feeds.begin(); it != m_feeds.end(); ++it) {
+        LiveFeed& feed = it.value();
+        if (feed.pending.isEmpty() || !feed.series) {
+            continue;
+        }
+
+        // Batch append, then drop the oldest points in one removal
+        feed.series->append(feed.pending);
+        feed.pending.clear();
+
+        const int excess = feed.maxPoints > 0 ? feed.series->count() - feed.maxPoints : 0;
+        if (excess > 0) {
+            feed.series->removePoints(0, excess);
+        }
+    }
+}
+
+} // namespace RadarRMP
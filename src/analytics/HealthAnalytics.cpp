@@ -1,10 +1,31 @@
 #include "analytics/HealthAnalytics.h"
 #include "core/SubsystemManager.h"
 #include "core/RadarSubsystem.h"
+#include "core/SignalCoalescer.h"
+#include "analytics/TrendAnalyzer.h"
 #include <QTimer>
 
 namespace RadarRMP {
 
+namespace {
+
+// Mean of each time bucket; x is the bucket start in msecs since epoch
+QList<QPointF> averagePerBucket(const QMap<qint64, QList<double>>& buckets, int bucketSecs)
+{
+    QList<QPointF> trend;
+    trend.reserve(buckets.size());
+    for (auto it = buckets.begin(); it != buckets.end(); ++it) {
+        double sum = 0;
+        for (double value : it.value()) {
+            sum += value;
+        }
+        trend.append(QPointF(it.key() * bucketSecs * 1000.0, sum / it.value().size()));
+    }
+    return trend;
+}
+
+} // namespace
+
 HealthAnalytics::HealthAnalytics(SubsystemManager* manager, QObject* parent)
     : QObject(parent)
     , m_manager(manager)
@@ -255,8 +276,21 @@ QVariantMap HealthAnalytics::getSubsystemRanking() const
 
 QVariantList HealthAnalytics::getHealthScoreTrend(int hours) const
 {
-    QVariantList trend;
-    
+    return TrendAnalyzer::toVariantList(chartHealthScoreTrend(hours));
+}
+
+QVariantList HealthAnalytics::getTemperatureTrend(int hours) const
+{
+    return TrendAnalyzer::toVariantList(chartTemperatureTrend(hours));
+}
+
+QVariantList HealthAnalytics::getFaultRateTrend(int hours) const
+{
+    return TrendAnalyzer::toVariantList(chartFaultRateTrend(hours));
+}
+
+QList<QPointF> HealthAnalytics::chartHealthScoreTrend(int hours) const
+{
     // Aggregate all subsystem health histories
     QMap<qint64, QList<double>> scoresByTime;
     
@@ -272,27 +306,11 @@ QVariantList HealthAnalytics::getHealthScoreTrend(int hours) const
         }
     }
     
-    // Calculate averages
-    for (auto it = scoresByTime.begin(); it != scoresByTime.end(); ++it) {
-        double sum = 0;
-        for (double score : it.value()) {
-            sum += score;
-        }
-        double avg = sum / it.value().size();
-        
-        QVariantMap point;
-        point["timestamp"] = QDateTime::fromSecsSinceEpoch(it.key() * 60);
-        point["value"] = avg;
-        trend.append(point);
-    }
-    
-    return trend;
+    return averagePerBucket(scoresByTime, 60);
 }
 
-QVariantList HealthAnalytics::getTemperatureTrend(int hours) const
+QList<QPointF> HealthAnalytics::chartTemperatureTrend(int hours) const
 {
-    QVariantList trend;
-    
     QDateTime cutoff = QDateTime::currentDateTime().addSecs(-hours * 3600);
     
     QMap<qint64, QList<double>> tempsByTime;
@@ -306,26 +324,11 @@ QVariantList HealthAnalytics::getTemperatureTrend(int hours) const
         }
     }
     
-    for (auto it = tempsByTime.begin(); it != tempsByTime.end(); ++it) {
-        double sum = 0;
-        for (double temp : it.value()) {
-            sum += temp;
-        }
-        double avg = sum / it.value().size();
-        
-        QVariantMap point;
-        point["timestamp"] = QDateTime::fromSecsSinceEpoch(it.key() * 60);
-        point["value"] = avg;
-        trend.append(point);
-    }
-    
-    return trend;
+    return averagePerBucket(tempsByTime, 60);
 }
 
-QVariantList HealthAnalytics::getFaultRateTrend(int hours) const
+QList<QPointF> HealthAnalytics::chartFaultRateTrend(int hours) const
 {
-    QVariantList trend;
-    
     QDateTime cutoff = QDateTime::currentDateTime().addSecs(-hours * 3600);
     
     QMap<qint64, int> faultsByHour;
@@ -339,11 +342,10 @@ QVariantList HealthAnalytics::getFaultRateTrend(int hours) const
         }
     }
     
+    QList<QPointF> trend;
+    trend.reserve(faultsByHour.size());
     for (auto it = faultsByHour.begin(); it != faultsByHour.end(); ++it) {
-        QVariantMap point;
-        point["timestamp"] = QDateTime::fromSecsSinceEpoch(it.key() * 3600);
-        point["value"] = it.value();
-        trend.append(point);
+        trend.append(QPointF(it.key() * 3600 * 1000.0, it.value()));
     }
     
     return trend;
@@ -390,7 +392,7 @@ QString HealthAnalytics::exportReportCsv(const QDateTime& startTime,
 void HealthAnalytics::updateAnalytics()
 {
     computeMetrics();
-    emit analyticsUpdated();
+    notifyAnalyticsUpdated();
 }
 
 void HealthAnalytics::recordHealthSnapshot()
@@ -425,7 +427,7 @@ void HealthAnalytics::recordHealthSnapshot()
     }
     
     computeMetrics();
-    emit analyticsUpdated();
+    notifyAnalyticsUpdated();
 }
 
 void HealthAnalytics::onSubsystemHealthChanged(const QString& subsystemId)
@@ -444,7 +446,7 @@ void HealthAnalytics::onFaultOccurred(const QString& subsystemId, const QString&
     m_faultHistory[subsystemId].append(record);
     m_totalFaults++;
     
-    emit analyticsUpdated();
+    notifyAnalyticsUpdated();
 }
 
 void HealthAnalytics::onFaultCleared(const QString& subsystemId, const QString& faultCode)
@@ -460,7 +462,15 @@ void HealthAnalytics::onFaultCleared(const QString& subsystemId, const QString&
         }
     }
     
-    emit analyticsUpdated();
+    notifyAnalyticsUpdated();
+}
+
+void HealthAnalytics::notifyAnalyticsUpdated()
+{
+    // Fault bursts re-evaluate the analytics bindings once per frame
+    SignalCoalescer::instance()->schedule(this, [this]() {
+        emit analyticsUpdated();
+    });
 }
 
 void HealthAnalytics::computeMetrics()
@@ -1,4 +1,6 @@
 #include "analytics/TrendAnalyzer.h"
+#include "core/RadarSubsystem.h"
+#include <QPointer>
 #include <cmath>
 #include <algorithm>
 
@@ -13,12 +15,46 @@ TrendAnalyzer::TrendAnalyzer(QObject* parent)
 {
 }
 
+qint64 TrendAnalyzer::toMonotonicMs(Timestamp timestamp)
+{
+    return timestamp.nanoseconds() / 1000000;
+}
+
+QDateTime TrendAnalyzer::toDateTime(qint64 monotonicMs)
+{
+    return Timestamp::fromNanoseconds(monotonicMs * 1000000).toDateTime();
+}
+
+qint64 TrendAnalyzer::toEpochMs(qint64 monotonicMs)
+{
+    return Timestamp::fromNanoseconds(monotonicMs * 1000000).toMSecsSinceEpoch();
+}
+
+QVariantList TrendAnalyzer::toVariantList(const QList<QPointF>& points)
+{
+    QVariantList list;
+    list.reserve(points.size());
+    for (const QPointF& point : points) {
+        QVariantMap entry;
+        entry["timestamp"] = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(point.x()));
+        entry["value"] = point.y();
+        list.append(entry);
+    }
+    return list;
+}
+
 void TrendAnalyzer::addDataPoint(const QString& subsystemId, const QString& parameter, 
                                   double value, const QDateTime& timestamp)
+{
+    addDataPoint(subsystemId, parameter, value, Timestamp::fromDateTime(timestamp));
+}
+
+void TrendAnalyzer::addDataPoint(const QString& subsystemId, const QString& parameter, 
+                                  double value, Timestamp timestamp)
 {
     DataPoint point;
     point.value = value;
-    point.timestampMs = timestamp.toMSecsSinceEpoch();
+    point.timestampMs = toMonotonicMs(timestamp);
     
     auto& data = m_data[subsystemId][parameter];
     data.push_back(point);
@@ -38,7 +74,7 @@ void TrendAnalyzer::addDataPoint(const QString& subsystemId, const QString& para
 
 void TrendAnalyzer::addDataPoints(const QString& subsystemId, const QVariantMap& values)
 {
-    QDateTime now = QDateTime::currentDateTime();
+    const Timestamp now = Timestamp::now();
     
     for (auto it = values.begin(); it != values.end(); ++it) {
         if (it.value().canConvert<double>()) {
@@ -47,6 +83,37 @@ void TrendAnalyzer::addDataPoints(const QString& subsystemId, const QVariantMap&
     }
 }
 
+void TrendAnalyzer::addChanges(const RadarSubsystem* subsystem, const TelemetryChangeSet& changes)
+{
+    if (!subsystem) {
+        return;
+    }
+    
+    // Only the parameters that actually moved, not the whole telemetry map
+    const QString subsystemId = subsystem->getId();
+    for (const TelemetryChange& change : changes.changes) {
+        if (std::isnan(change.newValue)) {
+            continue;
+        }
+        addDataPoint(subsystemId, subsystem->getTelemetryParameterName(change.index),
+                     change.newValue, changes.timestamp);
+    }
+}
+
+void TrendAnalyzer::trackSubsystem(RadarSubsystem* subsystem)
+{
+    if (!subsystem) {
+        return;
+    }
+    
+    // Context this: queued onto our thread when telemetry is written off it
+    QPointer<RadarSubsystem> guarded(subsystem);
+    connect(subsystem, &RadarSubsystem::telemetryValuesChanged, this,
+            [this, guarded](const TelemetryChangeSet& changes) {
+                addChanges(guarded.data(), changes);
+            });
+}
+
 TrendAnalyzer::TrendResult TrendAnalyzer::analyzeTrend(const QString& subsystemId, 
                                                         const QString& parameter) const
 {
@@ -193,7 +260,7 @@ QDateTime TrendAnalyzer::predictThresholdCrossing(const QString& subsystemId,
     
     // Only return if in the future
     if (crossingTime > data.back().timestampMs) {
-        return QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(crossingTime));
+        return toDateTime(static_cast<qint64>(crossingTime));
     }
     
     return QDateTime();
@@ -282,7 +349,19 @@ void TrendAnalyzer::setTrendThreshold(double threshold)
 QVariantList TrendAnalyzer::getDataPoints(const QString& subsystemId, const QString& parameter,
                                            int maxPoints) const
 {
-    QVariantList points;
+    return toVariantList(chartDataPoints(subsystemId, parameter, maxPoints));
+}
+
+QVariantList TrendAnalyzer::getTrendLine(const QString& subsystemId, const QString& parameter,
+                                          int points) const
+{
+    return toVariantList(chartTrendLine(subsystemId, parameter, points));
+}
+
+QList<QPointF> TrendAnalyzer::chartDataPoints(const QString& subsystemId, const QString& parameter,
+                                              int maxPoints) const
+{
+    QList<QPointF> points;
     
     if (!m_data.contains(subsystemId) || !m_data[subsystemId].contains(parameter)) {
         return points;
@@ -293,20 +372,18 @@ QVariantList TrendAnalyzer::getDataPoints(const QString& subsystemId, const QStr
     size_t start = data.size() > static_cast<size_t>(maxPoints) ? 
                    data.size() - maxPoints : 0;
     
+    points.reserve(static_cast<int>(data.size() - start));
     for (size_t i = start; i < data.size(); ++i) {
-        QVariantMap point;
-        point["timestamp"] = QDateTime::fromMSecsSinceEpoch(data[i].timestampMs);
-        point["value"] = data[i].value;
-        points.append(point);
+        points.append(QPointF(toEpochMs(data[i].timestampMs), data[i].value));
     }
     
     return points;
 }
 
-QVariantList TrendAnalyzer::getTrendLine(const QString& subsystemId, const QString& parameter,
-                                          int points) const
+QList<QPointF> TrendAnalyzer::chartTrendLine(const QString& subsystemId, const QString& parameter,
+                                             int points) const
 {
-    QVariantList trendLine;
+    QList<QPointF> trendLine;
     
     if (!m_data.contains(subsystemId) || !m_data[subsystemId].contains(parameter)) {
         return trendLine;
@@ -314,7 +391,7 @@ QVariantList TrendAnalyzer::getTrendLine(const QString& subsystemId, const QStri
     
     const auto& data = m_data[subsystemId][parameter];
     
-    if (data.size() < 3) {
+    if (data.size() < 3 || points < 2) {
         return trendLine;
     }
     
@@ -333,14 +410,10 @@ QVariantList TrendAnalyzer::getTrendLine(const QString& subsystemId, const QStri
     qint64 endTime = data.back().timestampMs;
     qint64 step = (endTime - startTime) / (points - 1);
     
+    trendLine.reserve(points);
     for (int i = 0; i < points; ++i) {
         qint64 t = startTime + i * step;
-        double v = slope * t + intercept;
-        
-        QVariantMap point;
-        point["timestamp"] = QDateTime::fromMSecsSinceEpoch(t);
-        point["value"] = v;
-        trendLine.append(point);
+        trendLine.append(QPointF(toEpochMs(t), slope * t + intercept));
     }
     
     return trendLine;
@@ -358,7 +431,7 @@ void TrendAnalyzer::clearAllData()
 
 void TrendAnalyzer::pruneOldData(int maxAgeHours)
 {
-    qint64 cutoff = QDateTime::currentMSecsSinceEpoch() - maxAgeHours * 3600000;
+    qint64 cutoff = toMonotonicMs(Timestamp::now()) - maxAgeHours * 3600000LL;
     
     for (auto& subsystemData : m_data) {
         for (auto& paramData : subsystemData) {
@@ -5,9 +5,8 @@ namespace RadarRMP {
 UptimeTracker::UptimeTracker(QObject* parent)
     : QObject(parent)
     , m_snapshotIntervalMs(60000)
-    , m_lastSnapshotTime(0)
 {
-    m_trackingStartTime = QDateTime::currentDateTime();
+    m_trackingStartTime = Timestamp::now();
     
     // PERFORMANCE FIX: Disabled tick timer that runs every second
     // Previously, the timer would call tick() which iterates through all records
@@ -26,7 +25,7 @@ void UptimeTracker::registerSubsystem(const QString& subsystemId)
     
     UptimeRecord record;
     record.subsystemId = subsystemId;
-    record.startTime = QDateTime::currentDateTime();
+    record.startTime = Timestamp::now();
     record.totalUptimeMs = 0;
     record.totalDowntimeMs = 0;
     record.currentState = HealthState::UNKNOWN;
@@ -54,7 +53,7 @@ void UptimeTracker::updateState(const QString& subsystemId, HealthState state)
         QString newState = healthStateToString(state);
         
         // Calculate duration in previous state
-        qint64 durationMs = record.lastStateChange.msecsTo(QDateTime::currentDateTime());
+        qint64 durationMs = record.lastStateChange.msecsTo(Timestamp::now());
         
         if (record.currentState == HealthState::OK || 
             record.currentState == HealthState::DEGRADED) {
@@ -65,7 +64,7 @@ void UptimeTracker::updateState(const QString& subsystemId, HealthState state)
         }
         
         record.currentState = state;
-        record.lastStateChange = QDateTime::currentDateTime();
+        record.lastStateChange = Timestamp::now();
         record.stateTransitions++;
         
         if (state == HealthState::FAIL) {
@@ -161,7 +160,7 @@ QVariantMap UptimeTracker::getSystemUptimeSummary() const
     
     summary["systemUptime"] = getSystemUptime();
     summary["systemAvailability"] = getSystemAvailability();
-    summary["trackingStartTime"] = m_trackingStartTime;
+    summary["trackingStartTime"] = m_trackingStartTime.toDateTime();
     summary["subsystemCount"] = m_records.size();
     
     QVariantMap subsystemData;
@@ -183,12 +182,12 @@ QVariantList UptimeTracker::getUptimeHistory(const QString& subsystemId, int hou
     QVariantList history;
     
     // Get snapshots for this subsystem within the time range
-    QDateTime cutoff = QDateTime::currentDateTime().addSecs(-hours * 3600);
+    Timestamp cutoff = Timestamp::now().addSecs(-hours * 3600LL);
     
     for (const HistorySnapshot& snapshot : m_history) {
         if (snapshot.timestamp >= cutoff && snapshot.subsystemAvailability.contains(subsystemId)) {
             QVariantMap entry;
-            entry["timestamp"] = snapshot.timestamp;
+            entry["timestamp"] = snapshot.timestamp.toDateTime();
             entry["availability"] = snapshot.subsystemAvailability[subsystemId];
             history.append(entry);
         }
@@ -201,12 +200,12 @@ QVariantList UptimeTracker::getAvailabilityHistory(int hours) const
 {
     QVariantList history;
     
-    QDateTime cutoff = QDateTime::currentDateTime().addSecs(-hours * 3600);
+    Timestamp cutoff = Timestamp::now().addSecs(-hours * 3600LL);
     
     for (const HistorySnapshot& snapshot : m_history) {
         if (snapshot.timestamp >= cutoff) {
             QVariantMap entry;
-            entry["timestamp"] = snapshot.timestamp;
+            entry["timestamp"] = snapshot.timestamp.toDateTime();
             entry["availability"] = snapshot.systemAvailability;
             history.append(entry);
         }
@@ -243,10 +242,10 @@ void UptimeTracker::tick()
     updateRunningTotals();
     
     // Take periodic snapshots
-    qint64 now = QDateTime::currentMSecsSinceEpoch();
-    if (now - m_lastSnapshotTime >= m_snapshotIntervalMs) {
+    const Timestamp now = Timestamp::now();
+    if (!m_lastSnapshotTime.isValid() || m_lastSnapshotTime.msecsTo(now) >= m_snapshotIntervalMs) {
         HistorySnapshot snapshot;
-        snapshot.timestamp = QDateTime::currentDateTime();
+        snapshot.timestamp = now;
         snapshot.systemAvailability = getSystemAvailability();
         
         for (auto it = m_records.begin(); it != m_records.end(); ++it) {
@@ -257,7 +256,7 @@ void UptimeTracker::tick()
         m_lastSnapshotTime = now;
         
         // Prune old history (keep 24 hours)
-        QDateTime cutoff = QDateTime::currentDateTime().addSecs(-24 * 3600);
+        Timestamp cutoff = now.addSecs(-24 * 3600);
         while (!m_history.isEmpty() && m_history.first().timestamp < cutoff) {
             m_history.removeFirst();
         }
@@ -269,14 +268,14 @@ void UptimeTracker::reset()
     for (auto& record : m_records) {
         record.totalUptimeMs = 0;
         record.totalDowntimeMs = 0;
-        record.startTime = QDateTime::currentDateTime();
+        record.startTime = Timestamp::now();
         record.lastStateChange = record.startTime;
         record.stateTransitions = 0;
     }
     
     m_history.clear();
-    m_trackingStartTime = QDateTime::currentDateTime();
-    m_lastSnapshotTime = 0;
+    m_trackingStartTime = Timestamp::now();
+    m_lastSnapshotTime = Timestamp();
     
     emit uptimeUpdated();
 }
@@ -290,7 +289,7 @@ void UptimeTracker::resetSubsystem(const QString& subsystemId)
     UptimeRecord& record = m_records[subsystemId];
     record.totalUptimeMs = 0;
     record.totalDowntimeMs = 0;
-    record.startTime = QDateTime::currentDateTime();
+    record.startTime = Timestamp::now();
     record.lastStateChange = record.startTime;
     record.stateTransitions = 0;
     
@@ -299,7 +298,7 @@ void UptimeTracker::resetSubsystem(const QString& subsystemId)
 
 void UptimeTracker::updateRunningTotals()
 {
-    QDateTime now = QDateTime::currentDateTime();
+    const Timestamp now = Timestamp::now();
     
     for (auto& record : m_records) {
         qint64 durationMs = record.lastStateChange.msecsTo(now);
@@ -0,0 +1,136 @@
+#include "core/ActiveFaultSet.h"
+
+namespace RadarRMP {
+
+int ActiveFaultSet::registerCode(const QString& code)
+{
+    auto it = m_codeIndex.constFind(code);
+    if (it != m_codeIndex.constEnd()) {
+        return it.value();
+    }
+
+    if (m_slots.size() >= MAX_INDEXED_CODES) {
+        return -1;
+    }
+
+    int index = m_slots.size();
+    m_slots.append(FaultCode());
+    m_codeIndex.insert(code, index);
+
+    // Move an already-active overflow entry into its new slot
+    auto overflow = m_overflow.find(code);
+    if (overflow != m_overflow.end()) {
+        m_slots[index] = overflow.value();
+        m_activeBits |= (quint64(1) << index);
+        m_overflow.erase(overflow);
+    }
+
+    return index;
+}
+
+int ActiveFaultSet::indexOf(const QString& code) const
+{
+    return m_codeIndex.value(code, -1);
+}
+
+QStringList ActiveFaultSet::registeredCodes() const
+{
+    QStringList codes;
+    codes.reserve(m_slots.size());
+    for (int i = 0; i < m_slots.size(); ++i) {
+        codes.append(QString());
+    }
+    for (auto it = m_codeIndex.constBegin(); it != m_codeIndex.constEnd(); ++it) {
+        codes[it.value()] = it.key();
+    }
+    return codes;
+}
+
+bool ActiveFaultSet::contains(const QString& code) const
+{
+    int index = indexOf(code);
+    if (index >= 0) {
+        return (m_activeBits & (quint64(1) << index)) != 0;
+    }
+    return m_overflow.contains(code);
+}
+
+bool ActiveFaultSet::insert(const FaultCode& fault)
+{
+    int index = indexOf(fault.code);
+    if (index >= 0) {
+        const quint64 bit = quint64(1) << index;
+        if (m_activeBits & bit) {
+            return false;
+        }
+        m_slots[index] = fault;
+        m_activeBits |= bit;
+        return true;
+    }
+
+    if (m_overflow.contains(fault.code)) {
+        return false;
+    }
+    m_overflow.insert(fault.code, fault);
+    return true;
+}
+
+bool ActiveFaultSet::take(const QString& code, FaultCode* taken)
+{
+    int index = indexOf(code);
+    if (index >= 0) {
+        const quint64 bit = quint64(1) << index;
+        if (!(m_activeBits & bit)) {
+            return false;
+        }
+        m_activeBits &= ~bit;
+        if (taken) {
+            *taken = std::move(m_slots[index]);
+        }
+        m_slots[index] = FaultCode();
+        return true;
+    }
+
+    auto it = m_overflow.find(code);
+    if (it == m_overflow.end()) {
+        return false;
+    }
+    if (taken) {
+        *taken = std::move(it.value());
+    }
+    m_overflow.erase(it);
+    return true;
+}
+
+int ActiveFaultSet::size() const
+{
+    return qPopulationCount(m_activeBits) + m_overflow.size();
+}
+
+bool ActiveFaultSet::isEmpty() const
+{
+    return m_activeBits == 0 && m_overflow.isEmpty();
+}
+
+void ActiveFaultSet::clear()
+{
+    quint64 bits = m_activeBits;
+    while (bits != 0) {
+        m_slots[qCountTrailingZeroBits(bits)] = FaultCode();
+        bits &= bits - 1;
+    }
+    m_activeBits = 0;
+    m_overflow.clear();
+}
+
+QList<FaultCode> ActiveFaultSet::values() const
+{
+    QList<FaultCode> list;
+    list.reserve(size());
+    forEach([&list](const FaultCode& fault) {
+        list.append(fault);
+    });
+    return list;
+}
+
+} // namespace RadarRMP
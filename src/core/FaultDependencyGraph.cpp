@@ -0,0 +1,141 @@
+#include "core/FaultDependencyGraph.h"
+#include <algorithm>
+
+namespace RadarRMP {
+
+bool FaultDependencyGraph::addDependency(const QString& downstream, const QString& upstream)
+{
+    if (downstream.isEmpty() || upstream.isEmpty() || downstream == upstream) {
+        return false;
+    }
+    if (m_upstream.value(downstream).contains(upstream)) {
+        return false;
+    }
+
+    // upstream already depending on downstream would close a loop
+    if (dependsOn(upstream, downstream)) {
+        return false;
+    }
+
+    m_upstream[downstream].append(upstream);
+    m_downstream[upstream].append(downstream);
+    return true;
+}
+
+bool FaultDependencyGraph::removeDependency(const QString& downstream, const QString& upstream)
+{
+    auto up = m_upstream.find(downstream);
+    if (up == m_upstream.end() || !up->removeOne(upstream)) {
+        return false;
+    }
+    if (up->isEmpty()) {
+        m_upstream.erase(up);
+    }
+
+    auto down = m_downstream.find(upstream);
+    if (down != m_downstream.end()) {
+        down->removeOne(downstream);
+        if (down->isEmpty()) {
+            m_downstream.erase(down);
+        }
+    }
+    return true;
+}
+
+void FaultDependencyGraph::removeSubsystem(const QString& subsystemId)
+{
+    const QStringList upstreams = m_upstream.value(subsystemId);
+    for (const QString& upstream : upstreams) {
+        removeDependency(subsystemId, upstream);
+    }
+
+    const QStringList downstreams = m_downstream.value(subsystemId);
+    for (const QString& downstream : downstreams) {
+        removeDependency(downstream, subsystemId);
+    }
+}
+
+void FaultDependencyGraph::clear()
+{
+    m_upstream.clear();
+    m_downstream.clear();
+}
+
+int FaultDependencyGraph::load(const QVariantMap& upstreamByDownstream)
+{
+    clear();
+
+    int accepted = 0;
+    for (auto it = upstreamByDownstream.constBegin(); it != upstreamByDownstream.constEnd(); ++it) {
+        const QStringList upstreams = it.value().toStringList();
+        for (const QString& upstream : upstreams) {
+            if (addDependency(it.key(), upstream)) {
+                accepted++;
+            }
+        }
+    }
+    return accepted;
+}
+
+QVariantMap FaultDependencyGraph::toVariantMap() const
+{
+    QVariantMap map;
+    for (auto it = m_upstream.constBegin(); it != m_upstream.constEnd(); ++it) {
+        map[it.key()] = it.value();
+    }
+    return map;
+}
+
+QStringList FaultDependencyGraph::upstreamOf(const QString& subsystemId) const
+{
+    // Breadth-first so the nearest upstream comes first
+    QStringList result;
+    QSet<QString> seen;
+    QStringList frontier = m_upstream.value(subsystemId);
+
+    while (!frontier.isEmpty()) {
+        QStringList next;
+        for (const QString& id : frontier) {
+            if (seen.contains(id)) {
+                continue;
+            }
+            seen.insert(id);
+            result.append(id);
+            next.append(m_upstream.value(id));
+        }
+        frontier = next;
+    }
+    return result;
+}
+
+QStringList FaultDependencyGraph::downstreamOf(const QString& subsystemId) const
+{
+    // Reverse DFS post-order of a DAG is a topological order
+    QSet<QString> visited;
+    QStringList postOrder;
+    visitDownstream(subsystemId, visited, postOrder);
+
+    postOrder.removeLast();     // subsystemId itself
+    std::reverse(postOrder.begin(), postOrder.end());
+    return postOrder;
+}
+
+bool FaultDependencyGraph::dependsOn(const QString& downstream, const QString& upstream) const
+{
+    return upstreamOf(downstream).contains(upstream);
+}
+
+void FaultDependencyGraph::visitDownstream(const QString& subsystemId, QSet<QString>& visited,
+                                           QStringList& postOrder) const
+{
+    visited.insert(subsystemId);
+    const QStringList downstreams = m_downstream.value(subsystemId);
+    for (const QString& downstream : downstreams) {
+        if (!visited.contains(downstream)) {
+            visitDownstream(downstream, visited, postOrder);
+        }
+    }
+    postOrder.append(subsystemId);
+}
+
+} // namespace RadarRMP
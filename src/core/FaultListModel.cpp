@@ -0,0 +1,318 @@
+#include "core/FaultListModel.h"
+#include "core/FaultManager.h"
+#include <algorithm>
+
+namespace RadarRMP {
+
+namespace {
+
+int severityFromString(const QString& text)
+{
+    const QString upper = text.toUpper();
+    if (upper == "INFO") return static_cast<int>(FaultSeverity::INFO);
+    if (upper == "WARNING") return static_cast<int>(FaultSeverity::WARNING);
+    if (upper == "CRITICAL") return static_cast<int>(FaultSeverity::CRITICAL);
+    if (upper == "FATAL") return static_cast<int>(FaultSeverity::FATAL);
+    return -1;
+}
+
+} // namespace
+
+FaultListModel::FaultListModel(FaultManager* manager, Source source, QObject* parent)
+    : QAbstractListModel(parent)
+    , m_manager(manager)
+    , m_source(source)
+    , m_minimumSeverity(-1)
+    , m_sortOrder(NewestFirst)
+    , m_nextOlder(0)
+{
+    if (m_manager) {
+        m_manager->attachModel(this);
+    }
+    reload();
+}
+
+FaultListModel::~FaultListModel()
+{
+    // Null once the manager itself is being destroyed
+    if (m_manager) {
+        m_manager->detachModel(this);
+    }
+}
+
+int FaultListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_rows.size();
+}
+
+QVariant FaultListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() < 0 || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const FaultCode& fault = m_rows.at(index.row()).fault;
+    switch (role) {
+        case CodeRole:
+        case Qt::DisplayRole:
+            return fault.code;
+        case DescriptionRole:
+            return fault.description;
+        case SeverityRole:
+            return faultSeverityToString(fault.severity);
+        case SeverityLevelRole:
+            return static_cast<int>(fault.severity);
+        case TimestampRole:
+            return fault.timestamp.toDateTime();
+        case SubsystemIdRole:
+            return fault.subsystemId;
+        case ActiveRole:
+            return fault.active;
+        case SuppressedCountRole:
+            return (m_source == ActiveFaults && m_manager)
+                ? m_manager->getConsequentialCount(fault.subsystemId) : 0;
+        default:
+            return QVariant();
+    }
+}
+
+QHash<int, QByteArray> FaultListModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[CodeRole] = "code";
+    roles[DescriptionRole] = "description";
+    roles[SeverityRole] = "severity";
+    roles[SeverityLevelRole] = "severityLevel";
+    roles[TimestampRole] = "timestamp";
+    roles[SubsystemIdRole] = "subsystemId";
+    roles[ActiveRole] = "active";
+    roles[SuppressedCountRole] = "suppressedCount";
+    return roles;
+}
+
+bool FaultListModel::canFetchMore(const QModelIndex& parent) const
+{
+    if (parent.isValid() || m_source != FaultHistory || !m_manager) {
+        return false;
+    }
+    return m_nextOlder > m_manager->historyBegin();
+}
+
+void FaultListModel::fetchMore(const QModelIndex& parent)
+{
+    if (!canFetchMore(parent)) {
+        return;
+    }
+    const QVector<Row> page = takeHistoryPage();
+    if (page.isEmpty()) {
+        return;
+    }
+
+    const int first = m_rows.size();
+    beginInsertRows(QModelIndex(), first, first + page.size() - 1);
+    m_rows.append(page);
+    endInsertRows();
+    emit countChanged();
+}
+
+void FaultListModel::setSubsystemFilter(const QString& subsystemId)
+{
+    if (m_subsystemFilter == subsystemId) {
+        return;
+    }
+    m_subsystemFilter = subsystemId;
+    reload();
+    emit filterChanged();
+}
+
+QString FaultListModel::getMinimumSeverity() const
+{
+    return m_minimumSeverity >= 0
+        ? faultSeverityToString(static_cast<FaultSeverity>(m_minimumSeverity)) : QString();
+}
+
+void FaultListModel::setMinimumSeverity(const QString& severity)
+{
+    // Empty or unrecognised shows every severity
+    const int level = severityFromString(severity);
+    if (m_minimumSeverity == level) {
+        return;
+    }
+    m_minimumSeverity = level;
+    reload();
+    emit filterChanged();
+}
+
+void FaultListModel::setSortOrder(SortOrder order)
+{
+    if (m_sortOrder == order) {
+        return;
+    }
+    m_sortOrder = order;
+    if (m_source == ActiveFaults) {
+        reload();
+    }
+    emit sortOrderChanged();
+}
+
+void FaultListModel::reload()
+{
+    const int oldCount = m_rows.size();
+
+    beginResetModel();
+    m_rows.clear();
+    if (m_manager) {
+        if (m_source == ActiveFaults) {
+            const QList<FaultCode> faults = m_manager->getActiveFaults();
+            for (const FaultCode& fault : faults) {
+                if (fault.causedBy.isEmpty() && accepts(fault)) {
+                    m_rows.append(Row{fault, -1});
+                }
+            }
+            std::sort(m_rows.begin(), m_rows.end(), [this](const Row& a, const Row& b) {
+                return before(a.fault, b.fault);
+            });
+        } else {
+            // Newest page only; the rest arrives through fetchMore()
+            m_nextOlder = m_manager->historyEnd();
+            m_rows = takeHistoryPage();
+        }
+    }
+    endResetModel();
+
+    if (m_rows.size() != oldCount) {
+        emit countChanged();
+    }
+}
+
+void FaultListModel::faultAdded(const FaultCode& fault)
+{
+    if (m_source != ActiveFaults || !accepts(fault)) {
+        return;
+    }
+
+    auto it = std::upper_bound(m_rows.cbegin(), m_rows.cend(), fault,
+                               [this](const FaultCode& value, const Row& row) {
+                                   return before(value, row.fault);
+                               });
+    insertAt(static_cast<int>(it - m_rows.cbegin()), Row{fault, -1});
+}
+
+void FaultListModel::faultRemoved(const QString& subsystemId, const QString& faultCode)
+{
+    if (m_source != ActiveFaults) {
+        return;
+    }
+
+    for (int row = 0; row < m_rows.size(); ++row) {
+        const FaultCode& fault = m_rows.at(row).fault;
+        if (fault.code == faultCode && fault.subsystemId == subsystemId) {
+            beginRemoveRows(QModelIndex(), row, row);
+            m_rows.remove(row);
+            endRemoveRows();
+            emit countChanged();
+            return;
+        }
+    }
+}
+
+void FaultListModel::historyAppended(qint64 sequence)
+{
+    if (m_source != FaultHistory || !m_manager) {
+        return;
+    }
+
+    const FaultCode& fault = m_manager->historyAt(sequence);
+    if (accepts(fault)) {
+        insertAt(0, Row{fault, sequence});
+    }
+}
+
+void FaultListModel::historyTrimmed(qint64 firstSequence)
+{
+    if (m_source != FaultHistory) {
+        return;
+    }
+
+    m_nextOlder = qMax(m_nextOlder, firstSequence);
+
+    // Oldest rows are at the end
+    int keep = m_rows.size();
+    while (keep > 0 && m_rows.at(keep - 1).sequence < firstSequence) {
+        keep--;
+    }
+    if (keep < m_rows.size()) {
+        beginRemoveRows(QModelIndex(), keep, m_rows.size() - 1);
+        m_rows.resize(keep);
+        endRemoveRows();
+        emit countChanged();
+    }
+}
+
+void FaultListModel::suppressionChanged(const QSet<QString>& rootSubsystemIds)
+{
+    if (m_source != ActiveFaults) {
+        return;
+    }
+
+    static const QVector<int> roles = { SuppressedCountRole };
+    for (int row = 0; row < m_rows.size(); ++row) {
+        if (rootSubsystemIds.contains(m_rows.at(row).fault.subsystemId)) {
+            const QModelIndex changed = index(row);
+            emit dataChanged(changed, changed, roles);
+        }
+    }
+}
+
+bool FaultListModel::accepts(const FaultCode& fault) const
+{
+    if (!m_subsystemFilter.isEmpty() && fault.subsystemId != m_subsystemFilter) {
+        return false;
+    }
+    return static_cast<int>(fault.severity) >= m_minimumSeverity;
+}
+
+bool FaultListModel::before(const FaultCode& a, const FaultCode& b) const
+{
+    if (m_sortOrder == SeverityFirst && a.severity != b.severity) {
+        return a.severity > b.severity;
+    }
+    if (a.timestamp != b.timestamp) {
+        return a.timestamp > b.timestamp;
+    }
+    // Stable position for faults raised in the same instant
+    if (a.subsystemId != b.subsystemId) {
+        return a.subsystemId < b.subsystemId;
+    }
+    return a.code < b.code;
+}
+
+void FaultListModel::insertAt(int row, const Row& entry)
+{
+    beginInsertRows(QModelIndex(), row, row);
+    m_rows.insert(row, entry);
+    endInsertRows();
+    emit countChanged();
+}
+
+QVector<FaultListModel::Row> FaultListModel::takeHistoryPage()
+{
+    // Walk back from the oldest entry considered so far, newest first
+    QVector<Row> page;
+    const qint64 begin = m_manager->historyBegin();
+    qint64 sequence = m_nextOlder;
+    while (sequence > begin && page.size() < HISTORY_PAGE_SIZE) {
+        sequence--;
+        const FaultCode& fault = m_manager->historyAt(sequence);
+        if (accepts(fault)) {
+            page.append(Row{fault, sequence});
+        }
+    }
+    m_nextOlder = sequence;
+    return page;
+}
+
+} // namespace RadarRMP
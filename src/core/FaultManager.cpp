@@ -1,10 +1,20 @@
 #include "core/FaultManager.h"
+#include "core/SignalCoalescer.h"
+#include <QSet>
+#include <utility>
 
 namespace RadarRMP {
 
 FaultManager::FaultManager(QObject* parent)
     : QObject(parent)
+    , m_historyBase(0)
+    , m_suppressedCount(0)
+    , m_activeModel(nullptr)
+    , m_historyModel(nullptr)
+    , m_faultsDirty(false)
 {
+    m_activeModel = new FaultListModel(this, FaultListModel::ActiveFaults, this);
+    m_historyModel = new FaultListModel(this, FaultListModel::FaultHistory, this);
 }
 
 void FaultManager::registerFault(const FaultCode& fault)
@@ -15,54 +25,80 @@ void FaultManager::registerFault(const FaultCode& fault)
         return;  // Fault already registered
     }
     
-    m_activeFaults[key] = fault;
-    m_faultHistory.append(fault);
-    
-    // Update subsystem fault tracking
-    m_subsystemLastFault[fault.subsystemId] = fault.timestamp;
-    m_subsystemFaultCounts[fault.subsystemId]++;
+    FaultCode recorded = fault;
+    recorded.causedBy = findRootCause(fault.subsystemId);
+    m_activeFaults[key] = recorded;
+    account(recorded, +1);
     
-    // Trim history if needed
-    while (m_faultHistory.size() > MAX_HISTORY_SIZE) {
-        m_faultHistory.removeFirst();
+    // Consequential faults are kept for root-cause queries only
+    if (!recorded.causedBy.isEmpty()) {
+        return;
     }
     
-    emit faultRegistered(fault.subsystemId, fault.code);
-    emit faultsChanged();
+    recordHistory(recorded);
     
-    if (fault.severity == FaultSeverity::CRITICAL || 
-        fault.severity == FaultSeverity::FATAL) {
-        emit criticalFaultOccurred(fault.subsystemId, fault.code);
+    // A new root takes over whatever was active downstream of it
+    if (m_rootFaultCounts.value(recorded.subsystemId) == 1) {
+        demoteDownstream(recorded.subsystemId);
     }
+    
+    publishAdded(recorded);
+    announce(recorded);
+    notifyFaultsChanged();
 }
 
 void FaultManager::clearFault(const QString& faultCode, const QString& subsystemId)
 {
-    QString key = makeFaultKey(subsystemId, faultCode);
+    auto it = m_activeFaults.find(makeFaultKey(subsystemId, faultCode));
+    if (it == m_activeFaults.end()) {
+        return;
+    }
     
-    if (m_activeFaults.remove(key) > 0) {
-        emit faultCleared(subsystemId, faultCode);
-        emit faultsChanged();
+    const FaultCode fault = it.value();
+    account(fault, -1);
+    m_activeFaults.erase(it);
+    
+    // Never surfaced, so nothing to retract, but the totals still moved
+    if (!fault.causedBy.isEmpty()) {
+        notifyFaultsChanged();
+        return;
+    }
+    
+    publishRemoved(fault);
+    emit faultCleared(subsystemId, faultCode);
+    if (m_rootFaultCounts.value(subsystemId) == 0) {
+        promoteDownstream(subsystemId);
     }
+    notifyFaultsChanged();
 }
 
 void FaultManager::clearAllFaults(const QString& subsystemId)
 {
-    QStringList keysToRemove;
-    
-    for (auto it = m_activeFaults.begin(); it != m_activeFaults.end(); ++it) {
-        if (it.value().subsystemId == subsystemId) {
-            keysToRemove.append(it.key());
+    const QString prefix = subsystemId + ":";
+    QList<FaultCode> cleared;
+    int removed = 0;
+    
+    auto it = subsystemBegin(subsystemId);
+    while (it != m_activeFaults.end() && it.key().startsWith(prefix)) {
+        account(it.value(), -1);
+        if (it.value().causedBy.isEmpty()) {
+            cleared.append(it.value());
         }
+        it = m_activeFaults.erase(it);
+        removed++;
     }
     
-    for (const QString& key : keysToRemove) {
-        FaultCode fault = m_activeFaults.take(key);
+    for (const FaultCode& fault : cleared) {
+        publishRemoved(fault);
         emit faultCleared(fault.subsystemId, fault.code);
     }
     
-    if (!keysToRemove.isEmpty()) {
-        emit faultsChanged();
+    if (!cleared.isEmpty()) {
+        promoteDownstream(subsystemId);
+    }
+    // Consequential-only removals change the totals too
+    if (removed > 0) {
+        notifyFaultsChanged();
     }
 }
 
@@ -73,11 +109,97 @@ void FaultManager::clearAllFaults()
     }
     
     for (const auto& fault : m_activeFaults) {
-        emit faultCleared(fault.subsystemId, fault.code);
+        if (fault.causedBy.isEmpty()) {
+            emit faultCleared(fault.subsystemId, fault.code);
+        }
     }
     
     m_activeFaults.clear();
-    emit faultsChanged();
+    m_rootFaultCounts.clear();
+    m_consequentialCounts.clear();
+    m_suppressedCount = 0;
+    m_suppressionChanged.clear();
+    reloadActiveModels();
+    notifyFaultsChanged();
+}
+
+bool FaultManager::addDependency(const QString& downstreamId, const QString& upstreamId)
+{
+    if (!m_dependencies.addDependency(downstreamId, upstreamId)) {
+        return false;
+    }
+    
+    reclassifyAll();
+    return true;
+}
+
+bool FaultManager::removeDependency(const QString& downstreamId, const QString& upstreamId)
+{
+    if (!m_dependencies.removeDependency(downstreamId, upstreamId)) {
+        return false;
+    }
+    
+    reclassifyAll();
+    return true;
+}
+
+int FaultManager::loadDependencies(const QVariantMap& upstreamByDownstream)
+{
+    const int accepted = m_dependencies.load(upstreamByDownstream);
+    reclassifyAll();
+    return accepted;
+}
+
+QVariantMap FaultManager::getDependencies() const
+{
+    return m_dependencies.toVariantMap();
+}
+
+QStringList FaultManager::getUpstream(const QString& subsystemId) const
+{
+    return m_dependencies.upstreamOf(subsystemId);
+}
+
+QStringList FaultManager::getDownstream(const QString& subsystemId) const
+{
+    return m_dependencies.downstreamOf(subsystemId);
+}
+
+bool FaultManager::isConsequential(const QString& subsystemId, const QString& faultCode) const
+{
+    auto it = m_activeFaults.constFind(makeFaultKey(subsystemId, faultCode));
+    return it != m_activeFaults.constEnd() && !it.value().causedBy.isEmpty();
+}
+
+QVariantList FaultManager::getConsequentialFaultsVariant(const QString& rootSubsystemId) const
+{
+    QVariantList list;
+    if (m_consequentialCounts.value(rootSubsystemId) == 0) {
+        return list;
+    }
+    
+    // Only subsystems downstream of the root can carry its consequences
+    const QStringList downstream = m_dependencies.downstreamOf(rootSubsystemId);
+    for (const QString& subsystemId : downstream) {
+        const QString prefix = subsystemId + ":";
+        for (auto it = m_activeFaults.lowerBound(prefix);
+             it != m_activeFaults.constEnd() && it.key().startsWith(prefix); ++it) {
+            const FaultCode& fault = it.value();
+            if (fault.causedBy != rootSubsystemId) {
+                continue;
+            }
+            QVariantMap map;
+            map["code"] = fault.code;
+            map["description"] = fault.description;
+            map["severity"] = faultSeverityToString(fault.severity);
+            map["timestamp"] = fault.timestamp.toDateTime();
+            map["subsystemId"] = fault.subsystemId;
+            map["causedBy"] = fault.causedBy;
+            list.append(map);
+        }
+    }
+    
+    return list;
 }
 
 QList<FaultCode> FaultManager::getActiveFaults() const
@@ -145,13 +267,16 @@ FaultCode FaultManager::getFault(const QString& faultCode) const
 
 int FaultManager::getTotalActiveFaults() const
 {
-    return m_activeFaults.size();
+    return m_activeFaults.size() - m_suppressedCount;
 }
 
 int FaultManager::getCriticalFaultCount() const
 {
     int count = 0;
     for (const auto& fault : m_activeFaults) {
+        if (!fault.causedBy.isEmpty()) {
+            continue;
+        }
         if (fault.severity == FaultSeverity::CRITICAL || 
             fault.severity == FaultSeverity::FATAL) {
             count++;
@@ -164,7 +289,7 @@ int FaultManager::getFaultCount(FaultSeverity severity) const
 {
     int count = 0;
     for (const auto& fault : m_activeFaults) {
-        if (fault.severity == severity) {
+        if (fault.severity == severity && fault.causedBy.isEmpty()) {
             count++;
         }
     }
@@ -173,27 +298,74 @@ int FaultManager::getFaultCount(FaultSeverity severity) const
 
 int FaultManager::getFaultCount(const QString& subsystemId) const
 {
+    const QString prefix = subsystemId + ":";
     int count = 0;
-    for (const auto& fault : m_activeFaults) {
-        if (fault.subsystemId == subsystemId) {
+    for (auto it = m_activeFaults.lowerBound(prefix);
+         it != m_activeFaults.constEnd() && it.key().startsWith(prefix); ++it) {
+        if (it.value().causedBy.isEmpty()) {
             count++;
         }
     }
     return count;
 }
 
+FaultListModel* FaultManager::getSubsystemFaultModel(const QString& subsystemId)
+{
+    if (subsystemId.isEmpty()) {
+        return nullptr;
+    }
+    
+    // Parented, so the QML engine never takes ownership
+    FaultListModel*& model = m_subsystemModels[subsystemId];
+    if (!model) {
+        model = new FaultListModel(this, FaultListModel::ActiveFaults, this);
+        model->setSubsystemFilter(subsystemId);
+    }
+    return model;
+}
+
+void FaultManager::releaseSubsystemFaultModel(const QString& subsystemId)
+{
+    if (FaultListModel* model = m_subsystemModels.take(subsystemId)) {
+        model->deleteLater();
+    }
+}
+
+void FaultManager::attachModel(FaultListModel* model)
+{
+    if (model && !m_models.contains(model)) {
+        m_models.append(model);
+    }
+}
+
+void FaultManager::detachModel(FaultListModel* model)
+{
+    m_models.removeOne(model);
+    
+    for (auto it = m_subsystemModels.begin(); it != m_subsystemModels.end(); ++it) {
+        if (it.value() == model) {
+            m_subsystemModels.erase(it);
+            break;
+        }
+    }
+}
+
 QVariantList FaultManager::getActiveFaultsVariant() const
 {
     QVariantList list;
     
     for (const auto& fault : m_activeFaults) {
+        if (!fault.causedBy.isEmpty()) {
+            continue;
+        }
         QVariantMap map;
         map["code"] = fault.code;
         map["description"] = fault.description;
         map["severity"] = faultSeverityToString(fault.severity);
-        map["timestamp"] = fault.timestamp;
+        map["timestamp"] = fault.timestamp.toDateTime();
         map["subsystemId"] = fault.subsystemId;
         map["active"] = fault.active;
+        map["suppressedCount"] = m_consequentialCounts.value(fault.subsystemId, 0);
         list.append(map);
     }
     
@@ -210,7 +382,7 @@ QVariantList FaultManager::getRecentFaultsVariant(int maxCount) const
         map["code"] = fault.code;
         map["description"] = fault.description;
         map["severity"] = faultSeverityToString(fault.severity);
-        map["timestamp"] = fault.timestamp;
+        map["timestamp"] = fault.timestamp.toDateTime();
         map["subsystemId"] = fault.subsystemId;
         map["active"] = fault.active;
         list.append(map);
@@ -228,6 +400,7 @@ QVariantMap FaultManager::getFaultStatistics() const
     stats["warningCount"] = getFaultCount(FaultSeverity::WARNING);
     stats["infoCount"] = getFaultCount(FaultSeverity::INFO);
     stats["historyCount"] = m_faultHistory.size();
+    stats["suppressedCount"] = m_suppressedCount;
     
     // Per-subsystem counts
     QVariantMap subsystemCounts;
@@ -249,8 +422,8 @@ double FaultManager::estimateMTBF(const QString& subsystemId) const
     
     // Simple MTBF estimation based on fault count and tracking time
     // In a real system, this would use more sophisticated analysis
-    QDateTime firstFault;
-    QDateTime lastFault;
+    Timestamp firstFault;
+    Timestamp lastFault;
     
     for (const auto& fault : m_faultHistory) {
         if (fault.subsystemId == subsystemId) {
@@ -302,9 +475,244 @@ void FaultManager::onSubsystemFaultCleared(const QString& subsystemId, const QSt
     clearFault(faultCode, subsystemId);
 }
 
+void FaultManager::notifyFaultsChanged()
+{
+    m_faultsDirty = true;
+    schedulePublish();
+}
+
+void FaultManager::schedulePublish()
+{
+    SignalCoalescer::instance()->schedule(this, [this]() {
+        publishChanges();
+    });
+}
+
+void FaultManager::publishChanges()
+{
+    // Properties and suppressed counts re-read once per frame, however
+    // many faults moved
+    if (!m_suppressionChanged.isEmpty()) {
+        const QSet<QString> roots = std::exchange(m_suppressionChanged, QSet<QString>());
+        const QList<FaultListModel*> models = m_models;
+        for (FaultListModel* model : models) {
+            model->suppressionChanged(roots);
+        }
+    }
+    
+    if (m_faultsDirty) {
+        m_faultsDirty = false;
+        emit faultsChanged();
+    }
+}
+
+void FaultManager::publishAdded(const FaultCode& fault)
+{
+    const QList<FaultListModel*> models = m_models;
+    for (FaultListModel* model : models) {
+        model->faultAdded(fault);
+    }
+}
+
+void FaultManager::publishRemoved(const FaultCode& fault)
+{
+    const QList<FaultListModel*> models = m_models;
+    for (FaultListModel* model : models) {
+        model->faultRemoved(fault.subsystemId, fault.code);
+    }
+}
+
+void FaultManager::reloadActiveModels()
+{
+    const QList<FaultListModel*> models = m_models;
+    for (FaultListModel* model : models) {
+        if (model->getSource() == FaultListModel::ActiveFaults) {
+            model->reload();
+        }
+    }
+}
+
 QString FaultManager::makeFaultKey(const QString& subsystemId, const QString& faultCode) const
 {
     return subsystemId + ":" + faultCode;
 }
 
+QMap<QString, FaultCode>::iterator FaultManager::subsystemBegin(const QString& subsystemId)
+{
+    // Keys sort by subsystem first, so a subsystem's faults are contiguous
+    return m_activeFaults.lowerBound(subsystemId + ":");
+}
+
+QString FaultManager::findRootCause(const QString& subsystemId) const
+{
+    if (m_dependencies.isEmpty() || m_rootFaultCounts.isEmpty()) {
+        return QString();
+    }
+    
+    // Nearest upstream with an active root fault
+    const QStringList upstream = m_dependencies.upstreamOf(subsystemId);
+    for (const QString& id : upstream) {
+        if (m_rootFaultCounts.value(id) > 0) {
+            return id;
+        }
+    }
+    return QString();
+}
+
+void FaultManager::account(const FaultCode& fault, int sign)
+{
+    auto bump = [sign](QHash<QString, int>& counts, const QString& key) {
+        auto it = counts.find(key);
+        if (it == counts.end()) {
+            it = counts.insert(key, 0);
+        }
+        *it += sign;
+        if (*it <= 0) {
+            counts.erase(it);
+        }
+    };
+    
+    if (fault.causedBy.isEmpty()) {
+        bump(m_rootFaultCounts, fault.subsystemId);
+    } else {
+        bump(m_consequentialCounts, fault.causedBy);
+        m_suppressedCount += sign;
+        
+        // Shown as the root row's suppressedCount
+        m_suppressionChanged.insert(fault.causedBy);
+        schedulePublish();
+    }
+}
+
+void FaultManager::setCause(FaultCode& fault, const QString& cause)
+{
+    account(fault, -1);
+    fault.causedBy = cause;
+    account(fault, +1);
+}
+
+void FaultManager::recordHistory(const FaultCode& fault)
+{
+    m_faultHistory.append(fault);
+    
+    // Update subsystem fault tracking
+    m_subsystemLastFault[fault.subsystemId] = fault.timestamp;
+    m_subsystemFaultCounts[fault.subsystemId]++;
+    
+    const QList<FaultListModel*> models = m_models;
+    for (FaultListModel* model : models) {
+        model->historyAppended(historyEnd() - 1);
+    }
+    
+    // Trim history if needed
+    if (m_faultHistory.size() > MAX_HISTORY_SIZE) {
+        while (m_faultHistory.size() > MAX_HISTORY_SIZE) {
+            m_faultHistory.removeFirst();
+            m_historyBase++;
+        }
+        for (FaultListModel* model : models) {
+            model->historyTrimmed(m_historyBase);
+        }
+    }
+}
+
+void FaultManager::announce(const FaultCode& fault)
+{
+    emit faultRegistered(fault.subsystemId, fault.code);
+    
+    if (fault.severity == FaultSeverity::CRITICAL || 
+        fault.severity == FaultSeverity::FATAL) {
+        emit criticalFaultOccurred(fault.subsystemId, fault.code);
+    }
+}
+
+void FaultManager::demoteDownstream(const QString& rootSubsystemId)
+{
+    // Everything active below the new root is now explained by it; no
+    // per-fault signal, demoted rows just leave the models
+    const QStringList downstream = m_dependencies.downstreamOf(rootSubsystemId);
+    for (const QString& subsystemId : downstream) {
+        const QString prefix = subsystemId + ":";
+        for (auto it = subsystemBegin(subsystemId);
+             it != m_activeFaults.end() && it.key().startsWith(prefix); ++it) {
+            const bool wasRoot = it.value().causedBy.isEmpty();
+            setCause(it.value(), rootSubsystemId);
+            if (wasRoot) {
+                publishRemoved(it.value());
+            }
+        }
+    }
+}
+
+void FaultManager::promoteDownstream(const QString& formerRootId)
+{
+    if (m_consequentialCounts.value(formerRootId) == 0) {
+        return;
+    }
+    
+    // Topological order: an upstream promoted here is already a root when
+    // its own downstream faults look for a cause
+    const QStringList downstream = m_dependencies.downstreamOf(formerRootId);
+    for (const QString& subsystemId : downstream) {
+        const QString prefix = subsystemId + ":";
+        for (auto it = subsystemBegin(subsystemId);
+             it != m_activeFaults.end() && it.key().startsWith(prefix); ++it) {
+            if (it.value().causedBy != formerRootId) {
+                continue;
+            }
+            setCause(it.value(), findRootCause(subsystemId));
+            if (it.value().causedBy.isEmpty()) {
+                recordHistory(it.value());
+                publishAdded(it.value());
+                announce(it.value());
+            }
+        }
+    }
+}
+
+void FaultManager::reclassifyAll()
+{
+    if (m_activeFaults.isEmpty()) {
+        return;
+    }
+    
+    QSet<QString> faulted;
+    for (const auto& fault : m_activeFaults) {
+        faulted.insert(fault.subsystemId);
+    }
+    
+    // A subsystem is a root if none of its upstreams has faults at all;
+    // anything else is explained by its nearest such root
+    QHash<QString, QString> causes;
+    auto isRoot = [this, &faulted](const QString& subsystemId) {
+        const QStringList upstream = m_dependencies.upstreamOf(subsystemId);
+        for (const QString& id : upstream) {
+            if (faulted.contains(id)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (const QString& subsystemId : faulted) {
+        QString cause;
+        if (!isRoot(subsystemId)) {
+            const QStringList upstream = m_dependencies.upstreamOf(subsystemId);
+            for (const QString& id : upstream) {
+                if (faulted.contains(id) && isRoot(id)) {
+                    cause = id;
+                    break;
+                }
+            }
+        }
+        causes.insert(subsystemId, cause);
+    }
+    
+    for (auto it = m_activeFaults.begin(); it != m_activeFaults.end(); ++it) {
+        setCause(it.value(), causes.value(it.value().subsystemId));
+    }
+    
+    reloadActiveModels();
+    notifyFaultsChanged();
+}
+
 } // namespace RadarRMP
@@ -0,0 +1,387 @@
+#include "core/FleetStore.h"
+#include "core/RadarSubsystem.h"
+#include "core/SignalCoalescer.h"
+#include "core/TelemetryData.h"
+#include <QtAlgorithms>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace RadarRMP {
+
+namespace {
+
+constexpr int SUBSYSTEM_TYPE_COUNT = static_cast<int>(SubsystemType::NetworkInterface) + 1;
+
+double limitOrNaN(const QVariant& limit)
+{
+    return limit.isValid() ? limit.toDouble() : std::numeric_limits<double>::quiet_NaN();
+}
+
+bool isNumeric(const QVariant& value)
+{
+    switch (value.userType()) {
+        case QMetaType::Double:
+        case QMetaType::Float:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// FleetSubsystemView
+// ============================================================================
+
+FleetSubsystemView::FleetSubsystemView(FleetStore* store, int index)
+    : QObject(store)
+    , m_store(store)
+    , m_index(index)
+    , m_refCount(0)
+{
+}
+
+QString FleetSubsystemView::getId() const
+{
+    return m_store->id(m_index);
+}
+
+QString FleetSubsystemView::getTypeName() const
+{
+    return subsystemTypeToString(m_store->type(m_index));
+}
+
+QString FleetSubsystemView::getHealthStateString() const
+{
+    return healthStateToString(m_store->state(m_index));
+}
+
+double FleetSubsystemView::getHealthScore() const
+{
+    return m_store->score(m_index);
+}
+
+QVariantMap FleetSubsystemView::getTelemetry() const
+{
+    const FleetStore::ParameterLayout& layout = m_store->layout(m_store->type(m_index));
+    const double* values = m_store->values(m_index);
+
+    QVariantMap telemetry;
+    for (int p = 0; p < layout.size(); ++p) {
+        telemetry[layout.names.at(p)] = values[p];
+    }
+    return telemetry;
+}
+
+int FleetSubsystemView::getAlarmCount() const
+{
+    return qPopulationCount(m_store->warningBits(m_index) | m_store->criticalBits(m_index));
+}
+
+// ============================================================================
+// FleetStore
+// ============================================================================
+
+FleetStore::FleetStore(int parameterStride, QObject* parent)
+    : QObject(parent)
+    , m_stride(qBound(1, parameterStride, MAX_PARAMETER_STRIDE))
+    , m_layouts(SUBSYSTEM_TYPE_COUNT)
+    , m_typeInstanceCounts(SUBSYSTEM_TYPE_COUNT, 0)
+    , m_healthyCount(0)
+    , m_degradedCount(0)
+    , m_failedCount(0)
+{
+}
+
+void FleetStore::defineLayout(SubsystemType type, const RadarSubsystem* prototype)
+{
+    if (!prototype) {
+        return;
+    }
+
+    ParameterLayout layout;
+    layout.idPrefix = prototype->getId().section('-', 0, 0);
+
+    // Numeric parameters only, capped at the stride; names come back in
+    // registration order, which is the same for every instance of a type
+    for (const QString& name : prototype->getTelemetryParameters()) {
+        if (layout.size() >= m_stride) {
+            break;
+        }
+
+        QVariantMap meta = prototype->getTelemetryMetadata(name);
+        if (!isNumeric(meta.value("value"))) {
+            continue;
+        }
+
+        layout.names.append(name);
+        layout.units.append(meta.value("unit").toString());
+        layout.warningLow.append(limitOrNaN(meta.value("warningLow")));
+        layout.warningHigh.append(limitOrNaN(meta.value("warningHigh")));
+        layout.criticalLow.append(limitOrNaN(meta.value("criticalLow")));
+        layout.criticalHigh.append(limitOrNaN(meta.value("criticalHigh")));
+    }
+
+    m_layouts[static_cast<int>(type)] = layout;
+}
+
+const FleetStore::ParameterLayout& FleetStore::layout(SubsystemType type) const
+{
+    return m_layouts.at(static_cast<int>(type));
+}
+
+void FleetStore::reserve(int subsystemCount)
+{
+    m_ids.reserve(subsystemCount);
+    m_types.reserve(subsystemCount);
+    m_states.reserve(subsystemCount);
+    m_scores.reserve(subsystemCount);
+    m_warningBits.reserve(subsystemCount);
+    m_criticalBits.reserve(subsystemCount);
+    m_dirty.reserve(subsystemCount);
+    m_values.reserve(subsystemCount * m_stride);
+    m_indexById.reserve(subsystemCount);
+}
+
+int FleetStore::addSubsystem(const QString& id, SubsystemType type)
+{
+    if (m_indexById.contains(id)) {
+        return m_indexById.value(id);
+    }
+
+    int index = m_ids.size();
+
+    m_ids.append(id);
+    m_types.append(type);
+    m_states.append(static_cast<quint8>(HealthState::UNKNOWN));
+    m_scores.append(100.0);
+    m_warningBits.append(0);
+    m_criticalBits.append(0);
+    m_dirty.append(0);
+    m_values.resize(m_values.size() + m_stride);
+    m_indexById.insert(id, index);
+    m_typeInstanceCounts[static_cast<int>(type)]++;
+
+    // Unused stride slots stay NaN and are skipped by evaluate()
+    double* row = m_values.data() + index * m_stride;
+    std::fill(row, row + m_stride, std::numeric_limits<double>::quiet_NaN());
+
+    evaluate(index);
+    emit countChanged();
+
+    return index;
+}
+
+int FleetStore::populate(SubsystemType type, int instanceCount)
+{
+    const ParameterLayout& typeLayout = layout(type);
+    QString prefix = typeLayout.idPrefix.isEmpty() ? subsystemTypeToString(type) : typeLayout.idPrefix;
+
+    reserve(count() + instanceCount);
+
+    int first = count();
+    for (int i = 0; i < instanceCount; ++i) {
+        int serial = m_typeInstanceCounts.at(static_cast<int>(type)) + 1;
+        addSubsystem(QString("%1-%2").arg(prefix).arg(serial, 5, 10, QChar('0')), type);
+    }
+    return first;
+}
+
+int FleetStore::indexOf(const QString& id) const
+{
+    return m_indexById.value(id, -1);
+}
+
+void FleetStore::setValues(int index, const double* values, int valueCount)
+{
+    if (index < 0 || index >= count()) {
+        return;
+    }
+
+    double* row = m_values.data() + index * m_stride;
+    std::copy(values, values + qMin(valueCount, m_stride), row);
+
+    evaluate(index);
+}
+
+void FleetStore::setValues(int index, const QVariantMap& values)
+{
+    if (index < 0 || index >= count()) {
+        return;
+    }
+
+    const ParameterLayout& typeLayout = layout(m_types.at(index));
+    double* row = m_values.data() + index * m_stride;
+
+    for (auto it = values.begin(); it != values.end(); ++it) {
+        int p = typeLayout.indexOf(it.key());
+        if (p >= 0 && it.value().canConvert<double>()) {
+            row[p] = it.value().toDouble();
+        }
+    }
+
+    evaluate(index);
+}
+
+void FleetStore::setValue(int index, int parameter, double value)
+{
+    if (index < 0 || index >= count() || parameter < 0 || parameter >= m_stride) {
+        return;
+    }
+
+    m_values[index * m_stride + parameter] = value;
+    evaluate(index);
+}
+
+void FleetStore::evaluate(int index)
+{
+    const ParameterLayout& typeLayout = layout(m_types.at(index));
+    const double* row = m_values.constData() + index * m_stride;
+
+    quint32 warning = 0;
+    quint32 critical = 0;
+    double score = 100.0;
+    int evaluated = 0;
+
+    // Comparisons against a NaN limit are false, so absent limits need no branch
+    for (int p = 0; p < typeLayout.size(); ++p) {
+        double v = row[p];
+        if (std::isnan(v)) {
+            continue;
+        }
+        evaluated++;
+
+        if (TelemetryParameterInfo::belowLimit(v, typeLayout.criticalLow.at(p))
+            || TelemetryParameterInfo::aboveLimit(v, typeLayout.criticalHigh.at(p))) {
+            critical |= (1u << p);
+            score -= 30;
+        } else if (TelemetryParameterInfo::belowLimit(v, typeLayout.warningLow.at(p))
+                   || TelemetryParameterInfo::aboveLimit(v, typeLayout.warningHigh.at(p))) {
+            warning |= (1u << p);
+            score -= 10;
+        }
+    }
+
+    // A row nothing has been written to yet has no health to report
+    HealthState newState = evaluated == 0 ? HealthState::UNKNOWN
+                         : critical ? HealthState::FAIL
+                         : warning ? HealthState::DEGRADED
+                         : HealthState::OK;
+    HealthState oldState = static_cast<HealthState>(m_states.at(index));
+
+    if (newState != oldState) {
+        adjustStateCounts(oldState, -1);
+        adjustStateCounts(newState, +1);
+        m_states[index] = static_cast<quint8>(newState);
+    }
+
+    m_scores[index] = qMax(0.0, score);
+    m_warningBits[index] = warning;
+    m_criticalBits[index] = critical;
+
+    markDirty(index);
+}
+
+void FleetStore::adjustStateCounts(HealthState state, int delta)
+{
+    switch (state) {
+        case HealthState::OK:
+            m_healthyCount += delta;
+            break;
+        case HealthState::DEGRADED:
+            m_degradedCount += delta;
+            break;
+        case HealthState::FAIL:
+            m_failedCount += delta;
+            break;
+        default:
+            break;
+    }
+}
+
+void FleetStore::markDirty(int index)
+{
+    if (!m_dirty.at(index)) {
+        m_dirty[index] = 1;
+        m_dirtyList.append(index);
+        
+        if (m_dirtyList.size() == 1) {
+            SignalCoalescer::instance()->schedule(this, [this]() {
+                publishChanges();
+            });
+        }
+    }
+}
+
+FleetSubsystemView* FleetStore::acquireView(int index)
+{
+    if (index < 0 || index >= count()) {
+        return nullptr;
+    }
+
+    FleetSubsystemView* view = m_views.value(index, nullptr);
+    if (!view) {
+        view = new FleetSubsystemView(this, index);
+        m_views.insert(index, view);
+    }
+    view->m_refCount++;
+    return view;
+}
+
+FleetSubsystemView* FleetStore::acquireViewById(const QString& id)
+{
+    return acquireView(indexOf(id));
+}
+
+void FleetStore::releaseView(int index)
+{
+    auto it = m_views.find(index);
+    if (it == m_views.end()) {
+        return;
+    }
+
+    FleetSubsystemView* view = it.value();
+    if (--view->m_refCount <= 0) {
+        m_views.erase(it);
+        view->deleteLater();
+    }
+}
+
+QVariantMap FleetStore::getSummary() const
+{
+    QVariantMap summary;
+    summary["count"] = count();
+    summary["healthyCount"] = m_healthyCount;
+    summary["degradedCount"] = m_degradedCount;
+    summary["failedCount"] = m_failedCount;
+    summary["parameterStride"] = m_stride;
+    summary["viewCount"] = m_views.size();
+    return summary;
+}
+
+void FleetStore::publishChanges()
+{
+    if (m_dirtyList.isEmpty()) {
+        return;
+    }
+
+    int changed = m_dirtyList.size();
+
+    for (int index : std::as_const(m_dirtyList)) {
+        m_dirty[index] = 0;
+        if (FleetSubsystemView* view = m_views.value(index, nullptr)) {
+            emit view->changed();
+        }
+    }
+    m_dirtyList.clear();
+
+    emit fleetChanged(changed);
+}
+
+} // namespace RadarRMP
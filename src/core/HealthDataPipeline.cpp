@@ -1,4 +1,5 @@
 #include "core/HealthDataPipeline.h"
+#include "core/TelemetryData.h"
 #include <QTimer>
 #include <QThread>
 #include <cmath>
@@ -62,7 +63,7 @@ void HealthDataPipeline::submitData(const QString& subsystemId, const QVariantMa
     QueueItem item;
     item.subsystemId = subsystemId;
     item.data = data;
-    item.timestamp = QDateTime::currentMSecsSinceEpoch();
+    item.timestamp = Timestamp::now();
     
     m_dataQueue.enqueue(item);
     emit queueChanged();
@@ -76,7 +77,7 @@ void HealthDataPipeline::submitBatchData(const QVariantMap& batchData)
         QueueItem item;
         item.subsystemId = it.key();
         item.data = it.value().toMap();
-        item.timestamp = QDateTime::currentMSecsSinceEpoch();
+        item.timestamp = Timestamp::now();
         m_dataQueue.enqueue(item);
     }
     
@@ -362,16 +363,16 @@ HealthState HealthDataPipeline::computeHealthState(const QVariantMap& data,
             QVariantMap paramThresholds = thresholds[param].toMap();
             
             if (paramThresholds.contains("criticalHigh") && 
-                value > paramThresholds["criticalHigh"].toDouble()) {
+                TelemetryParameterInfo::aboveLimit(value, paramThresholds["criticalHigh"].toDouble())) {
                 hasCritical = true;
             } else if (paramThresholds.contains("criticalLow") && 
-                       value < paramThresholds["criticalLow"].toDouble()) {
+                       TelemetryParameterInfo::belowLimit(value, paramThresholds["criticalLow"].toDouble())) {
                 hasCritical = true;
             } else if (paramThresholds.contains("warningHigh") && 
-                       value > paramThresholds["warningHigh"].toDouble()) {
+                       TelemetryParameterInfo::aboveLimit(value, paramThresholds["warningHigh"].toDouble())) {
                 hasWarning = true;
             } else if (paramThresholds.contains("warningLow") && 
-                       value < paramThresholds["warningLow"].toDouble()) {
+                       TelemetryParameterInfo::belowLimit(value, paramThresholds["warningLow"].toDouble())) {
                 hasWarning = true;
             }
         }
@@ -439,6 +440,7 @@ QList<FaultCode> HealthDataPipeline::detectFaults(const QString& subsystemId,
                                                     const QVariantMap& thresholds) const
 {
     QList<FaultCode> faults;
+    const Timestamp now = Timestamp::now();
     
     for (auto it = data.begin(); it != data.end(); ++it) {
         if (!it.value().canConvert<double>()) {
@@ -452,25 +454,25 @@ QList<FaultCode> HealthDataPipeline::detectFaults(const QString& subsystemId,
             QVariantMap paramThresholds = thresholds[param].toMap();
             
             if (paramThresholds.contains("criticalHigh") && 
-                value > paramThresholds["criticalHigh"].toDouble()) {
+                TelemetryParameterInfo::aboveLimit(value, paramThresholds["criticalHigh"].toDouble())) {
                 FaultCode fault;
                 fault.code = param.toUpper() + "-HIGH";
                 fault.description = param + " exceeded critical threshold";
                 fault.severity = FaultSeverity::CRITICAL;
                 fault.subsystemId = subsystemId;
-                fault.timestamp = QDateTime::currentDateTime();
+                fault.timestamp = now;
                 fault.active = true;
                 faults.append(fault);
             }
             
             if (paramThresholds.contains("criticalLow") && 
-                value < paramThresholds["criticalLow"].toDouble()) {
+                TelemetryParameterInfo::belowLimit(value, paramThresholds["criticalLow"].toDouble())) {
                 FaultCode fault;
                 fault.code = param.toUpper() + "-LOW";
                 fault.description = param + " below critical threshold";
                 fault.severity = FaultSeverity::CRITICAL;
                 fault.subsystemId = subsystemId;
-                fault.timestamp = QDateTime::currentDateTime();
+                fault.timestamp = now;
                 fault.active = true;
                 faults.append(fault);
             }
@@ -0,0 +1,422 @@
+#include "core/HealthRollup.h"
+#include <QDebug>
+
+namespace RadarRMP {
+
+HealthRollup::HealthRollup(QObject* parent)
+    : QObject(parent)
+{
+}
+
+bool HealthRollup::addNode(const QString& id, const QString& name, const QString& parentId,
+                           RollupFunction function, int quorum, double weight)
+{
+    if (id.isEmpty() || m_nodeIndex.contains(id)) {
+        return false;
+    }
+
+    int parentIndex = -1;
+    if (!parentId.isEmpty()) {
+        parentIndex = m_nodeIndex.value(parentId, -1);
+        if (parentIndex < 0) {
+            qWarning() << "HealthRollup: unknown parent" << parentId << "for" << id;
+            return false;
+        }
+    }
+
+    const int index = allocate(id, parentIndex, false, weight);
+    Node& node = m_nodes[index];
+    node.name = name.isEmpty() ? id : name;
+    node.function = function;
+    node.quorum = qMax(1, quorum);
+    m_nodeIndex.insert(id, index);
+
+    propagateFrom(index);
+    emit structureChanged();
+    return true;
+}
+
+void HealthRollup::removeNode(const QString& id)
+{
+    const int index = m_nodeIndex.value(id, -1);
+    if (index < 0) {
+        return;
+    }
+
+    const int parentIndex = m_nodes.at(index).parent;
+    release(index);
+    if (parentIndex >= 0) {
+        propagateFrom(parentIndex);
+    }
+    emit structureChanged();
+}
+
+bool HealthRollup::setRollupFunction(const QString& id, RollupFunction function, int quorum)
+{
+    const int index = m_nodeIndex.value(id, -1);
+    if (index < 0) {
+        return false;
+    }
+
+    m_nodes[index].function = function;
+    m_nodes[index].quorum = qMax(1, quorum);
+    propagateFrom(index);
+    return true;
+}
+
+bool HealthRollup::setScoreThresholds(const QString& id, double degradedBelow, double failBelow)
+{
+    const int index = m_nodeIndex.value(id, -1);
+    if (index < 0 || failBelow > degradedBelow) {
+        return false;
+    }
+
+    m_nodes[index].degradedBelow = degradedBelow;
+    m_nodes[index].failBelow = failBelow;
+    propagateFrom(index);
+    return true;
+}
+
+bool HealthRollup::attachLeaf(const QString& subsystemId, const QString& parentId, double weight)
+{
+    const int parentIndex = m_nodeIndex.value(parentId, -1);
+    if (subsystemId.isEmpty() || parentIndex < 0) {
+        return false;
+    }
+
+    detachLeaf(subsystemId);
+
+    const int index = allocate(subsystemId, parentIndex, true, weight);
+    m_leafIndex.insert(subsystemId, index);
+    propagateFrom(parentIndex);
+    emit structureChanged();
+    return true;
+}
+
+void HealthRollup::detachLeaf(const QString& subsystemId)
+{
+    const int index = m_leafIndex.value(subsystemId, -1);
+    if (index < 0) {
+        return;
+    }
+
+    const int parentIndex = m_nodes.at(index).parent;
+    release(index);
+    propagateFrom(parentIndex);
+    emit structureChanged();
+}
+
+bool HealthRollup::hasLeaf(const QString& subsystemId) const
+{
+    return m_leafIndex.contains(subsystemId);
+}
+
+void HealthRollup::updateLeaf(const QString& subsystemId, HealthState state, double score, bool scored)
+{
+    const int index = m_leafIndex.value(subsystemId, -1);
+    if (index < 0) {
+        return;
+    }
+
+    Node& leaf = m_nodes[index];
+    leaf.state = state;
+    leaf.score = score;
+    leaf.scored = scored;
+    propagateFrom(index);
+}
+
+bool HealthRollup::hasNode(const QString& id) const
+{
+    return m_nodeIndex.contains(id);
+}
+
+HealthState HealthRollup::nodeState(const QString& id) const
+{
+    const int index = m_nodeIndex.value(id, -1);
+    return index >= 0 ? m_nodes.at(index).state : HealthState::UNKNOWN;
+}
+
+double HealthRollup::nodeScore(const QString& id) const
+{
+    const int index = m_nodeIndex.value(id, -1);
+    return index >= 0 ? m_nodes.at(index).score : 100.0;
+}
+
+bool HealthRollup::addNodeVariant(const QVariantMap& spec)
+{
+    return addNode(spec.value("id").toString(),
+                   spec.value("name").toString(),
+                   spec.value("parent").toString(),
+                   rollupFunctionFromString(spec.value("function").toString()),
+                   spec.value("quorum", 1).toInt(),
+                   spec.value("weight", 1.0).toDouble());
+}
+
+QVariantMap HealthRollup::getNodeSummary(const QString& id) const
+{
+    QVariantMap summary;
+    const int index = m_nodeIndex.value(id, -1);
+    if (index < 0) {
+        return summary;
+    }
+
+    const Node& node = m_nodes.at(index);
+    summary["id"] = node.id;
+    summary["name"] = node.name;
+    summary["parent"] = node.parent >= 0 ? m_nodes.at(node.parent).id : QString();
+    summary["function"] = rollupFunctionToString(node.function);
+    summary["quorum"] = node.quorum;
+    summary["state"] = healthStateToString(node.state);
+    summary["score"] = node.score;
+    summary["childCount"] = node.children.size();
+    summary["healthyCount"] = node.stateCounts[static_cast<int>(HealthState::OK)];
+    summary["degradedCount"] = node.stateCounts[static_cast<int>(HealthState::DEGRADED)];
+    summary["failedCount"] = node.stateCounts[static_cast<int>(HealthState::FAIL)];
+    summary["unknownCount"] = node.stateCounts[static_cast<int>(HealthState::UNKNOWN)];
+    return summary;
+}
+
+QStringList HealthRollup::getRootNodes() const
+{
+    QStringList roots;
+    for (auto it = m_nodeIndex.constBegin(); it != m_nodeIndex.constEnd(); ++it) {
+        if (m_nodes.at(it.value()).parent < 0) {
+            roots.append(it.key());
+        }
+    }
+    roots.sort();
+    return roots;
+}
+
+QStringList HealthRollup::getChildNodes(const QString& id) const
+{
+    const int index = m_nodeIndex.value(id, -1);
+    return index >= 0 ? idsOf(m_nodes.at(index).children, false) : QStringList();
+}
+
+QStringList HealthRollup::getLeaves(const QString& id) const
+{
+    const int index = m_nodeIndex.value(id, -1);
+    return index >= 0 ? idsOf(m_nodes.at(index).children, true) : QStringList();
+}
+
+QString HealthRollup::getParentNode(const QString& id) const
+{
+    int index = m_nodeIndex.value(id, -1);
+    if (index < 0) {
+        index = m_leafIndex.value(id, -1);
+    }
+    if (index < 0 || m_nodes.at(index).parent < 0) {
+        return QString();
+    }
+    return m_nodes.at(m_nodes.at(index).parent).id;
+}
+
+QString HealthRollup::getNodeStateString(const QString& id) const
+{
+    return healthStateToString(nodeState(id));
+}
+
+QString HealthRollup::rollupFunctionToString(RollupFunction function)
+{
+    switch (function) {
+        case WorstOf: return "worst";
+        case WeightedMean: return "mean";
+        case KOfN: return "kofn";
+        default: return "worst";
+    }
+}
+
+HealthRollup::RollupFunction HealthRollup::rollupFunctionFromString(const QString& text)
+{
+    const QString lower = text.toLower();
+    if (lower == "mean") return WeightedMean;
+    if (lower == "kofn") return KOfN;
+    return WorstOf;
+}
+
+int HealthRollup::allocate(const QString& id, int parentIndex, bool leaf, double weight)
+{
+    int index;
+    if (!m_freeNodes.isEmpty()) {
+        index = m_freeNodes.takeLast();
+        m_nodes[index] = Node();
+    } else {
+        index = m_nodes.size();
+        m_nodes.append(Node());
+    }
+
+    Node& node = m_nodes[index];
+    node.id = id;
+    node.parent = parentIndex;
+    node.leaf = leaf;
+    node.weight = qMax(0.0, weight);
+
+    // Fold the initial (UNKNOWN, unscored) value in so every later change
+    // is a plain swap of reported values
+    if (parentIndex >= 0) {
+        Node& parent = m_nodes[parentIndex];
+        parent.children.append(index);
+        contribute(parent, node, +1);
+    }
+    return index;
+}
+
+void HealthRollup::release(int index)
+{
+    Node& node = m_nodes[index];
+
+    // Children first; their contributions vanish with this node anyway
+    const QVector<int> children = node.children;
+    for (int child : children) {
+        m_nodes[child].parent = -1;
+        release(child);
+    }
+
+    Node& released = m_nodes[index];
+    if (released.parent >= 0) {
+        Node& parent = m_nodes[released.parent];
+        contribute(parent, released, -1);
+        parent.children.removeOne(index);
+    }
+
+    if (released.leaf) {
+        m_leafIndex.remove(released.id);
+    } else {
+        m_nodeIndex.remove(released.id);
+    }
+    released = Node();
+    m_freeNodes.append(index);
+}
+
+void HealthRollup::contribute(Node& parent, const Node& child, int sign) const
+{
+    parent.stateCounts[static_cast<int>(child.reportedState)] += sign;
+
+    if (child.reportedScored) {
+        parent.weightedScoreSum += sign * child.weight * child.reportedScore;
+        parent.scoredWeight += sign * child.weight;
+
+        // Drop accumulated rounding error whenever the sum empties
+        if (parent.scoredWeight <= 0.0) {
+            parent.weightedScoreSum = 0.0;
+            parent.scoredWeight = 0.0;
+        }
+    }
+}
+
+bool HealthRollup::evaluate(Node& node) const
+{
+    const int ok = node.stateCounts[static_cast<int>(HealthState::OK)];
+    const int degraded = node.stateCounts[static_cast<int>(HealthState::DEGRADED)];
+    const int failed = node.stateCounts[static_cast<int>(HealthState::FAIL)];
+    const int total = node.children.size();
+
+    const bool scored = node.scoredWeight > 0.0;
+    const double score = scored ? node.weightedScoreSum / node.scoredWeight : 100.0;
+
+    HealthState state;
+    switch (node.function) {
+        case WeightedMean:
+            if (!scored) {
+                state = HealthState::UNKNOWN;
+            } else if (score < node.failBelow) {
+                state = HealthState::FAIL;
+            } else if (score < node.degradedBelow) {
+                state = HealthState::DEGRADED;
+            } else {
+                state = HealthState::OK;
+            }
+            break;
+
+        case KOfN:
+            if (ok + degraded + failed == 0) {
+                state = HealthState::UNKNOWN;
+            } else if (ok + degraded < node.quorum) {
+                state = HealthState::FAIL;
+            } else if (ok < total) {
+                state = HealthState::DEGRADED;      // Redundancy reduced
+            } else {
+                state = HealthState::OK;
+            }
+            break;
+
+        case WorstOf:
+        default:
+            if (failed > 0) {
+                state = HealthState::FAIL;
+            } else if (degraded > 0) {
+                state = HealthState::DEGRADED;
+            } else if (ok > 0) {
+                state = HealthState::OK;
+            } else {
+                state = HealthState::UNKNOWN;
+            }
+            break;
+    }
+
+    const bool changed = state != node.state || qAbs(score - node.score) > 0.01
+                         || scored != node.scored;
+    node.state = state;
+    node.score = score;
+    node.scored = scored;
+    return changed;
+}
+
+bool HealthRollup::differsFromReported(const Node& node) const
+{
+    return node.state != node.reportedState
+           || node.scored != node.reportedScored
+           || qAbs(node.score - node.reportedScore) > 0.01;
+}
+
+void HealthRollup::propagateFrom(int index)
+{
+    QStringList changed;
+
+    // Walk the ancestor path only while values actually move
+    int current = index;
+    while (current >= 0) {
+        Node& node = m_nodes[current];
+        if (!node.leaf && evaluate(node)) {
+            changed.append(node.id);
+        }
+
+        if (node.parent < 0 || !differsFromReported(node)) {
+            break;
+        }
+
+        Node& parent = m_nodes[node.parent];
+        contribute(parent, node, -1);
+        node.reportedState = node.state;
+        node.reportedScore = node.score;
+        node.reportedScored = node.scored;
+        contribute(parent, node, +1);
+
+        current = node.parent;
+    }
+
+    emitChanged(changed);
+}
+
+void HealthRollup::emitChanged(const QStringList& changed)
+{
+    // After the walk, so handlers see a consistent tree
+    for (const QString& id : changed) {
+        emit nodeChanged(id);
+    }
+}
+
+QStringList HealthRollup::idsOf(const QVector<int>& indices, bool leaves) const
+{
+    QStringList ids;
+    for (int index : indices) {
+        const Node& node = m_nodes.at(index);
+        if (node.leaf == leaves) {
+            ids.append(node.id);
+        }
+    }
+    return ids;
+}
+
+} // namespace RadarRMP
@@ -0,0 +1,435 @@
+#include "core/HealthRuleEngine.h"
+#include "core/TelemetryData.h"
+#include <cmath>
+
+namespace RadarRMP {
+
+namespace {
+
+constexpr double NO_LOW = -std::numeric_limits<double>::infinity();
+constexpr double NO_HIGH = std::numeric_limits<double>::infinity();
+
+QString kindToString(HealthRule::Kind kind)
+{
+    switch (kind) {
+        case HealthRule::Kind::Threshold: return "threshold";
+        case HealthRule::Kind::RateOfChange: return "rateOfChange";
+        case HealthRule::Kind::Boolean: return "boolean";
+        case HealthRule::Kind::Combination: return "combination";
+    }
+    return "threshold";
+}
+
+HealthRule::Kind kindFromString(const QString& kind)
+{
+    if (kind == "rateOfChange") return HealthRule::Kind::RateOfChange;
+    if (kind == "boolean") return HealthRule::Kind::Boolean;
+    if (kind == "combination") return HealthRule::Kind::Combination;
+    return HealthRule::Kind::Threshold;
+}
+
+QString boundToString(HealthRule::Bound bound)
+{
+    switch (bound) {
+        case HealthRule::Bound::Low: return "low";
+        case HealthRule::Bound::High: return "high";
+        default: return "both";
+    }
+}
+
+HealthRule::Bound boundFromString(const QString& bound)
+{
+    if (bound == "low") return HealthRule::Bound::Low;
+    if (bound == "high") return HealthRule::Bound::High;
+    return HealthRule::Bound::Both;
+}
+
+FaultSeverity faultSeverityFromString(const QString& severity)
+{
+    for (FaultSeverity s : { FaultSeverity::INFO, FaultSeverity::WARNING,
+                             FaultSeverity::CRITICAL, FaultSeverity::FATAL }) {
+        if (faultSeverityToString(s) == severity) {
+            return s;
+        }
+    }
+    return FaultSeverity::CRITICAL;
+}
+
+// Explicit rule limit, else the telemetry limit, else "no limit"
+double resolveLimit(double ruleLimit, const TelemetryParameterInfo& info,
+                    TelemetryParameterInfo::Limit limit, double none)
+{
+    if (!std::isnan(ruleLimit)) {
+        return ruleLimit;
+    }
+    return info.limitOr(limit, none);
+}
+
+double optionalLimit(const QVariantMap& map, const QString& key)
+{
+    return map.contains(key) ? map.value(key).toDouble() : std::numeric_limits<double>::quiet_NaN();
+}
+
+// Fraction of the way from the warning limit to the critical limit
+double bandFraction(double distance, double width)
+{
+    if (!std::isfinite(width) || width <= 0.0) {
+        return 1.0;
+    }
+    return qBound(0.0, distance / width, 1.0);
+}
+
+} // namespace
+
+// ============================================================================
+// HealthRule
+// ============================================================================
+
+HealthRule HealthRule::threshold(const QString& parameter, double criticalPenalty, double warningPenalty)
+{
+    HealthRule rule;
+    rule.id = parameter;
+    rule.kind = Kind::Threshold;
+    rule.parameter = parameter;
+    rule.criticalPenalty = criticalPenalty;
+    rule.warningPenalty = warningPenalty;
+    return rule;
+}
+
+HealthRule HealthRule::rateOfChange(const QString& parameter, double warningRate, double criticalRate)
+{
+    HealthRule rule;
+    rule.id = parameter + "Rate";
+    rule.kind = Kind::RateOfChange;
+    rule.parameter = parameter;
+    rule.warningHigh = warningRate;
+    rule.criticalHigh = criticalRate;
+    return rule;
+}
+
+HealthRule HealthRule::boolean(const QString& parameter, bool expected, Level level)
+{
+    HealthRule rule;
+    rule.id = parameter;
+    rule.kind = Kind::Boolean;
+    rule.parameter = parameter;
+    rule.expected = expected;
+    rule.level = level;
+    return rule;
+}
+
+HealthRule HealthRule::combination(const QString& id, Combine combine, const QStringList& operands)
+{
+    HealthRule rule;
+    rule.id = id;
+    rule.kind = Kind::Combination;
+    rule.combine = combine;
+    rule.operands = operands;
+    return rule;
+}
+
+QVariantMap HealthRule::toVariantMap() const
+{
+    QVariantMap map;
+    map["id"] = id;
+    map["kind"] = kindToString(kind);
+    if (!parameter.isEmpty()) map["parameter"] = parameter;
+    if (!ratioOf.isEmpty()) map["ratioOf"] = ratioOf;
+    map["bound"] = boundToString(bound);
+    map["inclusive"] = inclusive;
+    if (!std::isnan(warningLow)) map["warningLow"] = warningLow;
+    if (!std::isnan(warningHigh)) map["warningHigh"] = warningHigh;
+    if (!std::isnan(criticalLow)) map["criticalLow"] = criticalLow;
+    if (!std::isnan(criticalHigh)) map["criticalHigh"] = criticalHigh;
+    map["expected"] = expected;
+    map["level"] = (level == Warning) ? "warning" : "critical";
+    map["combine"] = (combine == Combine::Any) ? "any" : "all";
+    if (!operands.isEmpty()) map["operands"] = operands;
+    map["affectsHealth"] = affectsHealth;
+    map["warningPenalty"] = warningPenalty;
+    map["criticalPenalty"] = criticalPenalty;
+    if (!faultCode.isEmpty()) {
+        map["faultCode"] = faultCode;
+        map["faultDescription"] = faultDescription;
+        map["faultSeverity"] = faultSeverityToString(faultSeverity);
+    }
+    if (!warningMessage.isEmpty()) map["warningMessage"] = warningMessage;
+    if (!criticalMessage.isEmpty()) map["criticalMessage"] = criticalMessage;
+    map["precision"] = precision;
+    return map;
+}
+
+HealthRule HealthRule::fromVariantMap(const QVariantMap& map)
+{
+    HealthRule rule;
+    rule.kind = kindFromString(map.value("kind").toString());
+    rule.parameter = map.value("parameter").toString();
+    rule.id = map.value("id", rule.parameter).toString();
+    rule.ratioOf = map.value("ratioOf").toString();
+    rule.bound = boundFromString(map.value("bound").toString());
+    rule.inclusive = map.value("inclusive", true).toBool();
+    rule.warningLow = optionalLimit(map, "warningLow");
+    rule.warningHigh = optionalLimit(map, "warningHigh");
+    rule.criticalLow = optionalLimit(map, "criticalLow");
+    rule.criticalHigh = optionalLimit(map, "criticalHigh");
+    rule.expected = map.value("expected", true).toBool();
+    rule.level = (map.value("level").toString() == "warning") ? Warning : Critical;
+    rule.combine = (map.value("combine").toString() == "any") ? Combine::Any : Combine::All;
+    rule.operands = map.value("operands").toStringList();
+    rule.affectsHealth = map.value("affectsHealth", true).toBool();
+    rule.warningPenalty = map.value("warningPenalty", 0.0).toDouble();
+    rule.criticalPenalty = map.value("criticalPenalty", 0.0).toDouble();
+    rule.faultCode = map.value("faultCode").toString();
+    rule.faultDescription = map.value("faultDescription").toString();
+    rule.faultSeverity = faultSeverityFromString(map.value("faultSeverity").toString());
+    rule.warningMessage = map.value("warningMessage").toString();
+    rule.criticalMessage = map.value("criticalMessage").toString();
+    rule.precision = map.value("precision", 1).toInt();
+    return rule;
+}
+
+// ============================================================================
+// HealthRuleProgram
+// ============================================================================
+
+int HealthRuleProgram::internParameter(const QString& name)
+{
+    auto it = m_parameterIndex.constFind(name);
+    if (it != m_parameterIndex.constEnd()) {
+        return it.value();
+    }
+    int index = m_parameters.size();
+    m_parameters.append(name);
+    m_parameterIndex.insert(name, index);
+    return index;
+}
+
+HealthRuleProgram HealthRuleProgram::compile(const QList<HealthRule>& rules,
+                                             const TelemetryData* telemetry,
+                                             QStringList* errors)
+{
+    HealthRuleProgram program;
+    QHash<QString, int> ruleIndex;
+
+    auto reject = [errors](const HealthRule& rule, const QString& reason) {
+        if (errors) {
+            errors->append(QString("Rule '%1': %2").arg(rule.id, reason));
+        }
+    };
+
+    for (const HealthRule& rule : rules) {
+        if (rule.id.isEmpty() || ruleIndex.contains(rule.id)) {
+            reject(rule, "missing or duplicate id");
+            continue;
+        }
+
+        Instruction ins;
+        ins.kind = rule.kind;
+        ins.combine = rule.combine;
+        ins.level = rule.level;
+        ins.inclusive = rule.inclusive;
+        ins.affectsHealth = rule.affectsHealth;
+        ins.expected = rule.expected;
+        ins.parameter = -1;
+        ins.ratioOf = -1;
+        ins.firstOperand = 0;
+        ins.operandCount = 0;
+        ins.warningLow = NO_LOW;
+        ins.warningHigh = NO_HIGH;
+        ins.criticalLow = NO_LOW;
+        ins.criticalHigh = NO_HIGH;
+        ins.warningPenalty = rule.warningPenalty;
+        ins.criticalPenalty = rule.criticalPenalty;
+
+        if (rule.kind == HealthRule::Kind::Combination) {
+            QVector<int> operands;
+            for (const QString& operand : rule.operands) {
+                // Operands must be defined earlier, which keeps evaluation a single forward pass
+                int index = ruleIndex.value(operand, -1);
+                if (index < 0) {
+                    break;
+                }
+                operands.append(index);
+            }
+            if (operands.isEmpty() || operands.size() != rule.operands.size()) {
+                reject(rule, "unknown or forward operand");
+                continue;
+            }
+            ins.firstOperand = program.m_operands.size();
+            ins.operandCount = operands.size();
+            program.m_operands += operands;
+
+            // Optional parameter only supplies the "%1" value for messages
+            if (!rule.parameter.isEmpty()) {
+                ins.parameter = program.internParameter(rule.parameter);
+            }
+        } else {
+            if (!telemetry || !telemetry->hasParameter(rule.parameter)) {
+                reject(rule, QString("unknown parameter '%1'").arg(rule.parameter));
+                continue;
+            }
+            if (!rule.ratioOf.isEmpty() && !telemetry->hasParameter(rule.ratioOf)) {
+                reject(rule, QString("unknown parameter '%1'").arg(rule.ratioOf));
+                continue;
+            }
+
+            ins.parameter = program.internParameter(rule.parameter);
+            if (!rule.ratioOf.isEmpty()) {
+                ins.ratioOf = program.internParameter(rule.ratioOf);
+            }
+
+            if (rule.kind == HealthRule::Kind::Threshold) {
+                // A ratio is in percent, so the raw parameter's limits don't apply
+                const TelemetryParameterInfo info = rule.ratioOf.isEmpty()
+                    ? telemetry->parameterInfo(rule.parameter) : TelemetryParameterInfo();
+                if (rule.bound != HealthRule::Bound::High) {
+                    ins.warningLow = resolveLimit(rule.warningLow, info,
+                                                  TelemetryParameterInfo::WarningLow, NO_LOW);
+                    ins.criticalLow = resolveLimit(rule.criticalLow, info,
+                                                   TelemetryParameterInfo::CriticalLow, NO_LOW);
+                }
+                if (rule.bound != HealthRule::Bound::Low) {
+                    ins.warningHigh = resolveLimit(rule.warningHigh, info,
+                                                   TelemetryParameterInfo::WarningHigh, NO_HIGH);
+                    ins.criticalHigh = resolveLimit(rule.criticalHigh, info,
+                                                    TelemetryParameterInfo::CriticalHigh, NO_HIGH);
+                }
+            } else if (rule.kind == HealthRule::Kind::RateOfChange) {
+                ins.warningHigh = std::isnan(rule.warningHigh) ? NO_HIGH : rule.warningHigh;
+                ins.criticalHigh = std::isnan(rule.criticalHigh) ? NO_HIGH : rule.criticalHigh;
+            }
+        }
+
+        ruleIndex.insert(rule.id, program.m_instructions.size());
+        program.m_instructions.append(ins);
+
+        program.m_ruleIds.append(rule.id);
+        program.m_faults.append(rule.faultCode.isEmpty()
+            ? FaultCode()
+            : FaultCode(rule.faultCode, rule.faultDescription, rule.faultSeverity, QString()));
+        program.m_warningMessages.append(rule.warningMessage);
+        program.m_criticalMessages.append(rule.criticalMessage);
+        program.m_precisions.append(rule.precision);
+    }
+
+    return program;
+}
+
+void HealthRuleProgram::evaluate(const double* inputs, const double* previous, double dtSeconds,
+                                 Evaluation* result) const
+{
+    const int count = m_instructions.size();
+    result->levels.resize(count);
+    quint8* levels = result->levels.data();
+
+    quint8 worst = HealthRule::Normal;
+    double score = 100.0;
+
+    for (int i = 0; i < count; ++i) {
+        const Instruction& ins = m_instructions.at(i);
+        quint8 level = HealthRule::Normal;
+        double warningFraction = 1.0;
+
+        switch (ins.kind) {
+            case HealthRule::Kind::Threshold:
+            case HealthRule::Kind::RateOfChange: {
+                double v = inputs[ins.parameter];
+                if (ins.kind == HealthRule::Kind::RateOfChange) {
+                    if (dtSeconds <= 0.0) {
+                        break;
+                    }
+                    v = std::abs(v - previous[ins.parameter]) / dtSeconds;
+                } else if (ins.ratioOf >= 0) {
+                    double denominator = inputs[ins.ratioOf];
+                    if (denominator <= 0.0) {
+                        break;
+                    }
+                    v = 100.0 * v / denominator;
+                }
+
+                // NaN inputs fail every comparison and stay Normal
+                const bool critical =
+                    TelemetryParameterInfo::belowLimit(v, ins.criticalLow, ins.inclusive)
+                    || TelemetryParameterInfo::aboveLimit(v, ins.criticalHigh, ins.inclusive);
+                if (critical) {
+                    level = HealthRule::Critical;
+                    break;
+                }
+
+                const bool low = TelemetryParameterInfo::belowLimit(v, ins.warningLow, ins.inclusive);
+                const bool high = TelemetryParameterInfo::aboveLimit(v, ins.warningHigh, ins.inclusive);
+                if (low) {
+                    level = HealthRule::Warning;
+                    warningFraction = bandFraction(ins.warningLow - v, ins.warningLow - ins.criticalLow);
+                } else if (high) {
+                    level = HealthRule::Warning;
+                    warningFraction = bandFraction(v - ins.warningHigh, ins.criticalHigh - ins.warningHigh);
+                }
+                break;
+            }
+
+            case HealthRule::Kind::Boolean:
+                if ((inputs[ins.parameter] != 0.0) != ins.expected) {
+                    level = ins.level;
+                }
+                break;
+
+            case HealthRule::Kind::Combination: {
+                const int* operand = m_operands.constData() + ins.firstOperand;
+                level = levels[operand[0]];
+                for (int k = 1; k < ins.operandCount; ++k) {
+                    level = (ins.combine == HealthRule::Combine::All)
+                          ? qMin(level, levels[operand[k]])
+                          : qMax(level, levels[operand[k]]);
+                }
+                break;
+            }
+        }
+
+        levels[i] = level;
+
+        if (ins.affectsHealth && level != HealthRule::Normal) {
+            worst = qMax(worst, level);
+            score -= (level == HealthRule::Critical)
+                   ? ins.criticalPenalty
+                   : ins.warningPenalty * warningFraction;
+        }
+    }
+
+    result->state = (worst == HealthRule::Critical) ? HealthState::FAIL
+                  : (worst == HealthRule::Warning) ? HealthState::DEGRADED
+                  : HealthState::OK;
+    result->score = qBound(0.0, score, 100.0);
+}
+
+FaultCode HealthRuleProgram::makeFault(int rule, const QString& subsystemId) const
+{
+    const FaultCode& fault = m_faults.at(rule);
+    return FaultCode(fault.code, fault.description, fault.severity, subsystemId);
+}
+
+QString HealthRuleProgram::message(const Evaluation& result, const double* inputs) const
+{
+    auto format = [this, inputs](int rule, const QString& text) {
+        int parameter = m_instructions.at(rule).parameter;
+        if (parameter < 0 || !text.contains("%1")) {
+            return text;
+        }
+        return text.arg(inputs[parameter], 0, 'f', m_precisions.at(rule));
+    };
+
+    int warningRule = -1;
+    for (int i = 0; i < result.levels.size(); ++i) {
+        quint8 level = result.levels.at(i);
+        if (level == HealthRule::Critical && !m_criticalMessages.at(i).isEmpty()) {
+            return format(i, m_criticalMessages.at(i));
+        }
+        if (level == HealthRule::Warning && warningRule < 0 && !m_warningMessages.at(i).isEmpty()) {
+            warningRule = i;
+        }
+    }
+
+    return (warningRule >= 0) ? format(warningRule, m_warningMessages.at(warningRule)) : QString();
+}
+
+} // namespace RadarRMP
@@ -1,7 +1,10 @@
 #include "core/RadarSubsystem.h"
 #include <QMutexLocker>
-#include <QTimer>
 #include <QDateTime>
+#include <QElapsedTimer>
+#include <QPointF>
+#include <QThread>
+#include <cmath>
 
 namespace RadarRMP {
 
@@ -13,16 +16,33 @@ RadarSubsystem::RadarSubsystem(const QString& id, const QString& name,
     , m_type(type)
     , m_healthState(HealthState::UNKNOWN)
     , m_healthScore(100.0)
+    , m_faultHistory(MAX_FAULT_HISTORY)
     , m_enabled(true)
     , m_processingHealth(false)
     , m_healthUpdatePending(false)
-    , m_pendingHealthSignal(false)
-    , m_pendingTelemetrySignal(false)
-    , m_lastHealthSignalTime(0)
-    , m_lastTelemetrySignalTime(0)
+    , m_coalescer(SignalCoalescer::instance())
+    , m_pendingSignals(SignalCoalescer::NoSignal)
+    , m_notificationQueued(false)
+    , m_workQueued(false)
+    , m_healthEpoch(1)
+    , m_ruleSampleInterval(0.0)
+    , m_healthProgramDirty(false)
+    , m_ruleInputsChanged(false)
+    , m_ruleEvaluationNs(0)
+    , m_ruleEvaluationCount(0)
+    , m_mailboxDraining(false)
 {
     m_telemetryData = new TelemetryData(this);
     
+    // Names, units and limits are stored once per subsystem type
+    m_telemetryData->useSharedSchema(subsystemTypeToString(type));
+    
+    // Per-update deltas are relayed as-is; telemetryChanged stays coalesced.
+    // A worker-side write is queued over to this object's thread, so
+    // listeners always see telemetryValuesChanged on the GUI thread.
+    connect(m_telemetryData, &TelemetryData::valuesChanged,
+            this, &RadarSubsystem::telemetryValuesChanged);
+    
     // NOTE: We no longer automatically trigger processHealthData from telemetry changes
     // This prevents cascading signal emissions. processHealthData is called explicitly
     // after all data updates are complete in updateData().
@@ -30,29 +50,17 @@ RadarSubsystem::RadarSubsystem(const QString& id, const QString& name,
     
     m_description = subsystemTypeToString(type);
     
-    // Create debounce timer for batched signal emission
-    m_signalDebounceTimer = new QTimer(this);
-    m_signalDebounceTimer->setSingleShot(true);
-    m_signalDebounceTimer->setInterval(SIGNAL_DEBOUNCE_MS);
-    connect(m_signalDebounceTimer, &QTimer::timeout, this, [this]() {
-        // Emit any pending signals in batch
-        if (m_pendingHealthSignal) {
-            m_pendingHealthSignal = false;
-            m_lastHealthSignalTime = QDateTime::currentMSecsSinceEpoch();
-            emit healthChanged();
-        }
-        if (m_pendingTelemetrySignal) {
-            m_pendingTelemetrySignal = false;
-            m_lastTelemetrySignalTime = QDateTime::currentMSecsSinceEpoch();
-            emit telemetryChanged();
-        }
-    });
+    // Signal batching is handled by the shared SignalCoalescer frame clock,
+    // so subsystems no longer own per-instance debounce timers
     
     initializeTelemetryParameters();
 }
 
 RadarSubsystem::~RadarSubsystem()
 {
+    if ((m_notificationQueued || m_workQueued) && m_coalescer) {
+        m_coalescer->cancel(this);
+    }
 }
 
 QString RadarSubsystem::getId() const
@@ -85,6 +93,95 @@ void RadarSubsystem::setDescription(const QString& desc)
     m_description = desc;
 }
 
+QString RadarSubsystem::getTelemetryParameterName(int index) const
+{
+    return m_telemetryData->nameAt(index);
+}
+
+void RadarSubsystem::setTelemetryHistoryCapacity(int samples)
+{
+    m_telemetryData->setHistoryCapacity(samples);
+}
+
+int RadarSubsystem::getTelemetryHistoryCapacity() const
+{
+    return m_telemetryData->historyCapacity();
+}
+
+TelemetryHistorySpan RadarSubsystem::telemetryHistory(const QString& paramName) const
+{
+    return m_telemetryData->history(paramName);
+}
+
+QList<QPointF> RadarSubsystem::telemetryHistoryPoints(const QString& paramName, int maxSamples) const
+{
+    // Copied under the telemetry lock - ingest may be running on a worker
+    const QVector<TelemetrySample> samples = m_telemetryData->historySamples(paramName, maxSamples);
+    
+    QList<QPointF> points;
+    points.reserve(samples.size());
+    for (const TelemetrySample& sample : samples) {
+        points.append(QPointF(static_cast<double>(sample.timestamp.toMSecsSinceEpoch()), sample.value));
+    }
+    return points;
+}
+
+QVariantList RadarSubsystem::getTelemetryHistory(const QString& paramName, int maxSamples) const
+{
+    const QList<QPointF> samples = telemetryHistoryPoints(paramName, maxSamples);
+    
+    QVariantList points;
+    points.reserve(samples.size());
+    for (const QPointF& point : samples) {
+        points.append(point);
+    }
+    return points;
+}
+
+bool RadarSubsystem::loadHealthRules(const QVariantList& rules)
+{
+    QList<HealthRule> parsed;
+    parsed.reserve(rules.size());
+    for (const QVariant& rule : rules) {
+        parsed.append(HealthRule::fromVariantMap(rule.toMap()));
+    }
+    
+    QMutexLocker updateLocker(&m_updateMutex);
+    
+    // Reject the whole set rather than run with a partial one
+    QStringList errors;
+    const HealthRuleProgram program = HealthRuleProgram::compile(parsed, m_telemetryData, &errors);
+    if (!errors.isEmpty()) {
+        return false;
+    }
+    
+    m_healthRules = parsed;
+    installHealthProgram(program);
+    scheduleNotification(SignalCoalescer::HealthRecompute);
+    return true;
+}
+
+QVariantList RadarSubsystem::getHealthRules() const
+{
+    QMutexLocker updateLocker(&m_updateMutex);
+    QVariantList rules;
+    for (const HealthRule& rule : m_healthRules) {
+        rules.append(rule.toVariantMap());
+    }
+    return rules;
+}
+
+QVariantMap RadarSubsystem::getHealthRuleStats() const
+{
+    QMutexLocker updateLocker(&m_updateMutex);
+    QVariantMap stats;
+    stats["ruleCount"] = m_healthProgram.ruleCount();
+    stats["parameterCount"] = m_healthProgram.parameters().size();
+    stats["lastEvaluationNs"] = m_ruleEvaluationNs;
+    stats["evaluationCount"] = m_ruleEvaluationCount;
+    return stats;
+}
+
 HealthState RadarSubsystem::getHealthState() const
 {
     QMutexLocker locker(&m_mutex);
@@ -97,18 +194,43 @@ QString RadarSubsystem::getHealthStateString() const
 }
 
 HealthSnapshot RadarSubsystem::getHealthSnapshot() const
+{
+    return *healthSnapshot();
+}
+
+HealthSnapshotPtr RadarSubsystem::healthSnapshot() const
+{
+    HealthSnapshotPtr current = std::atomic_load(&m_snapshot);
+    if (current && current->epoch == m_healthEpoch.loadAcquire()) {
+        return current;
+    }
+    return publishHealthSnapshot();
+}
+
+HealthSnapshotPtr RadarSubsystem::publishHealthSnapshot() const
 {
     QMutexLocker locker(&m_mutex);
     
-    HealthSnapshot snapshot;
-    snapshot.state = m_healthState;
-    snapshot.timestamp = QDateTime::currentDateTime();
-    snapshot.telemetry = m_telemetryData->getData();
-    snapshot.activeFaults = m_activeFaults;
-    snapshot.healthScore = m_healthScore;
-    snapshot.statusMessage = m_statusMessage;
+    // Read the epoch before the state: a change racing the copy leaves the
+    // snapshot tagged older, so the next reader simply republishes
+    quint64 epoch = m_healthEpoch.loadAcquire();
+    HealthSnapshotPtr current = std::atomic_load(&m_snapshot);
+    if (current && current->epoch == epoch) {
+        return current;
+    }
+    
+    auto snapshot = std::make_shared<HealthSnapshot>();
+    snapshot->state = m_healthState;
+    snapshot->telemetry = m_telemetryData->getData();
+    snapshot->activeFaults = m_activeFaults.values();
+    snapshot->faultMask = m_activeFaults.activeMask();
+    snapshot->healthScore = m_healthScore;
+    snapshot->statusMessage = m_statusMessage;
+    snapshot->epoch = epoch;
     
-    return snapshot;
+    HealthSnapshotPtr published = snapshot;
+    std::atomic_store(&m_snapshot, published);
+    return published;
 }
 
 double RadarSubsystem::getHealthScore() const
@@ -140,23 +262,24 @@ QStringList RadarSubsystem::getTelemetryParameters() const
 
 QVariantMap RadarSubsystem::getTelemetryMetadata(const QString& paramName) const
 {
-    return m_telemetryData->getParameter(paramName).toVariantMap();
+    return m_telemetryData->getParameterMetadata(paramName);
 }
 
 QVariantList RadarSubsystem::getFaults() const
 {
     QMutexLocker locker(&m_mutex);
     QVariantList faults;
+    faults.reserve(m_activeFaults.size());
     
-    for (const auto& fault : m_activeFaults) {
+    m_activeFaults.forEach([&faults](const FaultCode& fault) {
         QVariantMap faultMap;
         faultMap["code"] = fault.code;
         faultMap["description"] = fault.description;
         faultMap["severity"] = faultSeverityToString(fault.severity);
-        faultMap["timestamp"] = fault.timestamp;
+        faultMap["timestamp"] = fault.timestamp.toDateTime();
         faultMap["active"] = fault.active;
         faults.append(faultMap);
-    }
+    });
     
     return faults;
 }
@@ -166,16 +289,15 @@ QVariantList RadarSubsystem::getFaultHistory(int maxCount) const
     QMutexLocker locker(&m_mutex);
     QVariantList history;
     
-    int count = 0;
-    for (auto it = m_faultHistory.rbegin(); 
-         it != m_faultHistory.rend() && count < maxCount; 
-         ++it, ++count) {
+    int count = qMin(maxCount, m_faultHistory.size());
+    for (int i = 0; i < count; ++i) {
+        const FaultCode& fault = m_faultHistory.fromNewest(i);
         QVariantMap faultMap;
-        faultMap["code"] = it->code;
-        faultMap["description"] = it->description;
-        faultMap["severity"] = faultSeverityToString(it->severity);
-        faultMap["timestamp"] = it->timestamp;
-        faultMap["active"] = it->active;
+        faultMap["code"] = fault.code;
+        faultMap["description"] = fault.description;
+        faultMap["severity"] = faultSeverityToString(fault.severity);
+        faultMap["timestamp"] = fault.timestamp.toDateTime();
+        faultMap["active"] = fault.active;
         history.append(faultMap);
     }
     
@@ -195,30 +317,36 @@ int RadarSubsystem::getFaultCount() const
 }
 
 bool RadarSubsystem::clearFault(const QString& faultCode)
+{
+    return takeFault(faultCode, false);
+}
+
+bool RadarSubsystem::takeFault(const QString& faultCode, bool ruleRaisedOnly)
 {
     QMutexLocker locker(&m_mutex);
     
-    for (int i = 0; i < m_activeFaults.size(); ++i) {
-        if (m_activeFaults[i].code == faultCode) {
-            FaultCode fault = m_activeFaults.takeAt(i);
-            fault.active = false;
-            m_faultHistory.append(fault);
-            
-            // Trim history if needed
-            while (m_faultHistory.size() > MAX_FAULT_HISTORY) {
-                m_faultHistory.removeFirst();
-            }
-            
-            locker.unlock();
-            emit faultCleared(faultCode);
-            emit faultsChanged();
-            // Schedule health update instead of immediate call
-            QTimer::singleShot(0, this, &RadarSubsystem::processHealthData);
-            return true;
-        }
+    if (ruleRaisedOnly && !m_ruleRaisedFaults.contains(faultCode)) {
+        return false;
     }
     
-    return false;
+    // Called for every healthy parameter on every sample, so the common
+    // "not active" case must stay a hash lookup plus a bit test
+    FaultCode fault;
+    if (!m_activeFaults.take(faultCode, &fault)) {
+        return false;
+    }
+    m_ruleRaisedFaults.remove(faultCode);
+    
+    fault.active = false;
+    m_faultHistory.push(fault);  // Ring buffer drops the oldest entry when full
+    
+    locker.unlock();
+    emitOnOwnerThread([this, faultCode]() {
+        emit faultCleared(faultCode);
+    });
+    // faultsChanged and the health recompute go out with the next frame
+    scheduleNotification(SignalCoalescer::FaultsSignal | SignalCoalescer::HealthRecompute);
+    return true;
 }
 
 int RadarSubsystem::clearAllFaults()
@@ -226,23 +354,18 @@ int RadarSubsystem::clearAllFaults()
     QMutexLocker locker(&m_mutex);
     int count = m_activeFaults.size();
     
-    for (auto& fault : m_activeFaults) {
-        fault.active = false;
-        m_faultHistory.append(fault);
-    }
+    m_activeFaults.forEach([this](const FaultCode& fault) {
+        FaultCode cleared = fault;
+        cleared.active = false;
+        m_faultHistory.push(cleared);
+    });
     m_activeFaults.clear();
-    
-    // Trim history
-    while (m_faultHistory.size() > MAX_FAULT_HISTORY) {
-        m_faultHistory.removeFirst();
-    }
+    m_ruleRaisedFaults.clear();
     
     locker.unlock();
     
     if (count > 0) {
-        emit faultsChanged();
-        // Schedule health update instead of immediate call
-        QTimer::singleShot(0, this, &RadarSubsystem::processHealthData);
+        scheduleNotification(SignalCoalescer::FaultsSignal | SignalCoalescer::HealthRecompute);
     }
     
     return count;
@@ -264,15 +387,16 @@ void RadarSubsystem::setEnabled(bool enabled)
         m_enabled = enabled;
     }
     emit enabledChanged();
-    // Schedule health update instead of immediate call
-    QTimer::singleShot(0, this, &RadarSubsystem::processHealthData);
+    scheduleNotification(SignalCoalescer::HealthRecompute);
 }
 
 void RadarSubsystem::reset()
 {
+    QMutexLocker updateLocker(&m_updateMutex);
     QMutexLocker locker(&m_mutex);
     
     m_activeFaults.clear();
+    m_ruleRaisedFaults.clear();
     m_healthState = HealthState::UNKNOWN;
     m_healthScore = 100.0;
     m_statusMessage.clear();
@@ -280,10 +404,11 @@ void RadarSubsystem::reset()
     locker.unlock();
     
     initializeTelemetryParameters();
+    m_healthProgramDirty = true;
     
-    emit healthChanged();
-    emit faultsChanged();
-    emit telemetryChanged();
+    scheduleNotification(SignalCoalescer::HealthSignal |
+                         SignalCoalescer::FaultsSignal |
+                         SignalCoalescer::TelemetrySignal);
 }
 
 bool RadarSubsystem::runSelfTest()
@@ -293,30 +418,98 @@ bool RadarSubsystem::runSelfTest()
     return getHealthState() == HealthState::OK;
 }
 
+SelfTestProcedure RadarSubsystem::prepareSelfTest() const
+{
+    SelfTestResult stateResult;
+    {
+        QMutexLocker locker(&m_mutex);
+        stateResult.state = m_healthState;
+        stateResult.message = m_statusMessage;
+    }
+    const TelemetrySnapshot telemetry = m_telemetryData->snapshot();
+    
+    return [stateResult, telemetry]() {
+        SelfTestResult result = stateResult;
+        
+        QStringList failures;
+        if (result.state != HealthState::OK) {
+            failures.append(QString("health %1").arg(healthStateToString(result.state)));
+        }
+        for (int i = 0; i < telemetry.values.size(); ++i) {
+            const TelemetryParameterInfo& info = telemetry.schema->parameters.at(i);
+            if (!telemetry.valid.value(i, 1)) {
+                failures.append(QString("%1 invalid").arg(info.name));
+                continue;
+            }
+            const double value = TelemetryData::numericValue(telemetry.values.at(i));
+            if (std::isnan(value)) {
+                continue;
+            }
+            if ((info.has(TelemetryParameterInfo::Min) && value < info.minValue) ||
+                (info.has(TelemetryParameterInfo::Max) && value > info.maxValue)) {
+                failures.append(QString("%1 out of limits (%2)").arg(info.name).arg(value));
+            }
+        }
+        
+        result.passed = failures.isEmpty();
+        if (!result.passed) {
+            result.message = failures.join("; ");
+        } else if (result.message.isEmpty()) {
+            result.message = "Self-test passed";
+        }
+        return result;
+    };
+}
+
 void RadarSubsystem::updateData(const QVariantMap& data)
 {
+    // Any thread; concurrent writers are serialized here
+    QMutexLocker updateLocker(&m_updateMutex);
+    
     m_telemetryData->setValues(data);
+    updateHealthRuleInputs(data);
     onDataUpdate(data);
     
-    // Schedule debounced telemetry signal
-    qint64 now = QDateTime::currentMSecsSinceEpoch();
-    if ((now - m_lastTelemetrySignalTime) >= SIGNAL_DEBOUNCE_MS) {
-        // Enough time has passed, emit immediately
-        m_lastTelemetrySignalTime = now;
-        emit telemetryChanged();
-    } else {
-        // Too soon, schedule for later
-        m_pendingTelemetrySignal = true;
-        if (!m_signalDebounceTimer->isActive()) {
-            m_signalDebounceTimer->start();
+    // telemetryChanged is coalesced with any other updates this frame
+    scheduleNotification(SignalCoalescer::TelemetrySignal);
+    
+    processHealthData();
+}
+
+void RadarSubsystem::postData(const QVariantMap& data)
+{
+    {
+        QMutexLocker locker(&m_mailboxMutex);
+        for (auto it = data.constBegin(); it != data.constEnd(); ++it) {
+            m_mailbox.insert(it.key(), it.value());
         }
+        
+        // Whoever is draining picks this up; don't queue behind it
+        if (m_mailboxDraining) {
+            return;
+        }
+        m_mailboxDraining = true;
     }
     
-    processHealthData();
+    // This thread became the writer: apply until the mailbox stays empty
+    forever {
+        QVariantMap batch;
+        {
+            QMutexLocker locker(&m_mailboxMutex);
+            if (m_mailbox.isEmpty()) {
+                m_mailboxDraining = false;
+                return;
+            }
+            batch.swap(m_mailbox);
+        }
+        updateData(batch);
+    }
 }
 
 void RadarSubsystem::processHealthData()
 {
+    QMutexLocker updateLocker(&m_updateMutex);
+    
     // Prevent recursive calls - if already processing, just mark pending
     if (m_processingHealth) {
         m_healthUpdatePending = true;
@@ -325,6 +518,9 @@ void RadarSubsystem::processHealthData()
     
     m_processingHealth = true;
     
+    // Rule faults are raised/cleared here so the state below already sees them
+    evaluateHealthRules();
+    
     QMutexLocker locker(&m_mutex);
     
     HealthState oldState = m_healthState;
@@ -335,40 +531,33 @@ void RadarSubsystem::processHealthData()
     m_healthScore = computeHealthScore();
     m_statusMessage = computeStatusMessage();
     
+    HealthState newState = m_healthState;
+    double newScore = m_healthScore;
+    
     locker.unlock();
     
     // Only emit signals if something actually changed
-    bool stateChanged = (oldState != m_healthState);
-    bool scoreChanged = qAbs(oldScore - m_healthScore) > 0.1;  // 0.1% threshold
+    bool stateChanged = (oldState != newState);
+    bool scoreChanged = qAbs(oldScore - newScore) > 0.1;  // 0.1% threshold
     
     if (stateChanged) {
-        emit stateTransition(healthStateToString(oldState), 
-                            healthStateToString(m_healthState));
+        emitOnOwnerThread([this, oldState, newState]() {
+            emit stateTransition(healthStateToString(oldState),
+                                 healthStateToString(newState));
+        });
     }
     
     if (stateChanged || scoreChanged) {
-        // Use debounced signal emission to prevent storms
-        qint64 now = QDateTime::currentMSecsSinceEpoch();
-        if ((now - m_lastHealthSignalTime) >= SIGNAL_DEBOUNCE_MS) {
-            // Enough time has passed, emit immediately
-            m_lastHealthSignalTime = now;
-            emit healthChanged();
-        } else {
-            // Too soon, schedule for later
-            m_pendingHealthSignal = true;
-            if (!m_signalDebounceTimer->isActive()) {
-                m_signalDebounceTimer->start();
-            }
-        }
+        scheduleNotification(SignalCoalescer::HealthSignal);
     }
     
     m_processingHealth = false;
     
-    // If another update was requested while we were processing, do it now
+    // If another update was requested while we were processing, run it
+    // on the next frame rather than recursing
     if (m_healthUpdatePending) {
         m_healthUpdatePending = false;
-        // Use QTimer::singleShot to prevent deep recursion
-        QTimer::singleShot(0, this, &RadarSubsystem::processHealthData);
+        scheduleNotification(SignalCoalescer::HealthRecompute);
     }
 }
 
@@ -382,24 +571,37 @@ void RadarSubsystem::initializeTelemetryParameters()
     // Base implementation - override in derived classes
 }
 
+void RadarSubsystem::initializeHealthRules()
+{
+    // Base implementation - override in derived classes
+}
+
 HealthState RadarSubsystem::computeHealthState() const
 {
-    // Default implementation based on faults
     if (!m_enabled) {
         return HealthState::UNKNOWN;
     }
     
+    if (!m_healthProgram.isEmpty()) {
+        // Rules decide OK/DEGRADED/FAIL; any active fault degrades at least
+        if (m_ruleEvaluation.state == HealthState::OK && !m_activeFaults.isEmpty()) {
+            return HealthState::DEGRADED;
+        }
+        return m_ruleEvaluation.state;
+    }
+    
+    // Default implementation based on faults
     bool hasCritical = false;
     bool hasWarning = false;
     
-    for (const auto& fault : m_activeFaults) {
+    m_activeFaults.forEach([&](const FaultCode& fault) {
         if (fault.severity == FaultSeverity::FATAL || 
             fault.severity == FaultSeverity::CRITICAL) {
             hasCritical = true;
         } else if (fault.severity == FaultSeverity::WARNING) {
             hasWarning = true;
         }
-    }
+    });
     
     if (hasCritical) {
         return HealthState::FAIL;
@@ -412,10 +614,15 @@ HealthState RadarSubsystem::computeHealthState() const
 
 double RadarSubsystem::computeHealthScore() const
 {
+    if (!m_healthProgram.isEmpty()) {
+        double score = m_ruleEvaluation.score - m_activeFaults.size() * 5;
+        return qMax(0.0, qMin(100.0, score));
+    }
+    
     // Default implementation
     double score = 100.0;
     
-    for (const auto& fault : m_activeFaults) {
+    m_activeFaults.forEach([&score](const FaultCode& fault) {
         switch (fault.severity) {
             case FaultSeverity::INFO:
                 score -= 5;
@@ -430,7 +637,7 @@ double RadarSubsystem::computeHealthScore() const
                 score -= 50;
                 break;
         }
-    }
+    });
     
     return qMax(0.0, score);
 }
@@ -449,12 +656,12 @@ QString RadarSubsystem::computeStatusMessage() const
     FaultSeverity maxSeverity = FaultSeverity::INFO;
     QString message = "Active faults present";
     
-    for (const auto& fault : m_activeFaults) {
+    m_activeFaults.forEach([&](const FaultCode& fault) {
         if (fault.severity > maxSeverity) {
             maxSeverity = fault.severity;
             message = fault.description;
         }
-    }
+    });
     
     return message;
 }
@@ -469,21 +676,36 @@ void RadarSubsystem::addFault(const FaultCode& fault)
 {
     QMutexLocker locker(&m_mutex);
     
-    // Check if fault already exists
-    for (const auto& existing : m_activeFaults) {
-        if (existing.code == fault.code) {
-            return;
-        }
+    // insert() rejects a code that is already active
+    if (!m_activeFaults.insert(fault)) {
+        return;
     }
     
-    m_activeFaults.append(fault);
+    locker.unlock();
+    
+    emitOnOwnerThread([this, code = fault.code, description = fault.description]() {
+        emit faultOccurred(code, description);
+    });
+    scheduleNotification(SignalCoalescer::FaultsSignal | SignalCoalescer::HealthRecompute);
+}
+
+bool RadarSubsystem::raiseRuleFault(const FaultCode& fault)
+{
+    QMutexLocker locker(&m_mutex);
+    
+    // Already active (injected, or raised by an operator): not the rule's
+    if (!m_activeFaults.insert(fault)) {
+        return false;
+    }
+    m_ruleRaisedFaults.insert(fault.code);
     
     locker.unlock();
     
-    emit faultOccurred(fault.code, fault.description);
-    emit faultsChanged();
-    // Schedule health update instead of immediate call
-    QTimer::singleShot(0, this, &RadarSubsystem::processHealthData);
+    emitOnOwnerThread([this, code = fault.code, description = fault.description]() {
+        emit faultOccurred(code, description);
+    });
+    scheduleNotification(SignalCoalescer::FaultsSignal | SignalCoalescer::HealthRecompute);
+    return true;
 }
 
 void RadarSubsystem::removeFault(const QString& faultCode)
@@ -496,19 +718,43 @@ void RadarSubsystem::updateFault(const QString& faultCode, bool active)
     if (active) {
         // If activating, check if it already exists
         QMutexLocker locker(&m_mutex);
-        for (const auto& fault : m_activeFaults) {
-            if (fault.code == faultCode) {
-                return;  // Already active
-            }
+        if (m_activeFaults.contains(faultCode)) {
+            return;  // Already active
         }
     } else {
         clearFault(faultCode);
     }
 }
 
+void RadarSubsystem::registerFaultCodes(const QStringList& faultCodes)
+{
+    QMutexLocker locker(&m_mutex);
+    for (const QString& code : faultCodes) {
+        m_activeFaults.registerCode(code);
+    }
+}
+
+QStringList RadarSubsystem::getRegisteredFaultCodes() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_activeFaults.registeredCodes();
+}
+
 void RadarSubsystem::setTelemetryValue(const QString& name, const QVariant& value)
 {
+    // Same writer lock as updateData(); the rule inputs are read under it
+    QMutexLocker updateLocker(&m_updateMutex);
+    
     m_telemetryData->setValue(name, value);
+    
+    int index = m_healthProgram.parameterIndex(name);
+    if (index >= 0 && !m_healthProgramDirty) {
+        const double input = value.toDouble();
+        if (m_ruleInputs.at(index) != input) {
+            m_ruleInputs[index] = input;
+            m_ruleInputsChanged = true;
+        }
+    }
 }
 
 void RadarSubsystem::addTelemetryParameter(const TelemetryParameter& param)
@@ -516,6 +762,126 @@ void RadarSubsystem::addTelemetryParameter(const TelemetryParameter& param)
     m_telemetryData->addParameter(param);
 }
 
+void RadarSubsystem::addHealthRule(const HealthRule& rule)
+{
+    m_healthRules.append(rule);
+    m_healthProgramDirty = true;
+}
+
+QString RadarSubsystem::healthRuleMessage() const
+{
+    if (m_healthProgram.isEmpty()) {
+        return QString();
+    }
+    return m_healthProgram.message(m_ruleEvaluation, m_ruleInputs.constData());
+}
+
+void RadarSubsystem::compileHealthRules()
+{
+    installHealthProgram(HealthRuleProgram::compile(m_healthRules, m_telemetryData));
+}
+
+void RadarSubsystem::installHealthProgram(const HealthRuleProgram& program)
+{
+    m_healthProgram = program;
+    m_healthProgramDirty = false;
+    
+    // Seed the input column from current telemetry; bools read as 0/1
+    const QStringList& parameters = m_healthProgram.parameters();
+    m_ruleInputs.resize(parameters.size());
+    for (int i = 0; i < parameters.size(); ++i) {
+        m_ruleInputs[i] = m_telemetryData->getValue(parameters.at(i)).toDouble();
+    }
+    m_rulePrevious = m_ruleInputs;
+    m_ruleSampleInterval = 0.0;
+    m_ruleInputsChanged = true;
+    
+    // Faults whose rule went away with the old program are not owned by anyone
+    QSet<QString> ruleCodes;
+    for (int i = 0; i < m_healthProgram.ruleCount(); ++i) {
+        if (m_healthProgram.raisesFault(i)) {
+            ruleCodes.insert(m_healthProgram.faultCode(i));
+        }
+    }
+    QSet<QString> orphaned;
+    {
+        QMutexLocker locker(&m_mutex);
+        orphaned = m_ruleRaisedFaults - ruleCodes;
+    }
+    for (const QString& code : std::as_const(orphaned)) {
+        takeFault(code, true);
+    }
+}
+
+void RadarSubsystem::updateHealthRuleInputs(const QVariantMap& data)
+{
+    if (m_healthProgramDirty) {
+        compileHealthRules();
+    }
+    
+    const Timestamp now = Timestamp::now();
+    m_ruleSampleInterval = m_ruleSampleTime.isValid() ? m_ruleSampleTime.secsTo(now) : 0.0;
+    m_ruleSampleTime = now;
+    
+    // A moving previous sample changes rates even when no value moves now
+    if (m_rulePrevious != m_ruleInputs) {
+        m_ruleInputsChanged = true;
+    }
+    m_rulePrevious = m_ruleInputs;
+    
+    for (auto it = data.constBegin(); it != data.constEnd(); ++it) {
+        int index = m_healthProgram.parameterIndex(it.key());
+        if (index < 0) {
+            continue;
+        }
+        const double input = it.value().toDouble();
+        if (m_ruleInputs.at(index) != input) {
+            m_ruleInputs[index] = input;
+            m_ruleInputsChanged = true;
+        }
+    }
+}
+
+void RadarSubsystem::evaluateHealthRules()
+{
+    if (m_healthProgramDirty) {
+        compileHealthRules();
+    }
+    // Fault and enable changes recompute state but leave the rule levels as they were
+    if (m_healthProgram.isEmpty() || !m_ruleInputsChanged) {
+        return;
+    }
+    m_ruleInputsChanged = false;
+    
+    QElapsedTimer timer;
+    timer.start();
+    
+    HealthRuleProgram::Evaluation evaluation;
+    m_healthProgram.evaluate(m_ruleInputs.constData(), m_rulePrevious.constData(),
+                             m_ruleSampleInterval, &evaluation);
+    
+    {
+        QMutexLocker locker(&m_mutex);
+        m_ruleEvaluation = evaluation;
+    }
+    
+    m_ruleEvaluationNs = timer.nsecsElapsed();
+    m_ruleEvaluationCount++;
+    
+    // A rule clears only the fault it raised itself; an injected or operator
+    // fault with the same code stays until whoever raised it clears it
+    for (int i = 0; i < evaluation.levels.size(); ++i) {
+        if (!m_healthProgram.raisesFault(i)) {
+            continue;
+        }
+        if (evaluation.levels.at(i) == HealthRule::Critical) {
+            raiseRuleFault(m_healthProgram.makeFault(i, m_id));
+        } else {
+            takeFault(m_healthProgram.faultCode(i), true);
+        }
+    }
+}
+
 void RadarSubsystem::setHealthState(HealthState state)
 {
     QMutexLocker locker(&m_mutex);
@@ -524,9 +890,11 @@ void RadarSubsystem::setHealthState(HealthState state)
     locker.unlock();
     
     if (oldState != state) {
-        emit stateTransition(healthStateToString(oldState), 
-                            healthStateToString(state));
-        emit healthChanged();
+        emitOnOwnerThread([this, oldState, state]() {
+            emit stateTransition(healthStateToString(oldState),
+                                 healthStateToString(state));
+        });
+        scheduleNotification(SignalCoalescer::HealthSignal);
     }
 }
 
@@ -535,7 +903,114 @@ void RadarSubsystem::setStatusMessage(const QString& message)
     QMutexLocker locker(&m_mutex);
     m_statusMessage = message;
     locker.unlock();
-    emit healthChanged();
+    scheduleNotification(SignalCoalescer::HealthSignal);
+}
+
+void RadarSubsystem::scheduleNotification(SignalCoalescer::PendingSignals pending)
+{
+    m_healthEpoch.fetchAndAddRelease(1);
+    
+    if (QThread::currentThread() != thread()) {
+        // Worker-side writer: accumulate, and hop to the owning thread only
+        // when nothing is already on its way
+        if (m_postedSignals.fetchAndOrRelease(static_cast<int>(pending)) == 0) {
+            QMetaObject::invokeMethod(this, &RadarSubsystem::receivePostedSignals,
+                                      Qt::QueuedConnection);
+        }
+        return;
+    }
+    
+    m_pendingSignals |= pending;
+    
+    if (m_notificationQueued && m_workQueued) {
+        return;  // Already in both dirty queues
+    }
+    
+    if (!m_coalescer) {
+        // Coalescer torn down during shutdown - nobody left to notify
+        m_pendingSignals = SignalCoalescer::NoSignal;
+        return;
+    }
+    
+    // The recompute and snapshot run on the work clock, which a hidden
+    // window does not slow down; the signals wait for the frame
+    if (!m_workQueued) {
+        m_workQueued = true;
+        m_coalescer->enqueueWork(this);
+    }
+    if (!m_notificationQueued) {
+        m_notificationQueued = true;
+        m_coalescer->enqueue(this);
+    }
+}
+
+void RadarSubsystem::emitOnOwnerThread(std::function<void()> emitter)
+{
+    if (QThread::currentThread() == thread()) {
+        emitter();
+        return;
+    }
+    
+    // Fault and state events are individually logged downstream, so unlike
+    // the property notifications they are queued one by one, not merged.
+    // Posted ahead of receivePostedSignals(), they keep their order.
+    QMetaObject::invokeMethod(this, std::move(emitter), Qt::QueuedConnection);
+}
+
+void RadarSubsystem::receivePostedSignals()
+{
+    int posted = m_postedSignals.fetchAndStoreAcquire(0);
+    if (posted != 0) {
+        scheduleNotification(SignalCoalescer::PendingSignals(posted));
+    }
+}
+
+void RadarSubsystem::runPendingWork()
+{
+    m_workQueued = false;
+    
+    if (m_pendingSignals.testFlag(SignalCoalescer::HealthRecompute)) {
+        m_pendingSignals.setFlag(SignalCoalescer::HealthRecompute, false);
+        processHealthData();
+    }
+    
+    // workFlushed listeners read it next
+    publishHealthSnapshot();
+}
+
+void RadarSubsystem::flushPendingNotifications()
+{
+    // Recompute first, while still queued, so any healthChanged it raises
+    // is folded into this frame instead of re-queueing
+    if (m_pendingSignals.testFlag(SignalCoalescer::HealthRecompute)) {
+        m_pendingSignals.setFlag(SignalCoalescer::HealthRecompute, false);
+        processHealthData();
+    }
+    
+    SignalCoalescer::PendingSignals pending = m_pendingSignals;
+    m_pendingSignals = SignalCoalescer::NoSignal;
+    m_notificationQueued = false;
+    
+    // A recompute requested during the one above runs next frame
+    if (pending.testFlag(SignalCoalescer::HealthRecompute)) {
+        scheduleNotification(SignalCoalescer::HealthRecompute);
+    }
+    
+    // Publish before notifying so slots read the state they are told about
+    if (pending & (SignalCoalescer::HealthSignal | SignalCoalescer::TelemetrySignal |
+                   SignalCoalescer::FaultsSignal)) {
+        publishHealthSnapshot();
+    }
+    
+    if (pending.testFlag(SignalCoalescer::HealthSignal)) {
+        emit healthChanged();
+    }
+    if (pending.testFlag(SignalCoalescer::TelemetrySignal)) {
+        emit telemetryChanged();
+    }
+    if (pending.testFlag(SignalCoalescer::FaultsSignal)) {
+        emit faultsChanged();
+    }
 }
 
 } // namespace RadarRMP
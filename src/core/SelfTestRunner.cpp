@@ -0,0 +1,232 @@
+#include "core/SelfTestRunner.h"
+#include "core/RadarSubsystem.h"
+#include <QCoreApplication>
+#include <QThreadPool>
+#include <QTimer>
+
+namespace RadarRMP {
+
+QVariantMap SelfTestResult::toVariantMap() const
+{
+    QVariantMap map;
+    map["subsystemId"] = subsystemId;
+    map["passed"] = passed;
+    map["timedOut"] = timedOut;
+    map["cancelled"] = cancelled;
+    map["healthState"] = healthStateToString(state);
+    map["message"] = message;
+    map["durationMs"] = durationMs;
+    return map;
+}
+
+// ============================================================================
+// SelfTestOperation
+// ============================================================================
+
+SelfTestOperation::SelfTestOperation(const QStringList& subsystemIds, QObject* parent)
+    : QObject(parent)
+    , m_total(subsystemIds.size())
+    , m_passedCount(0)
+    , m_running(!subsystemIds.isEmpty())
+    , m_elapsedMs(0)
+    , m_cancelled(std::make_shared<QAtomicInt>(0))
+{
+    for (const QString& id : subsystemIds) {
+        m_outstanding.insert(id, true);
+    }
+    m_results.reserve(m_total);
+    m_clock.start();
+}
+
+double SelfTestOperation::getProgress() const
+{
+    return m_total > 0 ? static_cast<double>(m_results.size()) / m_total : 1.0;
+}
+
+bool SelfTestOperation::hasPassed() const
+{
+    return !m_running && m_passedCount == m_total;
+}
+
+qint64 SelfTestOperation::getElapsedMs() const
+{
+    return m_running ? m_clock.elapsed() : m_elapsedMs;
+}
+
+QVariantList SelfTestOperation::getResults() const
+{
+    QVariantList list;
+    list.reserve(m_results.size());
+    for (const SelfTestResult& result : m_results) {
+        list.append(result.toVariantMap());
+    }
+    return list;
+}
+
+void SelfTestOperation::cancel()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_cancelled->storeRelease(1);
+
+    const QStringList outstanding = m_outstanding.keys();
+    for (const QString& id : outstanding) {
+        cancel(id, "Self-test cancelled");
+    }
+}
+
+void SelfTestOperation::cancel(const QString& subsystemId, const QString& reason)
+{
+    if (!m_outstanding.contains(subsystemId)) {
+        return;
+    }
+
+    SelfTestResult result;
+    result.subsystemId = subsystemId;
+    result.cancelled = true;
+    result.message = reason;
+    result.durationMs = m_clock.elapsed();
+    report(result);
+}
+
+void SelfTestOperation::report(const SelfTestResult& result)
+{
+    if (!m_outstanding.remove(result.subsystemId)) {
+        return;
+    }
+
+    m_results.append(result);
+    if (result.passed) {
+        m_passedCount++;
+    }
+
+    emit resultReady(result.toVariantMap());
+    emit progressChanged();
+
+    if (m_outstanding.isEmpty()) {
+        m_running = false;
+        m_elapsedMs = m_clock.elapsed();
+        emit runningChanged();
+        emit finished(hasPassed());
+    }
+}
+
+// ============================================================================
+// SelfTestRunner
+// ============================================================================
+
+SelfTestRunner::SelfTestRunner(QObject* parent)
+    : QObject(parent)
+{
+    m_pool = new QThreadPool(this);
+}
+
+SelfTestRunner::~SelfTestRunner()
+{
+    // Drop queued tests; running procedures touch only their own copies,
+    // so the pool's destructor waits for them briefly at most
+    m_pool->clear();
+}
+
+int SelfTestRunner::getMaxConcurrency() const
+{
+    return m_pool->maxThreadCount();
+}
+
+void SelfTestRunner::setMaxConcurrency(int threads)
+{
+    threads = qMax(1, threads);
+    if (m_pool->maxThreadCount() == threads) {
+        return;
+    }
+    m_pool->setMaxThreadCount(threads);
+    emit maxConcurrencyChanged();
+}
+
+SelfTestOperation* SelfTestRunner::start(const QList<RadarSubsystem*>& subsystems, int timeoutMs)
+{
+    QStringList ids;
+    ids.reserve(subsystems.size());
+    for (RadarSubsystem* subsystem : subsystems) {
+        if (subsystem && !ids.contains(subsystem->getId())) {
+            ids.append(subsystem->getId());
+        }
+    }
+
+    auto* operation = new SelfTestOperation(ids, this);
+    QPointer<SelfTestOperation> target(operation);
+    std::shared_ptr<QAtomicInt> cancelled = operation->m_cancelled;
+
+    for (RadarSubsystem* subsystem : subsystems) {
+        if (!subsystem || !operation->m_outstanding.contains(subsystem->getId())) {
+            continue;
+        }
+
+        const QString id = subsystem->getId();
+        SelfTestProcedure procedure = subsystem->prepareSelfTest();
+
+        // Timeout is judged on the GUI thread; a hung worker is simply ignored
+        if (timeoutMs > 0) {
+            QTimer::singleShot(timeoutMs, operation, [operation, id, timeoutMs]() {
+                SelfTestResult result;
+                result.subsystemId = id;
+                result.timedOut = true;
+                result.message = QString("Self-test timed out after %1 ms").arg(timeoutMs);
+                result.durationMs = timeoutMs;
+                operation->report(result);
+            });
+        }
+
+        m_pool->start([procedure, cancelled, target, id]() {
+            if (cancelled->loadAcquire()) {
+                return;
+            }
+
+            QElapsedTimer clock;
+            clock.start();
+            SelfTestResult result = procedure();
+            result.subsystemId = id;
+            result.durationMs = clock.elapsed();
+
+            // qApp outlives the runner and every operation; target is only
+            // dereferenced back on the GUI thread
+            QMetaObject::invokeMethod(QCoreApplication::instance(), [target, result]() {
+                if (target) {
+                    target->report(result);
+                }
+            }, Qt::QueuedConnection);
+        });
+    }
+
+    if (ids.isEmpty()) {
+        // Nothing to test - finish on the next event loop pass so callers
+        // can connect first
+        QMetaObject::invokeMethod(operation, [operation]() {
+            emit operation->finished(operation->hasPassed());
+        }, Qt::QueuedConnection);
+    }
+
+    return operation;
+}
+
+void SelfTestRunner::release(SelfTestOperation* operation)
+{
+    if (!operation || operation->parent() != this) {
+        return;
+    }
+    operation->cancel();
+    operation->deleteLater();
+}
+
+void SelfTestRunner::retire(const QString& subsystemId)
+{
+    const QList<SelfTestOperation*> operations =
+        findChildren<SelfTestOperation*>(QString(), Qt::FindDirectChildrenOnly);
+    for (SelfTestOperation* operation : operations) {
+        operation->cancel(subsystemId, "Subsystem removed");
+    }
+}
+
+} // namespace RadarRMP
@@ -0,0 +1,399 @@
+#include "core/SharedStateExporter.h"
+#include "core/RadarSubsystem.h"
+#include <QCoreApplication>
+#include <QDebug>
+#include <cstring>
+#include <limits>
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace RadarRMP {
+
+namespace {
+
+// Truncating, always NUL-terminated copy into a fixed field
+template <int N>
+void copyField(char (&field)[N], const QString& text)
+{
+    const QByteArray utf8 = text.toUtf8();
+    const int length = qMin(utf8.size(), N - 1);
+    std::memcpy(field, utf8.constData(), static_cast<size_t>(length));
+    std::memset(field + length, 0, static_cast<size_t>(N - length));
+}
+
+int32_t toSharedState(HealthState state)
+{
+    return static_cast<int32_t>(state);
+}
+
+#ifdef Q_OS_UNIX
+QString errnoString()
+{
+    return QString::fromLocal8Bit(std::strerror(errno));
+}
+
+/**
+ * @brief Writer pid of an existing segment, 0 if it is not one of ours
+ */
+qint64 segmentWriterPid(const QByteArray& nativeName)
+{
+    int fd = shm_open(nativeName.constData(), O_RDONLY, 0);
+    if (fd < 0) {
+        return 0;
+    }
+
+    qint64 pid = 0;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(SharedState::SegmentHeader))) {
+        void* mapped = mmap(nullptr, sizeof(SharedState::SegmentHeader), PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED) {
+            const auto* h = static_cast<const SharedState::SegmentHeader*>(mapped);
+            if (h->magic == SharedState::MAGIC) {
+                pid = h->writerPid;
+            }
+            munmap(mapped, sizeof(SharedState::SegmentHeader));
+        }
+    }
+    ::close(fd);
+    return pid;
+}
+
+bool processAlive(qint64 pid)
+{
+    // EPERM: exists but belongs to another user
+    return pid > 0 && (kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM);
+}
+#endif
+
+// Fills faultCodes[from, codes.size()); the table only ever grows
+void copyFaultCodes(SharedState::SubsystemRecord& record, const QStringList& codes, int from)
+{
+    for (int i = from; i < codes.size() && i < SharedState::MAX_FAULT_CODES; ++i) {
+        copyField(record.faultCodes[i], codes.at(i));
+    }
+}
+
+} // namespace
+
+SharedStateExporter::SharedStateExporter(QObject* parent)
+    : QObject(parent)
+    , m_capacity(0)
+    , m_segment(nullptr)
+    , m_size(0)
+    , m_highWater(0)
+{
+    // Every subsystem change passes through the coalescer's work clock,
+    // which keeps its rate while the window is hidden
+    connect(SignalCoalescer::instance(), &SignalCoalescer::workFlushed,
+            this, &SharedStateExporter::onWorkFlushed);
+}
+
+SharedStateExporter::~SharedStateExporter()
+{
+    close();
+}
+
+bool SharedStateExporter::open(const QString& name, int capacity)
+{
+    close();
+
+    m_error.clear();
+    m_name = name.startsWith('/') ? name : QLatin1Char('/') + name;
+    m_capacity = qMax(1, capacity);
+
+#ifdef Q_OS_UNIX
+    const QByteArray nativeName = m_name.toLocal8Bit();
+    const size_t size = SharedState::segmentSize(static_cast<uint32_t>(m_capacity));
+
+    int fd = shm_open(nativeName.constData(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        // Take the name over only from a writer that is gone; a live one
+        // (or a segment that is not ours) keeps it
+        const qint64 owner = segmentWriterPid(nativeName);
+        if (owner == 0 || processAlive(owner)) {
+            m_error = owner == 0
+                ? QString("%1 exists and is not a live-state segment").arg(m_name)
+                : QString("%1 is in use by process %2").arg(m_name).arg(owner);
+            emit openChanged();
+            return false;
+        }
+        shm_unlink(nativeName.constData());
+        fd = shm_open(nativeName.constData(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd < 0) {
+        m_error = QString("shm_open failed: %1").arg(errnoString());
+        emit openChanged();
+        return false;
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        m_error = QString("ftruncate failed: %1").arg(errnoString());
+        ::close(fd);
+        shm_unlink(nativeName.constData());
+        emit openChanged();
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        m_error = QString("mmap failed: %1").arg(errnoString());
+        shm_unlink(nativeName.constData());
+        emit openChanged();
+        return false;
+    }
+
+    // ftruncate zero-fills, so every sequence starts even and every slot
+    // unused; publish the header fields before the magic
+    m_segment = mapped;
+    m_size = size;
+
+    SharedState::SegmentHeader* h = header();
+    h->versionMajor = SharedState::VERSION_MAJOR;
+    h->versionMinor = SharedState::VERSION_MINOR;
+    h->headerSize = sizeof(SharedState::SegmentHeader);
+    h->slotSize = sizeof(SharedState::SubsystemSlot);
+    h->slotCapacity = static_cast<uint32_t>(m_capacity);
+    h->writerPid = static_cast<int64_t>(QCoreApplication::applicationPid());
+    h->system.state = SharedState::StateUnknown;
+    h->system.score = 100.0;
+    std::atomic_thread_fence(std::memory_order_release);
+    h->magic = SharedState::MAGIC;
+
+    m_freeSlots.clear();
+    m_highWater = 0;
+
+    emit openChanged();
+    return true;
+#else
+    m_error = "Shared-memory export requires POSIX shared memory";
+    emit openChanged();
+    return false;
+#endif
+}
+
+void SharedStateExporter::close()
+{
+    for (auto it = m_slots.constBegin(); it != m_slots.constEnd(); ++it) {
+        disconnect(it.key(), nullptr, this, nullptr);
+    }
+    m_slots.clear();
+    m_freeSlots.clear();
+    m_highWater = 0;
+
+    if (!m_segment) {
+        return;
+    }
+
+#ifdef Q_OS_UNIX
+    munmap(m_segment, m_size);
+    shm_unlink(m_name.toLocal8Bit().constData());
+#endif
+    m_segment = nullptr;
+    m_size = 0;
+    emit openChanged();
+}
+
+bool SharedStateExporter::addSubsystem(RadarSubsystem* subsystem)
+{
+    if (!m_segment || !subsystem || m_slots.contains(subsystem)) {
+        return false;
+    }
+
+    int index;
+    if (!m_freeSlots.isEmpty()) {
+        index = m_freeSlots.takeLast();
+    } else if (m_highWater < m_capacity) {
+        index = m_highWater++;
+        header()->slotHighWater.store(static_cast<uint32_t>(m_highWater), std::memory_order_release);
+    } else {
+        qWarning() << "SharedStateExporter: no free slot for" << subsystem->getId();
+        return false;
+    }
+
+    Binding binding;
+    binding.index = index;
+    binding.parameters = subsystem->getTelemetryParameters().mid(0, SharedState::MAX_PARAMETERS);
+    const QStringList codes = subsystem->getRegisteredFaultCodes();
+    binding.faultCodeCount = codes.size();
+    m_slots.insert(subsystem, binding);
+
+    SharedState::SubsystemSlot* slot = slotAt(index);
+    SharedState::beginWrite(slot->sequence);
+    writeStatic(slot, subsystem, binding.parameters, codes);
+    writeDynamic(slot, subsystem, binding.parameters);
+    SharedState::endWrite(slot->sequence);
+    touch();
+
+    connect(subsystem, &QObject::destroyed, this, [this, subsystem]() {
+        removeSubsystem(subsystem);
+    });
+    return true;
+}
+
+void SharedStateExporter::removeSubsystem(RadarSubsystem* subsystem)
+{
+    auto it = m_slots.find(subsystem);
+    if (it == m_slots.end()) {
+        return;
+    }
+
+    const int index = it.value().index;
+    m_slots.erase(it);
+    disconnect(subsystem, nullptr, this, nullptr);
+
+    if (m_segment) {
+        SharedState::SubsystemSlot* slot = slotAt(index);
+        SharedState::beginWrite(slot->sequence);
+        std::memset(&slot->record, 0, sizeof(slot->record));
+        SharedState::endWrite(slot->sequence);
+        touch();
+    }
+    m_freeSlots.append(index);
+}
+
+void SharedStateExporter::setOnCanvas(RadarSubsystem* subsystem, bool onCanvas)
+{
+    auto it = m_slots.constFind(subsystem);
+    if (!m_segment || it == m_slots.constEnd()) {
+        return;
+    }
+
+    SharedState::SubsystemSlot* slot = slotAt(it.value().index);
+    uint32_t flags = slot->record.flags;
+    flags = onCanvas ? (flags | SharedState::SlotOnCanvas) : (flags & ~SharedState::SlotOnCanvas);
+    if (flags == slot->record.flags) {
+        return;
+    }
+
+    SharedState::beginWrite(slot->sequence);
+    slot->record.flags = flags;
+    SharedState::endWrite(slot->sequence);
+    touch();
+}
+
+void SharedStateExporter::publish(RadarSubsystem* subsystem)
+{
+    auto it = m_slots.find(subsystem);
+    if (!m_segment || it == m_slots.end()) {
+        return;
+    }
+
+    SharedState::SubsystemSlot* slot = slotAt(it.value().index);
+
+    // Several notifications of one frame share a single write
+    if (slot->record.epoch == subsystem->healthEpoch()) {
+        return;
+    }
+
+    // Rules loaded at runtime register codes after the slot was assigned;
+    // name their new faultMask bits in the same write
+    const QStringList codes = subsystem->getRegisteredFaultCodes();
+    const int knownCodes = it.value().faultCodeCount;
+
+    SharedState::beginWrite(slot->sequence);
+    if (codes.size() != knownCodes) {
+        copyFaultCodes(slot->record, codes, knownCodes);
+        it.value().faultCodeCount = codes.size();
+    }
+    writeDynamic(slot, subsystem, it.value().parameters);
+    SharedState::endWrite(slot->sequence);
+    touch();
+}
+
+void SharedStateExporter::publishSystem(HealthState state, double score, int subsystemCount,
+                                        int healthyCount, int degradedCount, int failedCount,
+                                        int activeFaultCount)
+{
+    SharedState::SegmentHeader* h = header();
+    if (!h) {
+        return;
+    }
+
+    SharedState::beginWrite(h->sequence);
+    h->system.state = toSharedState(state);
+    h->system.score = score;
+    h->system.subsystemCount = static_cast<uint32_t>(subsystemCount);
+    h->system.healthyCount = static_cast<uint32_t>(healthyCount);
+    h->system.degradedCount = static_cast<uint32_t>(degradedCount);
+    h->system.failedCount = static_cast<uint32_t>(failedCount);
+    h->system.activeFaultCount = static_cast<uint32_t>(activeFaultCount);
+    h->system.updatedNs = Timestamp::now().nanoseconds();
+    SharedState::endWrite(h->sequence);
+    touch();
+}
+
+void SharedStateExporter::onWorkFlushed(const QVector<RadarSubsystem*>& subsystems)
+{
+    for (RadarSubsystem* subsystem : subsystems) {
+        publish(subsystem);
+    }
+}
+
+SharedState::SegmentHeader* SharedStateExporter::header() const
+{
+    return static_cast<SharedState::SegmentHeader*>(m_segment);
+}
+
+SharedState::SubsystemSlot* SharedStateExporter::slotAt(int index) const
+{
+    return SharedState::slotAt(m_segment, static_cast<uint32_t>(index));
+}
+
+void SharedStateExporter::writeStatic(SharedState::SubsystemSlot* slot, RadarSubsystem* subsystem,
+                                      const QStringList& parameters, const QStringList& faultCodes)
+{
+    SharedState::SubsystemRecord& record = slot->record;
+    std::memset(&record, 0, sizeof(record));
+
+    copyField(record.id, subsystem->getId());
+    copyField(record.name, subsystem->getName());
+    copyField(record.type, subsystem->getTypeName());
+
+    copyFaultCodes(record, faultCodes, 0);
+
+    record.parameterCount = static_cast<uint32_t>(parameters.size());
+    for (int i = 0; i < parameters.size(); ++i) {
+        copyField(record.parameterNames[i], parameters.at(i));
+    }
+
+    record.flags = SharedState::SlotInUse;
+}
+
+void SharedStateExporter::writeDynamic(SharedState::SubsystemSlot* slot, RadarSubsystem* subsystem,
+                                       const QStringList& parameters)
+{
+    SharedState::SubsystemRecord& record = slot->record;
+    const HealthSnapshotPtr snapshot = subsystem->healthSnapshot();
+
+    record.state = toSharedState(snapshot->state);
+    record.score = snapshot->healthScore;
+    record.epoch = snapshot->epoch;
+    record.updatedNs = Timestamp::now().nanoseconds();
+    record.faultMask = snapshot->faultMask;
+    record.activeFaultCount = static_cast<uint32_t>(snapshot->activeFaults.size());
+
+    record.flags = subsystem->isEnabled() ? (record.flags | SharedState::SlotEnabled)
+                                          : (record.flags & ~SharedState::SlotEnabled);
+
+    for (int i = 0; i < parameters.size(); ++i) {
+        const QVariant value = snapshot->telemetry.value(parameters.at(i));
+        bool ok = false;
+        const double number = value.toDouble(&ok);
+        record.values[i] = ok ? number : std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+void SharedStateExporter::touch()
+{
+    header()->heartbeat.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace RadarRMP
@@ -0,0 +1,326 @@
+#include "core/SignalCoalescer.h"
+#include "core/RadarSubsystem.h"
+#include <QCoreApplication>
+#ifndef RMP_HEADLESS
+#include <QQuickWindow>
+#endif
+
+namespace RadarRMP {
+
+SignalCoalescer* SignalCoalescer::instance()
+{
+    static QPointer<SignalCoalescer> s_instance;
+    if (!s_instance) {
+        s_instance = new SignalCoalescer(QCoreApplication::instance());
+    }
+    return s_instance;
+}
+
+SignalCoalescer::SignalCoalescer(QObject* parent)
+    : QObject(parent)
+    , m_interval(DEFAULT_FRAME_INTERVAL_MS)
+    , m_hiddenInterval(DEFAULT_HIDDEN_FRAME_INTERVAL_MS)
+    , m_backstopInterval(DEFAULT_BACKSTOP_FRAME_INTERVAL_MS)
+#ifndef RMP_HEADLESS
+    , m_updateRequested(false)
+#endif
+    , m_flushing(false)
+{
+    m_frameTimer = new QTimer(this);
+    m_frameTimer->setSingleShot(true);
+    connect(m_frameTimer, &QTimer::timeout, this, &SignalCoalescer::flush);
+
+    m_workTimer = new QTimer(this);
+    m_workTimer->setSingleShot(true);
+    connect(m_workTimer, &QTimer::timeout, this, &SignalCoalescer::flushWork);
+}
+
+SignalCoalescer::~SignalCoalescer()
+{
+    m_frameTimer->stop();
+    m_workTimer->stop();
+}
+
+int SignalCoalescer::getFrameInterval() const
+{
+    return m_interval;
+}
+
+void SignalCoalescer::setFrameInterval(int msec)
+{
+    msec = qMax(0, msec);
+    if (m_interval == msec) {
+        return;
+    }
+    m_interval = msec;
+    emit frameIntervalChanged();
+}
+
+void SignalCoalescer::setHiddenFrameInterval(int msec)
+{
+    m_hiddenInterval = qMax(0, msec);
+}
+
+void SignalCoalescer::setBackstopFrameInterval(int msec)
+{
+    m_backstopInterval = qMax(0, msec);
+}
+
+#ifndef RMP_HEADLESS
+void SignalCoalescer::attachToWindow(QQuickWindow* window)
+{
+    detachWindow();
+    if (!window) {
+        return;
+    }
+
+    m_window = window;
+
+    // afterAnimating is emitted on the GUI thread ahead of the scene graph
+    // sync, once per rendered frame
+    connect(window, &QQuickWindow::afterAnimating, this, [this]() {
+        if (pendingCount() > 0) {
+            flush();
+        }
+    });
+    connect(window, &QWindow::visibilityChanged, this, &SignalCoalescer::onWindowVisibilityChanged);
+
+    if (pendingCount() > 0) {
+        m_frameTimer->stop();
+        requestFrame();
+    }
+}
+
+void SignalCoalescer::detachWindow()
+{
+    if (m_window) {
+        disconnect(m_window, nullptr, this, nullptr);
+    }
+    m_window = nullptr;
+    m_updateRequested = false;
+}
+#endif
+
+bool SignalCoalescer::isFrameSynced() const
+{
+#ifndef RMP_HEADLESS
+    return m_window && m_window->isVisible() && m_window->visibility() != QWindow::Minimized;
+#else
+    return false;
+#endif
+}
+
+void SignalCoalescer::enqueue(RadarSubsystem* subsystem)
+{
+    if (m_flushing) {
+        // Re-dirtied by a slot during this frame - publish next frame
+        m_deferred.append(subsystem);
+        return;
+    }
+
+    m_queue.append(subsystem);
+    requestFrame();
+}
+
+void SignalCoalescer::enqueueWork(RadarSubsystem* subsystem)
+{
+    m_work.append(subsystem);
+
+#ifndef RMP_HEADLESS
+    // Without a window the frame timer already runs at frameInterval
+    if (m_window) {
+        if (!m_workTimer->isActive()) {
+            m_workTimer->start(m_interval);
+        }
+        return;
+    }
+#endif
+    requestFrame();
+}
+
+void SignalCoalescer::cancel(RadarSubsystem* subsystem)
+{
+    // Null out rather than erase so an in-progress flush keeps its indices
+    for (auto& queued : m_queue) {
+        if (queued == subsystem) {
+            queued = nullptr;
+        }
+    }
+    m_deferred.removeAll(subsystem);
+    for (auto& queued : m_work) {
+        if (queued == subsystem) {
+            queued = nullptr;
+        }
+    }
+}
+
+void SignalCoalescer::schedule(QObject* context, std::function<void()> publish)
+{
+    if (!context || m_scheduled.contains(context)) {
+        return;
+    }
+
+    m_scheduled.insert(context);
+    Task task { context, context, std::move(publish) };
+
+    // Scheduled by a subsystem slot this frame: still runs this frame.
+    // Re-scheduled by its own callback: next frame.
+    if (m_flushing && m_ranThisFrame.contains(context)) {
+        m_deferredTasks.append(task);
+        return;
+    }
+
+    m_tasks.append(task);
+    if (!m_flushing) {
+        requestFrame();
+    }
+}
+
+void SignalCoalescer::unschedule(QObject* context)
+{
+    if (!m_scheduled.remove(context)) {
+        return;
+    }
+
+    for (auto& task : m_tasks) {
+        if (task.key == context) {
+            task.context = nullptr;
+        }
+    }
+    for (auto& task : m_deferredTasks) {
+        if (task.key == context) {
+            task.context = nullptr;
+        }
+    }
+}
+
+int SignalCoalescer::pendingCount() const
+{
+    return m_queue.size() + m_deferred.size() + m_tasks.size() + m_deferredTasks.size();
+}
+
+void SignalCoalescer::flush()
+{
+    if (m_flushing) {
+        return;
+    }
+
+    // Whatever the clocks, QML never sees a frame ahead of its recomputes
+    flushWork();
+
+    m_flushing = true;
+    m_frameTimer->stop();
+#ifndef RMP_HEADLESS
+    m_updateRequested = false;
+#endif
+
+    int flushed = 0;
+    for (int i = 0; i < m_queue.size(); ++i) {
+        if (RadarSubsystem* subsystem = m_queue.at(i)) {
+            subsystem->flushPendingNotifications();
+            flushed++;
+        }
+    }
+    m_queue.clear();
+
+    // Publishers run after the subsystems so they see this frame's state;
+    // ones scheduled by the subsystem signals above are included
+    for (int i = 0; i < m_tasks.size(); ++i) {
+        const Task task = m_tasks.at(i);
+        if (!task.context) {
+            continue;
+        }
+        m_scheduled.remove(task.key);
+        m_ranThisFrame.insert(task.key);
+        task.publish();
+    }
+    m_tasks.clear();
+    m_ranThisFrame.clear();
+
+    // Only callbacks re-scheduled this frame remain pending; this also
+    // forgets contexts destroyed while queued
+    m_scheduled.clear();
+    for (const Task& task : std::as_const(m_deferredTasks)) {
+        if (task.context) {
+            m_scheduled.insert(task.key);
+        }
+    }
+
+    m_flushing = false;
+
+    // Anything dirtied during the flush goes out on the next frame
+    if (!m_deferred.isEmpty()) {
+        m_queue.swap(m_deferred);
+    }
+    if (!m_deferredTasks.isEmpty()) {
+        m_tasks.swap(m_deferredTasks);
+    }
+    if (!m_queue.isEmpty() || !m_tasks.isEmpty()) {
+        requestFrame();
+    }
+
+    if (flushed > 0) {
+        emit frameFlushed(flushed);
+    }
+}
+
+void SignalCoalescer::flushWork()
+{
+    m_workTimer->stop();
+    if (m_work.isEmpty()) {
+        return;
+    }
+
+    // Work requested while this runs (a recompute asking for another) goes
+    // to the next pass
+    QVector<RadarSubsystem*> work;
+    work.swap(m_work);
+
+    QVector<RadarSubsystem*> done;
+    done.reserve(work.size());
+    for (RadarSubsystem* subsystem : std::as_const(work)) {
+        if (subsystem) {
+            subsystem->runPendingWork();
+            done.append(subsystem);
+        }
+    }
+
+    if (!done.isEmpty()) {
+        emit workFlushed(done);
+    }
+}
+
+#ifndef RMP_HEADLESS
+void SignalCoalescer::onWindowVisibilityChanged()
+{
+    // A request made while hidden never turns into a frame
+    m_updateRequested = false;
+    if (pendingCount() > 0) {
+        m_frameTimer->stop();
+        requestFrame();
+    }
+}
+#endif
+
+void SignalCoalescer::requestFrame()
+{
+#ifndef RMP_HEADLESS
+    // Vsync-driven while visible; the timer is then only a backstop in
+    // case the window stops producing frames without telling us
+    const bool synced = isFrameSynced();
+    if (synced && !m_updateRequested) {
+        m_updateRequested = true;
+        m_window->update();
+    }
+    const int interval = !m_window ? m_interval : synced ? m_backstopInterval : m_hiddenInterval;
+#else
+    const int interval = m_interval;
+#endif
+
+    // Single-shot per frame: an idle coalescer costs nothing
+    if (!m_frameTimer->isActive()) {
+        m_frameTimer->start(interval);
+    }
+}
+
+} // namespace RadarRMP
@@ -0,0 +1,291 @@
+#include "core/StateServer.h"
+#include "core/SubsystemManager.h"
+#include "core/RadarSubsystem.h"
+#include "core/FaultManager.h"
+#include "analytics/HealthAnalytics.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonDocument>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+
+namespace RadarRMP {
+
+namespace {
+
+const int RECENT_FAULT_COUNT = 50;
+
+qint64 readProcStatusKb(const QByteArray& key)
+{
+#ifdef Q_OS_LINUX
+    QFile status(QStringLiteral("/proc/self/status"));
+    if (!status.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return -1;
+    }
+    // e.g. "VmRSS:\t   48212 kB"
+    while (!status.atEnd()) {
+        const QByteArray line = status.readLine();
+        if (line.startsWith(key) && line.size() > key.size() && line.at(key.size()) == ':') {
+            const QList<QByteArray> fields = line.mid(key.size() + 1).simplified().split(' ');
+            bool ok = false;
+            const qint64 value = fields.value(0).toLongLong(&ok);
+            return ok ? value : -1;
+        }
+    }
+#else
+    Q_UNUSED(key);
+#endif
+    return -1;
+}
+
+QByteArray reasonPhrase(int status)
+{
+    switch (status) {
+        case 200: return "OK";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 413: return "Payload Too Large";
+        default: return "Error";
+    }
+}
+
+QByteArray errorBody(const QString& message)
+{
+    QVariantMap error;
+    error["error"] = message;
+    return QJsonDocument::fromVariant(error).toJson(QJsonDocument::Compact);
+}
+
+} // namespace
+
+StateServer::StateServer(SubsystemManager* manager, HealthAnalytics* analytics, QObject* parent)
+    : QObject(parent)
+    , m_manager(manager)
+    , m_analytics(analytics)
+    , m_server(new QTcpServer(this))
+    , m_connectionCount(0)
+    , m_startupMs(-1)
+{
+    m_uptime.start();
+    connect(m_server, &QTcpServer::newConnection, this, &StateServer::onNewConnection);
+}
+
+StateServer::~StateServer()
+{
+    close();
+}
+
+bool StateServer::listen(const QHostAddress& address, quint16 port)
+{
+    close();
+    if (!m_server->listen(address, port)) {
+        m_error = m_server->errorString();
+        return false;
+    }
+    m_error.clear();
+    return true;
+}
+
+void StateServer::close()
+{
+    // Stops accepting; connections already open are still answered
+    m_server->close();
+}
+
+bool StateServer::isListening() const
+{
+    return m_server->isListening();
+}
+
+quint16 StateServer::serverPort() const
+{
+    return m_server->serverPort();
+}
+
+QVariantMap StateServer::processInfo() const
+{
+    QVariantMap info;
+    info["pid"] = QCoreApplication::applicationPid();
+    info["version"] = QCoreApplication::applicationVersion();
+#ifdef RMP_HEADLESS
+    info["headless"] = true;
+#else
+    info["headless"] = false;
+#endif
+    info["startupMs"] = m_startupMs;
+    info["uptimeMs"] = m_uptime.elapsed();
+    info["residentKb"] = residentMemoryKb();
+    info["peakResidentKb"] = peakResidentMemoryKb();
+    return info;
+}
+
+qint64 StateServer::residentMemoryKb()
+{
+    return readProcStatusKb("VmRSS");
+}
+
+qint64 StateServer::peakResidentMemoryKb()
+{
+    return readProcStatusKb("VmHWM");
+}
+
+void StateServer::onNewConnection()
+{
+    while (QTcpSocket* socket = m_server->nextPendingConnection()) {
+        if (m_connectionCount >= MAX_CONNECTIONS) {
+            socket->abort();
+            socket->deleteLater();
+            continue;
+        }
+
+        m_connectionCount++;
+        m_requests.insert(socket, QByteArray());
+        connect(socket, &QTcpSocket::readyRead, this, [this, socket]() {
+            onReadyRead(socket);
+        });
+        connect(socket, &QTcpSocket::disconnected, this, [this, socket]() {
+            m_requests.remove(socket);
+            m_connectionCount--;
+            socket->deleteLater();
+        });
+
+        // Silent, slow or never-closing clients must not hold a slot; a
+        // socket already gone takes the timer with it
+        QTimer::singleShot(CONNECTION_TIMEOUT_MS, socket, [socket]() {
+            socket->abort();
+        });
+    }
+}
+
+void StateServer::onReadyRead(QTcpSocket* socket)
+{
+    auto it = m_requests.find(socket);
+    if (it == m_requests.end()) {
+        // Already answered; ignore anything further on this connection
+        socket->readAll();
+        return;
+    }
+
+    it->append(socket->readAll());
+    const int headerEnd = it->indexOf("\r\n\r\n");
+    if (headerEnd < 0) {
+        if (it->size() > MAX_REQUEST_BYTES) {
+            m_requests.erase(it);
+            respond(socket, 413, errorBody("Request too large"));
+        }
+        return;
+    }
+
+    // "GET /path HTTP/1.1"; headers and any body are ignored
+    const QByteArray requestLine = it->left(it->indexOf("\r\n"));
+    m_requests.erase(it);
+
+    const QList<QByteArray> parts = requestLine.split(' ');
+    if (parts.size() != 3 || !parts.at(2).startsWith("HTTP/")) {
+        respond(socket, 400, errorBody("Malformed request line"));
+        return;
+    }
+    if (parts.at(0) != "GET") {
+        respond(socket, 405, errorBody("Only GET is supported"));
+        return;
+    }
+
+    QString path = QString::fromUtf8(parts.at(1));
+    const int query = path.indexOf('?');
+    if (query >= 0) {
+        path.truncate(query);
+    }
+
+    QVariant document;
+    if (!route(path, document)) {
+        respond(socket, 404, errorBody(QString("No resource at %1").arg(path)));
+        return;
+    }
+    respond(socket, 200, QJsonDocument::fromVariant(document).toJson(QJsonDocument::Compact));
+}
+
+void StateServer::respond(QTcpSocket* socket, int status, const QByteArray& body)
+{
+    QByteArray response;
+    response.reserve(body.size() + 128);
+    response += "HTTP/1.1 " + QByteArray::number(status) + ' ' + reasonPhrase(status) + "\r\n";
+    response += "Content-Type: application/json\r\n";
+    response += "Content-Length: " + QByteArray::number(body.size()) + "\r\n";
+    response += "Cache-Control: no-store\r\n";
+    response += "Connection: close\r\n\r\n";
+    response += body;
+
+    socket->write(response);
+    // Closes once the response has been written out
+    socket->disconnectFromHost();
+}
+
+bool StateServer::route(const QString& path, QVariant& document) const
+{
+    if (path == "/" || path == "/state") {
+        document = stateDocument();
+        return true;
+    }
+    if (path == "/faults") {
+        document = faultsDocument();
+        return true;
+    }
+    if (path == "/analytics") {
+        document = analyticsDocument();
+        return true;
+    }
+    if (path == "/process") {
+        document = processInfo();
+        return true;
+    }
+
+    static const QString subsystemPrefix = QStringLiteral("/subsystems/");
+    if (path.startsWith(subsystemPrefix) && m_manager) {
+        document = m_manager->getSubsystemById(path.mid(subsystemPrefix.size()));
+        return document.isValid();
+    }
+    return false;
+}
+
+QVariantMap StateServer::stateDocument() const
+{
+    QVariantMap state;
+    if (m_manager) {
+        state["system"] = m_manager->getSystemHealthSummary();
+
+        const QList<RadarSubsystem*> subsystems = m_manager->getAllSubsystems();
+        QVariantList list;
+        list.reserve(subsystems.size());
+        for (RadarSubsystem* subsystem : subsystems) {
+            list.append(m_manager->getSubsystemById(subsystem->getId()));
+        }
+        state["subsystems"] = list;
+    }
+    state["process"] = processInfo();
+    return state;
+}
+
+QVariantMap StateServer::faultsDocument() const
+{
+    QVariantMap faults;
+    FaultManager* faultManager = m_manager ? m_manager->getFaultManager() : nullptr;
+    if (faultManager) {
+        faults["active"] = faultManager->getActiveFaultsVariant();
+        faults["recent"] = faultManager->getRecentFaultsVariant(RECENT_FAULT_COUNT);
+    }
+    return faults;
+}
+
+QVariantMap StateServer::analyticsDocument() const
+{
+    QVariantMap analytics;
+    if (m_analytics) {
+        analytics["faultStatistics"] = m_analytics->getFaultStatistics();
+        analytics["subsystemRanking"] = m_analytics->getSubsystemRanking();
+    }
+    return analytics;
+}
+
+} // namespace RadarRMP
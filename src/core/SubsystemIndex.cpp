@@ -0,0 +1,221 @@
+#include "core/SubsystemIndex.h"
+
+namespace RadarRMP {
+
+namespace {
+
+int stateFromString(const QString& text)
+{
+    if (text == "OK") return static_cast<int>(HealthState::OK);
+    if (text == "DEGRADED") return static_cast<int>(HealthState::DEGRADED);
+    if (text == "FAIL") return static_cast<int>(HealthState::FAIL);
+    if (text == "UNKNOWN") return static_cast<int>(HealthState::UNKNOWN);
+    return -1;
+}
+
+} // namespace
+
+SubsystemIndex::Filter SubsystemIndex::filterFromVariantMap(const QVariantMap& map) const
+{
+    // Out-of-range values make smallestCandidateSet() pick the empty set
+    Filter filter;
+    if (map.contains("type")) {
+        filter.type = m_typeByName.value(map.value("type").toString(), TYPE_COUNT);
+    }
+    if (map.contains("state")) {
+        const int state = stateFromString(map.value("state").toString().toUpper());
+        filter.state = state >= 0 ? state : STATE_COUNT;
+    }
+    if (map.contains("tag")) {
+        filter.tags.append(map.value("tag").toString());
+    }
+    if (map.contains("tags")) {
+        filter.tags.append(map.value("tags").toStringList());
+    }
+    return filter;
+}
+
+SubsystemIndex::SubsystemIndex()
+    : m_byType(TYPE_COUNT)
+    , m_byState(STATE_COUNT)
+{
+}
+
+void SubsystemIndex::insert(RadarSubsystem* subsystem, SubsystemType type, const QString& typeName,
+                            HealthState state)
+{
+    if (!subsystem || m_entries.contains(subsystem)) {
+        return;
+    }
+
+    Entry entry;
+    entry.type = type;
+    entry.state = state;
+    m_entries.insert(subsystem, entry);
+
+    m_all.insert(subsystem);
+    m_byType[static_cast<int>(type)].insert(subsystem);
+    m_byState[static_cast<int>(state)].insert(subsystem);
+    m_typeByName.insert(typeName, static_cast<int>(type));
+}
+
+void SubsystemIndex::remove(RadarSubsystem* subsystem)
+{
+    auto it = m_entries.find(subsystem);
+    if (it == m_entries.end()) {
+        return;
+    }
+
+    const Entry& entry = it.value();
+    m_all.remove(subsystem);
+    m_byType[static_cast<int>(entry.type)].remove(subsystem);
+    m_byState[static_cast<int>(entry.state)].remove(subsystem);
+    for (const QString& tag : entry.tags) {
+        auto bucket = m_byTag.find(tag);
+        if (bucket != m_byTag.end()) {
+            bucket->remove(subsystem);
+            if (bucket->isEmpty()) {
+                m_byTag.erase(bucket);
+            }
+        }
+    }
+    m_entries.erase(it);
+}
+
+bool SubsystemIndex::updateState(RadarSubsystem* subsystem, HealthState state)
+{
+    auto it = m_entries.find(subsystem);
+    if (it == m_entries.end() || it->state == state) {
+        return false;
+    }
+
+    m_byState[static_cast<int>(it->state)].remove(subsystem);
+    m_byState[static_cast<int>(state)].insert(subsystem);
+    it->state = state;
+    return true;
+}
+
+bool SubsystemIndex::addTag(RadarSubsystem* subsystem, const QString& tag)
+{
+    auto it = m_entries.find(subsystem);
+    if (it == m_entries.end() || tag.isEmpty() || it->tags.contains(tag)) {
+        return false;
+    }
+
+    it->tags.append(tag);
+    m_byTag[tag].insert(subsystem);
+    return true;
+}
+
+bool SubsystemIndex::removeTag(RadarSubsystem* subsystem, const QString& tag)
+{
+    auto it = m_entries.find(subsystem);
+    if (it == m_entries.end() || !it->tags.removeOne(tag)) {
+        return false;
+    }
+
+    auto bucket = m_byTag.find(tag);
+    if (bucket != m_byTag.end()) {
+        bucket->remove(subsystem);
+        if (bucket->isEmpty()) {
+            m_byTag.erase(bucket);
+        }
+    }
+    return true;
+}
+
+QStringList SubsystemIndex::tags(RadarSubsystem* subsystem) const
+{
+    auto it = m_entries.constFind(subsystem);
+    return it != m_entries.constEnd() ? it->tags : QStringList();
+}
+
+const SubsystemIndex::Set& SubsystemIndex::byType(SubsystemType type) const
+{
+    return m_byType.at(static_cast<int>(type));
+}
+
+const SubsystemIndex::Set& SubsystemIndex::byState(HealthState state) const
+{
+    return m_byState.at(static_cast<int>(state));
+}
+
+const SubsystemIndex::Set& SubsystemIndex::byTag(const QString& tag) const
+{
+    auto it = m_byTag.constFind(tag);
+    return it != m_byTag.constEnd() ? it.value() : m_empty;
+}
+
+const SubsystemIndex::Set* SubsystemIndex::smallestCandidateSet(const Filter& filter) const
+{
+    const Set* smallest = &m_all;
+
+    auto consider = [&smallest](const Set& candidate) {
+        if (candidate.size() < smallest->size()) {
+            smallest = &candidate;
+        }
+    };
+
+    if (filter.type >= 0) {
+        consider(filter.type < TYPE_COUNT ? m_byType.at(filter.type) : m_empty);
+    }
+    if (filter.state >= 0) {
+        consider(filter.state < STATE_COUNT ? m_byState.at(filter.state) : m_empty);
+    }
+    for (const QString& tag : filter.tags) {
+        consider(byTag(tag));
+    }
+    return smallest;
+}
+
+bool SubsystemIndex::matches(const Entry& entry, const Filter& filter) const
+{
+    if (filter.type >= 0 && static_cast<int>(entry.type) != filter.type) {
+        return false;
+    }
+    if (filter.state >= 0 && static_cast<int>(entry.state) != filter.state) {
+        return false;
+    }
+    for (const QString& tag : filter.tags) {
+        if (!entry.tags.contains(tag)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QList<RadarSubsystem*> SubsystemIndex::query(const Filter& filter) const
+{
+    // Walk only the most selective bucket and check the rest per entry
+    const Set* candidates = smallestCandidateSet(filter);
+
+    QList<RadarSubsystem*> result;
+    result.reserve(candidates->size());
+    for (RadarSubsystem* subsystem : *candidates) {
+        if (matches(m_entries.value(subsystem), filter)) {
+            result.append(subsystem);
+        }
+    }
+    return result;
+}
+
+int SubsystemIndex::count(const Filter& filter) const
+{
+    const Set* candidates = smallestCandidateSet(filter);
+
+    // Single-criterion filters are answered by the bucket size
+    const int criteria = (filter.type >= 0 ? 1 : 0) + (filter.state >= 0 ? 1 : 0) + filter.tags.size();
+    if (criteria <= 1) {
+        return candidates->size();
+    }
+
+    int matched = 0;
+    for (RadarSubsystem* subsystem : *candidates) {
+        if (matches(m_entries.value(subsystem), filter)) {
+            matched++;
+        }
+    }
+    return matched;
+}
+
+} // namespace RadarRMP
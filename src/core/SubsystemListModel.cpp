@@ -1,4 +1,5 @@
 #include "core/SubsystemListModel.h"
+#include <algorithm>
 
 namespace RadarRMP {
 
@@ -21,38 +22,44 @@ int SubsystemListModel::rowCount(const QModelIndex& parent) const
 
 QVariant SubsystemListModel::data(const QModelIndex& index, int role) const
 {
-    if (!index.isValid() || index.row() < 0 || index.row() >= m_subsystems.size()) {
+    if (!index.isValid()) {
         return QVariant();
     }
-    
-    RadarSubsystem* sub = m_subsystems.at(index.row());
-    if (!sub) {
+    return cachedData(index.row(), role);
+}
+
+QVariant SubsystemListModel::cachedData(int row, int role) const
+{
+    if (row < 0 || row >= m_cache.size() || role < IdRole || role > OnCanvasRole) {
         return QVariant();
     }
-    
-    switch (role) {
-        case IdRole:
-            return sub->getId();
-        case NameRole:
-            return sub->getName();
-        case TypeRole:
-            return sub->getTypeName();
-        case DescriptionRole:
-            return sub->getDescription();
-        case HealthStateRole:
-            return sub->getHealthStateString();
-        case HealthScoreRole:
-            return sub->getHealthScore();
-        case StatusMessageRole:
-            return sub->getStatusMessage();
-        case FaultCountRole:
-            return sub->getFaultCount();
-        case EnabledRole:
-            return sub->isEnabled();
-        case OnCanvasRole:
-            return m_onCanvasIds.contains(sub->getId());
-        default:
-            return QVariant();
+    return m_cache.at(row).values[role - IdRole];
+}
+
+void SubsystemListModel::cacheStatic(RowCache& cache, RadarSubsystem* sub) const
+{
+    cache.values[IdRole - IdRole] = sub->getId();
+    cache.values[NameRole - IdRole] = sub->getName();
+    cache.values[TypeRole - IdRole] = sub->getTypeName();
+    cache.values[DescriptionRole - IdRole] = sub->getDescription();
+    cache.values[EnabledRole - IdRole] = sub->isEnabled();
+    cache.values[OnCanvasRole - IdRole] = m_onCanvasIds.contains(sub->getId());
+}
+
+void SubsystemListModel::cacheHealth(RowCache& cache, RadarSubsystem* sub) const
+{
+    // One shared snapshot covers all health roles
+    const HealthSnapshotPtr snapshot = sub->healthSnapshot();
+    cache.values[HealthStateRole - IdRole] = healthStateToString(snapshot->state);
+    cache.values[HealthScoreRole - IdRole] = snapshot->healthScore;
+    cache.values[StatusMessageRole - IdRole] = snapshot->statusMessage;
+    cache.values[FaultCountRole - IdRole] = snapshot->activeFaults.size();
+}
+
+void SubsystemListModel::setCached(int row, int role, const QVariant& value)
+{
+    if (row >= 0 && row < m_cache.size()) {
+        m_cache[row].values[role - IdRole] = value;
     }
 }
 
@@ -79,18 +86,24 @@ void SubsystemListModel::addSubsystem(RadarSubsystem* subsystem)
     }
     
     int index = m_subsystems.size();
+    RowCache cache;
+    cacheStatic(cache, subsystem);
+    cacheHealth(cache, subsystem);
+    
     beginInsertRows(QModelIndex(), index, index);
     m_subsystems.append(subsystem);
     m_indexMap[subsystem->getId()] = index;
+    m_cache.append(cache);
+    m_dirtyMask.append(0);
     endInsertRows();
     
-    // Connect signals for updates - use Qt::QueuedConnection to batch updates
+    // Notifications only set dirty bits; flushChanges() batches the emits
     connect(subsystem, &RadarSubsystem::healthChanged,
-            this, &SubsystemListModel::onSubsystemDataChanged,
-            Qt::QueuedConnection);
+            this, &SubsystemListModel::onSubsystemHealthChanged);
     connect(subsystem, &RadarSubsystem::faultsChanged,
-            this, &SubsystemListModel::onSubsystemDataChanged,
-            Qt::QueuedConnection);
+            this, &SubsystemListModel::onSubsystemFaultsChanged);
+    connect(subsystem, &RadarSubsystem::enabledChanged,
+            this, &SubsystemListModel::onSubsystemEnabledChanged);
 }
 
 void SubsystemListModel::removeSubsystem(const QString& id)
@@ -111,6 +124,16 @@ void SubsystemListModel::removeSubsystem(const QString& id)
     m_indexMap.remove(id);
     m_onCanvasIds.remove(id);
     
+    // Shift cached and pending dirty rows past the removed one
+    m_cache.removeAt(index);
+    m_dirtyMask.removeAt(index);
+    m_dirtyRows.removeAll(index);
+    for (int& row : m_dirtyRows) {
+        if (row > index) {
+            row--;
+        }
+    }
+    
     // Rebuild index map
     for (int i = index; i < m_subsystems.size(); ++i) {
         m_indexMap[m_subsystems[i]->getId()] = i;
@@ -132,6 +155,9 @@ void SubsystemListModel::clear()
     m_subsystems.clear();
     m_indexMap.clear();
     m_onCanvasIds.clear();
+    m_cache.clear();
+    m_dirtyMask.clear();
+    m_dirtyRows.clear();
     endResetModel();
 }
 
@@ -174,8 +200,8 @@ void SubsystemListModel::setOnCanvas(const QString& id, bool onCanvas)
         m_onCanvasIds.remove(id);
     }
     
-    QModelIndex modelIdx = index(idx);
-    emit dataChanged(modelIdx, modelIdx, {OnCanvasRole});
+    setCached(idx, OnCanvasRole, onCanvas);
+    markRowDirty(idx, roleBit(OnCanvasRole));
 }
 
 bool SubsystemListModel::isOnCanvas(const QString& id) const
@@ -183,25 +209,129 @@ bool SubsystemListModel::isOnCanvas(const QString& id) const
     return m_onCanvasIds.contains(id);
 }
 
-void SubsystemListModel::onSubsystemDataChanged()
+void SubsystemListModel::markDirty(int row, const QVector<int>& roles)
+{
+    quint32 mask = 0;
+    for (int role : roles) {
+        if (role >= IdRole && role <= OnCanvasRole) {
+            mask |= roleBit(role);
+        }
+    }
+    markRowDirty(row, mask);
+}
+
+void SubsystemListModel::markRowDirty(int row, quint32 roleMask)
+{
+    if (row < 0 || row >= m_dirtyMask.size() || roleMask == 0) {
+        return;
+    }
+    
+    if (m_dirtyMask[row] == 0) {
+        m_dirtyRows.append(row);
+        if (m_dirtyRows.size() == 1) {
+            emit changesPending();
+        }
+    }
+    m_dirtyMask[row] |= roleMask;
+}
+
+int SubsystemListModel::senderRow(RadarSubsystem** subsystem) const
 {
     RadarSubsystem* sub = qobject_cast<RadarSubsystem*>(sender());
-    if (sub) {
-        refreshSubsystem(sub->getId());
+    *subsystem = sub;
+    return sub ? indexOf(sub->getId()) : -1;
+}
+
+void SubsystemListModel::onSubsystemHealthChanged()
+{
+    RadarSubsystem* sub = nullptr;
+    int row = senderRow(&sub);
+    if (row < 0) {
+        return;
+    }
+    
+    // Fault count travels in the same snapshot; it is marked dirty by
+    // faultsChanged when it actually changes
+    cacheHealth(m_cache[row], sub);
+    markRowDirty(row, roleBit(HealthStateRole) | roleBit(HealthScoreRole) | roleBit(StatusMessageRole));
+}
+
+void SubsystemListModel::onSubsystemFaultsChanged()
+{
+    RadarSubsystem* sub = nullptr;
+    int row = senderRow(&sub);
+    if (row < 0) {
+        return;
+    }
+    
+    cacheHealth(m_cache[row], sub);
+    markRowDirty(row, roleBit(FaultCountRole));
+}
+
+void SubsystemListModel::onSubsystemEnabledChanged()
+{
+    RadarSubsystem* sub = nullptr;
+    int row = senderRow(&sub);
+    if (row < 0) {
+        return;
+    }
+    
+    setCached(row, EnabledRole, sub->isEnabled());
+    markRowDirty(row, roleBit(EnabledRole));
+}
+
+QVector<int> SubsystemListModel::rolesFromMask(quint32 mask)
+{
+    QVector<int> roles;
+    while (mask != 0) {
+        roles.append(IdRole + qCountTrailingZeroBits(mask));
+        mask &= mask - 1;
+    }
+    return roles;
+}
+
+void SubsystemListModel::flushChanges()
+{
+    if (m_dirtyRows.isEmpty()) {
+        return;
+    }
+    
+    // Detach first so slots reacting to dataChanged can mark rows again
+    QVector<int> rows;
+    rows.swap(m_dirtyRows);
+    std::sort(rows.begin(), rows.end());
+    
+    QVector<quint32> masks(rows.size());
+    for (int i = 0; i < rows.size(); ++i) {
+        masks[i] = m_dirtyMask[rows.at(i)];
+        m_dirtyMask[rows.at(i)] = 0;
+    }
+    
+    // One signal per run of adjacent rows sharing the same dirty roles
+    int i = 0;
+    while (i < rows.size()) {
+        int first = rows.at(i);
+        int last = first;
+        quint32 mask = masks.at(i);
+        while (i + 1 < rows.size() && rows.at(i + 1) == last + 1 && masks.at(i + 1) == mask) {
+            ++i;
+            ++last;
+        }
+        emit dataChanged(index(first), index(last), rolesFromMask(mask));
+        ++i;
     }
 }
 
 void SubsystemListModel::refreshSubsystem(const QString& id)
 {
-    int idx = indexOf(id);
-    if (idx < 0) {
+    int row = indexOf(id);
+    if (row < 0) {
         return;
     }
     
-    QModelIndex modelIdx = index(idx);
-    emit dataChanged(modelIdx, modelIdx, {
-        HealthStateRole, HealthScoreRole, StatusMessageRole, FaultCountRole
-    });
+    cacheHealth(m_cache[row], m_subsystems.at(row));
+    markRowDirty(row, roleBit(HealthStateRole) | roleBit(HealthScoreRole) |
+                              roleBit(StatusMessageRole) | roleBit(FaultCountRole));
 }
 
 void SubsystemListModel::refreshAll()
@@ -210,6 +340,17 @@ void SubsystemListModel::refreshAll()
         return;
     }
     
+    // Full refresh supersedes anything pending
+    for (int row : m_dirtyRows) {
+        m_dirtyMask[row] = 0;
+    }
+    m_dirtyRows.clear();
+    
+    for (int row = 0; row < m_subsystems.size(); ++row) {
+        cacheStatic(m_cache[row], m_subsystems.at(row));
+        cacheHealth(m_cache[row], m_subsystems.at(row));
+    }
+    
     emit dataChanged(index(0), index(m_subsystems.size() - 1));
 }
 
@@ -240,29 +381,29 @@ QVariant ActiveSubsystemModel::data(const QModelIndex& index, int role) const
         return QVariant();
     }
     
-    QString id = m_activeIds.at(index.row());
-    RadarSubsystem* sub = m_sourceModel->getSubsystemById(id);
-    if (!sub) {
+    // Served from the source model's role cache; no subsystem access
+    int sourceRow = m_sourceModel->indexOf(m_activeIds.at(index.row()));
+    if (sourceRow < 0) {
         return QVariant();
     }
     
     switch (role) {
         case IdRole:
-            return sub->getId();
+            return m_sourceModel->cachedData(sourceRow, SubsystemListModel::IdRole);
         case NameRole:
-            return sub->getName();
+            return m_sourceModel->cachedData(sourceRow, SubsystemListModel::NameRole);
         case TypeRole:
-            return sub->getTypeName();
+            return m_sourceModel->cachedData(sourceRow, SubsystemListModel::TypeRole);
         case HealthStateRole:
-            return sub->getHealthStateString();
+            return m_sourceModel->cachedData(sourceRow, SubsystemListModel::HealthStateRole);
         case HealthScoreRole:
-            return sub->getHealthScore();
+            return m_sourceModel->cachedData(sourceRow, SubsystemListModel::HealthScoreRole);
         case FaultCountRole:
-            return sub->getFaultCount();
+            return m_sourceModel->cachedData(sourceRow, SubsystemListModel::FaultCountRole);
         case EnabledRole:
-            return sub->isEnabled();
+            return m_sourceModel->cachedData(sourceRow, SubsystemListModel::EnabledRole);
         case SubsystemObjectRole:
-            return QVariant::fromValue(sub);
+            return QVariant::fromValue(m_sourceModel->getSubsystem(sourceRow));
         default:
             return QVariant();
     }
@@ -309,6 +450,7 @@ void ActiveSubsystemModel::addToCanvas(const QString& id)
     int index = m_activeIds.size();
     beginInsertRows(QModelIndex(), index, index);
     m_activeIds.append(id);
+    m_activeIndex.insert(id, index);
     m_sourceModel->setOnCanvas(id, true);
     endInsertRows();
     
@@ -317,13 +459,17 @@ void ActiveSubsystemModel::addToCanvas(const QString& id)
 
 void ActiveSubsystemModel::removeFromCanvas(const QString& id)
 {
-    int index = m_activeIds.indexOf(id);
+    int index = m_activeIndex.value(id, -1);
     if (index < 0) {
         return;
     }
     
     beginRemoveRows(QModelIndex(), index, index);
     m_activeIds.removeAt(index);
+    m_activeIndex.remove(id);
+    for (int i = index; i < m_activeIds.size(); ++i) {
+        m_activeIndex[m_activeIds.at(i)] = i;
+    }
     if (m_sourceModel) {
         m_sourceModel->setOnCanvas(id, false);
     }
@@ -332,17 +478,96 @@ void ActiveSubsystemModel::removeFromCanvas(const QString& id)
     emit countChanged();
 }
 
-void ActiveSubsystemModel::onSourceDataChanged()
+int ActiveSubsystemModel::mapSourceRole(int sourceRole)
+{
+    switch (sourceRole) {
+        case SubsystemListModel::IdRole:
+            return IdRole;
+        case SubsystemListModel::NameRole:
+            return NameRole;
+        case SubsystemListModel::TypeRole:
+            return TypeRole;
+        case SubsystemListModel::HealthStateRole:
+            return HealthStateRole;
+        case SubsystemListModel::HealthScoreRole:
+            return HealthScoreRole;
+        case SubsystemListModel::FaultCountRole:
+            return FaultCountRole;
+        case SubsystemListModel::EnabledRole:
+            return EnabledRole;
+        default:
+            return -1;  // Description, status message, canvas flag: not exposed here
+    }
+}
+
+void ActiveSubsystemModel::onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                                               const QVector<int>& roles)
+{
+    if (m_activeIds.isEmpty() || !m_sourceModel) {
+        return;
+    }
+    
+    // Empty source roles mean "everything"; otherwise keep only ours
+    QVector<int> activeRoles;
+    for (int role : roles) {
+        int mapped = mapSourceRole(role);
+        if (mapped >= 0) {
+            activeRoles.append(mapped);
+        }
+    }
+    if (!roles.isEmpty() && activeRoles.isEmpty()) {
+        return;
+    }
+    
+    const int top = topLeft.row();
+    const int bottom = bottomRight.row();
+    
+    // Walk whichever side is smaller: the changed range or the canvas
+    QVector<int> rows;
+    if (bottom - top + 1 <= m_activeIds.size()) {
+        for (int sourceRow = top; sourceRow <= bottom; ++sourceRow) {
+            RadarSubsystem* sub = m_sourceModel->getSubsystem(sourceRow);
+            int row = sub ? m_activeIndex.value(sub->getId(), -1) : -1;
+            if (row >= 0) {
+                rows.append(row);
+            }
+        }
+    } else {
+        for (int row = 0; row < m_activeIds.size(); ++row) {
+            int sourceRow = m_sourceModel->indexOf(m_activeIds.at(row));
+            if (sourceRow >= top && sourceRow <= bottom) {
+                rows.append(row);
+            }
+        }
+    }
+    
+    emitRuns(rows, activeRoles);
+}
+
+void ActiveSubsystemModel::emitRuns(QVector<int> rows, const QVector<int>& roles)
 {
-    // Propagate data changes to active items
-    if (!m_activeIds.isEmpty()) {
-        emit dataChanged(index(0), index(m_activeIds.size() - 1));
+    if (rows.isEmpty()) {
+        return;
+    }
+    
+    std::sort(rows.begin(), rows.end());
+    
+    int i = 0;
+    while (i < rows.size()) {
+        int first = rows.at(i);
+        int last = first;
+        while (i + 1 < rows.size() && rows.at(i + 1) == last + 1) {
+            ++i;
+            ++last;
+        }
+        emit dataChanged(index(first), index(last), roles);
+        ++i;
     }
 }
 
 void ActiveSubsystemModel::refreshSubsystem(const QString& id)
 {
-    int idx = m_activeIds.indexOf(id);
+    int idx = m_activeIndex.value(id, -1);
     if (idx < 0) {
         return;
     }
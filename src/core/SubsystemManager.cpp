@@ -1,8 +1,25 @@
 #include "core/SubsystemManager.h"
 #include <QCoreApplication>
+#include <QThreadPool>
+#include <QDebug>
+#include <algorithm>
+#include <memory>
 
 namespace RadarRMP {
 
+namespace {
+
+// Index buckets are unordered; callers get the id order of m_subsystems
+QList<RadarSubsystem*> sortedById(QList<RadarSubsystem*> subsystems)
+{
+    std::sort(subsystems.begin(), subsystems.end(), [](RadarSubsystem* a, RadarSubsystem* b) {
+        return a->getId() < b->getId();
+    });
+    return subsystems;
+}
+
+} // namespace
+
 SubsystemManager::SubsystemManager(QObject* parent)
     : QObject(parent)
     , m_systemHealthState(HealthState::UNKNOWN)
@@ -10,24 +27,33 @@ SubsystemManager::SubsystemManager(QObject* parent)
     , m_cachedHealthyCount(0)
     , m_cachedDegradedCount(0)
     , m_cachedFailedCount(0)
-    , m_updateInterval(100)  // 100ms throttle interval
+    , m_healthyCount(0)
+    , m_degradedCount(0)
+    , m_failedCount(0)
+    , m_enabledCount(0)
+    , m_scoreSum(0.0)
     , m_healthUpdatePending(false)
+    , m_telemetryHistoryCapacity(0)
+    , m_sharedStateExporter(nullptr)
 {
     m_faultManager = new FaultManager(this);
+    m_selfTestRunner = new SelfTestRunner(this);
+    m_batchPool = new QThreadPool(this);
+    m_rollup = new HealthRollup(this);
     
     // Create models
     m_subsystemModel = new SubsystemListModel(this);
     m_activeModel = new ActiveSubsystemModel(this);
     m_activeModel->setSourceModel(m_subsystemModel);
     
+    // Rows dirtied without a health change (fault count, canvas, enabled)
+    // still need a tick to be flushed
+    connect(m_subsystemModel, &SubsystemListModel::changesPending,
+            this, &SubsystemManager::scheduleHealthUpdate);
+    
     // Connect active model count changes
     connect(m_activeModel, &ActiveSubsystemModel::countChanged,
             this, &SubsystemManager::activeSubsystemsChanged);
-    
-    // Throttle timer - coalesces rapid updates into single UI refresh
-    m_throttleTimer = new QTimer(this);
-    m_throttleTimer->setSingleShot(true);
-    connect(m_throttleTimer, &QTimer::timeout, this, &SubsystemManager::onThrottledUpdate);
 }
 
 SubsystemManager::~SubsystemManager()
@@ -43,6 +69,10 @@ void SubsystemManager::registerSubsystem(RadarSubsystem* subsystem)
     
     m_subsystems[subsystem->getId()] = subsystem;
     
+    if (m_telemetryHistoryCapacity > 0) {
+        subsystem->setTelemetryHistoryCapacity(m_telemetryHistoryCapacity);
+    }
+    
     // Take ownership if no parent
     if (!subsystem->parent()) {
         subsystem->setParent(this);
@@ -52,6 +82,13 @@ void SubsystemManager::registerSubsystem(RadarSubsystem* subsystem)
     m_subsystemModel->addSubsystem(subsystem);
     
     connectSubsystemSignals(subsystem);
+    m_index.insert(subsystem, subsystem->getType(), subsystem->getTypeName(), HealthState::UNKNOWN);
+    m_contributions.insert(subsystem, Contribution());
+    refreshContribution(subsystem);
+    
+    if (m_sharedStateExporter) {
+        m_sharedStateExporter->addSubsystem(subsystem);
+    }
     
     emit subsystemsChanged();
     scheduleHealthUpdate();
@@ -67,16 +104,38 @@ void SubsystemManager::unregisterSubsystem(const QString& id)
     m_activeModel->removeFromCanvas(id);
     
     RadarSubsystem* subsystem = m_subsystems.take(id);
+    m_batchEpochs.remove(subsystem);
+    m_detailCache.remove(subsystem);
+    applyContribution(m_contributions.take(subsystem), -1);
+    m_index.remove(subsystem);
+    m_rollup->detachLeaf(id);
+    
+    if (m_sharedStateExporter) {
+        m_sharedStateExporter->removeSubsystem(subsystem);
+    }
     
-    // Remove from model
+    // Remove from models
     m_subsystemModel->removeSubsystem(id);
+    if (TelemetryListModel* telemetryModel = m_telemetryModels.take(subsystem)) {
+        telemetryModel->deleteLater();
+    }
     
     // Clear any active faults
     m_faultManager->clearAllFaults(id);
+    m_faultManager->releaseSubsystemFaultModel(id);
+    
+    // Running BIT workers only hold a copy; report its tests as removed
+    m_selfTestRunner->retire(id);
+    m_selfTestRunner->release(m_subsystemSelfTests.take(id));
     
-    // Don't delete if it has a different parent
+    // Don't delete if it has a different parent; one still being updated
+    // by an applyBatch() worker goes once that batch finishes
     if (subsystem->parent() == this) {
-        subsystem->deleteLater();
+        if (m_batchInFlight.contains(subsystem)) {
+            m_batchDeferredDeletes.insert(subsystem);
+        } else {
+            subsystem->deleteLater();
+        }
     }
     
     emit subsystemsChanged();
@@ -95,15 +154,66 @@ QList<RadarSubsystem*> SubsystemManager::getAllSubsystems() const
 
 QList<RadarSubsystem*> SubsystemManager::getSubsystemsByType(SubsystemType type) const
 {
-    QList<RadarSubsystem*> result;
+    return sortedById(m_index.byType(type).values());
+}
+
+QList<RadarSubsystem*> SubsystemManager::getSubsystemsByState(HealthState state) const
+{
+    return sortedById(m_index.byState(state).values());
+}
+
+QList<RadarSubsystem*> SubsystemManager::getSubsystemsByTag(const QString& tag) const
+{
+    return sortedById(m_index.byTag(tag).values());
+}
+
+QList<RadarSubsystem*> SubsystemManager::findSubsystems(const SubsystemIndex::Filter& filter) const
+{
+    return sortedById(m_index.query(filter));
+}
+
+bool SubsystemManager::placeInHierarchy(const QString& subsystemId, const QString& nodeId, double weight)
+{
+    RadarSubsystem* subsystem = m_subsystems.value(subsystemId);
+    if (!subsystem || !m_rollup->attachLeaf(subsystemId, nodeId, weight)) {
+        return false;
+    }
     
-    for (auto* subsystem : m_subsystems) {
-        if (subsystem->getType() == type) {
-            result.append(subsystem);
-        }
+    const Contribution contribution = m_contributions.value(subsystem);
+    m_rollup->updateLeaf(subsystemId, contribution.state, contribution.score, contribution.enabled);
+    return true;
+}
+
+bool SubsystemManager::tagSubsystem(const QString& subsystemId, const QString& tag)
+{
+    if (!m_index.addTag(m_subsystems.value(subsystemId), tag)) {
+        return false;
     }
     
-    return result;
+    emit subsystemTagsChanged(subsystemId);
+    return true;
+}
+
+bool SubsystemManager::untagSubsystem(const QString& subsystemId, const QString& tag)
+{
+    if (!m_index.removeTag(m_subsystems.value(subsystemId), tag)) {
+        return false;
+    }
+    
+    emit subsystemTagsChanged(subsystemId);
+    return true;
+}
+
+QStringList SubsystemManager::getSubsystemTags(const QString& subsystemId) const
+{
+    return m_index.tags(m_subsystems.value(subsystemId));
+}
+
+QStringList SubsystemManager::getAllTags() const
+{
+    QStringList tags = m_index.allTags();
+    tags.sort();
+    return tags;
 }
 
 void SubsystemManager::addToCanvas(const QString& subsystemId)
@@ -113,12 +223,20 @@ void SubsystemManager::addToCanvas(const QString& subsystemId)
     }
     
     m_activeModel->addToCanvas(subsystemId);
+    setContributionOnCanvas(m_subsystems.value(subsystemId), true);
+    if (m_sharedStateExporter) {
+        m_sharedStateExporter->setOnCanvas(m_subsystems.value(subsystemId), true);
+    }
     scheduleHealthUpdate();
 }
 
 void SubsystemManager::removeFromCanvas(const QString& subsystemId)
 {
     m_activeModel->removeFromCanvas(subsystemId);
+    setContributionOnCanvas(m_subsystems.value(subsystemId), false);
+    if (m_sharedStateExporter) {
+        m_sharedStateExporter->setOnCanvas(m_subsystems.value(subsystemId), false);
+    }
     scheduleHealthUpdate();
 }
 
@@ -166,39 +284,73 @@ QVariant SubsystemManager::getSubsystemById(const QString& id) const
         return QVariant();
     }
     
+    // Every change (enable state included) bumps the epoch
+    const HealthSnapshotPtr snapshot = sub->healthSnapshot();
+    DetailCache& cache = m_detailCache[sub];
+    if (cache.epoch == snapshot->epoch) {
+        return cache.value;
+    }
+    
+    QVariantList faults;
+    faults.reserve(snapshot->activeFaults.size());
+    for (const FaultCode& fault : snapshot->activeFaults) {
+        QVariantMap faultMap;
+        faultMap["code"] = fault.code;
+        faultMap["description"] = fault.description;
+        faultMap["severity"] = faultSeverityToString(fault.severity);
+        faultMap["timestamp"] = fault.timestamp.toDateTime();
+        faultMap["active"] = fault.active;
+        faults.append(faultMap);
+    }
+    
     QVariantMap map;
     map["id"] = sub->getId();
     map["name"] = sub->getName();
     map["type"] = sub->getTypeName();
     map["description"] = sub->getDescription();
-    map["healthState"] = sub->getHealthStateString();
-    map["healthScore"] = sub->getHealthScore();
-    map["statusMessage"] = sub->getStatusMessage();
-    map["telemetry"] = sub->getTelemetry();
-    map["faults"] = sub->getFaults();
-    map["faultCount"] = sub->getFaultCount();
+    map["healthState"] = healthStateToString(snapshot->state);
+    map["healthScore"] = snapshot->healthScore;
+    map["statusMessage"] = snapshot->statusMessage;
+    map["telemetry"] = snapshot->telemetry;     // Shared with the snapshot
+    map["faults"] = faults;
+    map["faultCount"] = snapshot->activeFaults.size();
     map["enabled"] = sub->isEnabled();
     
-    return map;
+    cache.epoch = snapshot->epoch;
+    cache.value = map;
+    return cache.value;
 }
 
 QVariantList SubsystemManager::getSubsystemsByTypeVariant(const QString& typeName) const
+{
+    QVariantMap filter;
+    filter["type"] = typeName;
+    return findSubsystemsVariant(filter);
+}
+
+QVariantList SubsystemManager::findSubsystemsVariant(const QVariantMap& filter) const
 {
     QVariantList list;
     
-    for (auto* subsystem : m_subsystems) {
-        if (subsystem->getTypeName() == typeName) {
-            QVariantMap map;
-            map["id"] = subsystem->getId();
-            map["name"] = subsystem->getName();
-            map["healthState"] = subsystem->getHealthStateString();
-            list.append(map);
-        }
+    const QList<RadarSubsystem*> matches = findSubsystems(m_index.filterFromVariantMap(filter));
+    list.reserve(matches.size());
+    for (auto* subsystem : matches) {
+        QVariantMap map;
+        map["id"] = subsystem->getId();
+        map["name"] = subsystem->getName();
+        map["type"] = subsystem->getTypeName();
+        map["healthState"] = subsystem->getHealthStateString();
+        list.append(map);
     }
     
     return list;
 }
 
+int SubsystemManager::countSubsystems(const QVariantMap& filter) const
+{
+    return m_index.count(m_index.filterFromVariantMap(filter));
+}
+
 int SubsystemManager::getTotalSubsystemCount() const
 {
     return m_subsystems.size();
@@ -229,42 +381,299 @@ FaultManager* SubsystemManager::getFaultManager() const
     return m_faultManager;
 }
 
+SelfTestOperation* SubsystemManager::runSystemSelfTest(int timeoutMs)
+{
+    // One system BIT at a time; callers joining late get the running one
+    if (m_systemSelfTest && m_systemSelfTest->isRunning()) {
+        return m_systemSelfTest;
+    }
+    
+    if (m_systemSelfTest) {
+        m_selfTestRunner->release(m_systemSelfTest);
+    }
+    
+    SelfTestOperation* operation = m_selfTestRunner->start(m_subsystems.values(), timeoutMs);
+    connect(operation, &SelfTestOperation::finished,
+            this, &SubsystemManager::systemSelfTestFinished);
+    m_systemSelfTest = operation;
+    
+    emit systemSelfTestChanged();
+    return operation;
+}
+
+SelfTestOperation* SubsystemManager::runSubsystemSelfTest(const QString& subsystemId, int timeoutMs)
+{
+    RadarSubsystem* subsystem = m_subsystems.value(subsystemId, nullptr);
+    if (!subsystem) {
+        return nullptr;
+    }
+    
+    // As for the system BIT: a running test is shared, a finished one is
+    // released, so repeated runs from QML don't pile up operations
+    QPointer<SelfTestOperation>& latest = m_subsystemSelfTests[subsystemId];
+    if (latest && latest->isRunning()) {
+        return latest;
+    }
+    if (latest) {
+        m_selfTestRunner->release(latest);
+    }
+    
+    latest = m_selfTestRunner->start({subsystem}, timeoutMs);
+    return latest;
+}
+
+void SubsystemManager::setTelemetryHistoryCapacity(int samples)
+{
+    m_telemetryHistoryCapacity = qMax(0, samples);
+    for (auto* subsystem : m_subsystems) {
+        subsystem->setTelemetryHistoryCapacity(m_telemetryHistoryCapacity);
+    }
+}
+
+QVariantList SubsystemManager::getTelemetryHistory(const QString& subsystemId, const QString& paramName,
+                                                   int maxSamples) const
+{
+    RadarSubsystem* subsystem = m_subsystems.value(subsystemId, nullptr);
+    return subsystem ? subsystem->getTelemetryHistory(paramName, maxSamples) : QVariantList();
+}
+
+TelemetryListModel* SubsystemManager::getTelemetryModel(const QString& subsystemId)
+{
+    RadarSubsystem* subsystem = m_subsystems.value(subsystemId, nullptr);
+    if (!subsystem) {
+        return nullptr;
+    }
+    
+    // Parented, so the QML engine never takes ownership
+    TelemetryListModel*& model = m_telemetryModels[subsystem];
+    if (!model) {
+        model = new TelemetryListModel(subsystem, this);
+    }
+    return model;
+}
+
+int SubsystemManager::applyBatch(const SubsystemUpdateBatch& updates, bool parallel)
+{
+    // Merge repeated ids so each subsystem is evaluated once per cycle
+    QList<RadarSubsystem*> targets;
+    QHash<RadarSubsystem*, QVariantMap> merged;
+    targets.reserve(updates.size());
+    merged.reserve(updates.size());
+    
+    for (const SubsystemUpdate& update : updates) {
+        RadarSubsystem* subsystem = m_subsystems.value(update.subsystemId, nullptr);
+        if (!subsystem || update.data.isEmpty()) {
+            continue;
+        }
+        auto it = merged.find(subsystem);
+        if (it == merged.end()) {
+            targets.append(subsystem);
+            merged.insert(subsystem, update.data);
+        } else {
+            for (auto field = update.data.constBegin(); field != update.data.constEnd(); ++field) {
+                it->insert(field.key(), field.value());
+            }
+        }
+    }
+    
+    if (targets.isEmpty()) {
+        return 0;
+    }
+    
+    if (parallel && targets.size() > 1) {
+        // updateData() is safe off the GUI thread. The last worker hands the
+        // cycle back to finishBatch(); the GUI thread does not wait for it.
+        auto remaining = std::make_shared<QAtomicInt>(targets.size());
+        for (RadarSubsystem* subsystem : targets) {
+            m_batchInFlight[subsystem]++;
+        }
+        for (RadarSubsystem* subsystem : targets) {
+            const QVariantMap data = merged.value(subsystem);
+            m_batchPool->start([this, subsystem, data, targets, remaining]() {
+                subsystem->updateData(data);
+                if (!remaining->deref()) {
+                    QMetaObject::invokeMethod(this, [this, targets]() {
+                        finishBatch(targets, true);
+                    }, Qt::QueuedConnection);
+                }
+            });
+        }
+        return targets.size();
+    }
+    
+    for (RadarSubsystem* subsystem : targets) {
+        subsystem->updateData(merged.value(subsystem));
+    }
+    finishBatch(targets, false);
+    return targets.size();
+}
+
+void SubsystemManager::finishBatch(const QList<RadarSubsystem*>& targets, bool pooled)
+{
+    QList<RadarSubsystem*> applied;
+    applied.reserve(targets.size());
+    for (RadarSubsystem* subsystem : targets) {
+        if (pooled) {
+            auto inFlight = m_batchInFlight.find(subsystem);
+            if (--inFlight.value() == 0) {
+                m_batchInFlight.erase(inFlight);
+                if (m_batchDeferredDeletes.remove(subsystem)) {
+                    // Unregistered while its worker was still running
+                    subsystem->deleteLater();
+                    continue;
+                }
+            }
+        }
+        if (m_contributions.contains(subsystem)) {
+            if (pooled) {
+                // Workers posted their notifications; collect them now
+                // instead of waiting for the queued hop
+                subsystem->receivePostedSignals();
+            }
+            applied.append(subsystem);
+        }
+    }
+    if (applied.isEmpty()) {
+        return;
+    }
+    
+    // Emit the subsystems' own signals now rather than on the next frame,
+    // so the aggregate below sees the state QML is told about
+    SignalCoalescer* coalescer = SignalCoalescer::instance();
+    coalescer->flush();
+    
+    QStringList ids;
+    ids.reserve(applied.size());
+    for (RadarSubsystem* subsystem : applied) {
+        m_batchEpochs.insert(subsystem, subsystem->healthEpoch());
+        refreshContribution(subsystem);
+        ids.append(subsystem->getId());
+    }
+    
+    // One aggregate recompute and one model pass for the whole cycle
+    m_healthUpdatePending = false;
+    coalescer->unschedule(this);
+    computeSystemHealth();
+    m_subsystemModel->flushChanges();
+    
+    emit batchApplied(ids);
+}
+
+int SubsystemManager::applyBatch(const QVariantMap& updates, bool parallel)
+{
+    SubsystemUpdateBatch batch;
+    batch.reserve(updates.size());
+    for (auto it = updates.constBegin(); it != updates.constEnd(); ++it) {
+        batch.append({it.key(), it.value().toMap()});
+    }
+    return applyBatch(batch, parallel);
+}
+
+bool SubsystemManager::enableSharedStateExport(const QString& segmentName, int capacity)
+{
+    disableSharedStateExport();
+    
+    auto* exporter = new SharedStateExporter(this);
+    if (!exporter->open(segmentName, qMax(capacity, m_subsystems.size()))) {
+        qWarning() << "Shared-memory export disabled:" << exporter->getErrorString();
+        delete exporter;
+        return false;
+    }
+    
+    m_sharedStateExporter = exporter;
+    for (auto* subsystem : m_subsystems) {
+        exporter->addSubsystem(subsystem);
+        exporter->setOnCanvas(subsystem, isOnCanvas(subsystem->getId()));
+    }
+    // Follows the coalescer's work clock, not the (possibly hidden)
+    // window's frames; subsystemCount and activeFaultCount also move
+    // without a health change
+    connect(SignalCoalescer::instance(), &SignalCoalescer::workFlushed,
+            exporter, [this](const QVector<RadarSubsystem*>& subsystems) {
+        for (RadarSubsystem* subsystem : subsystems) {
+            refreshContribution(subsystem);
+        }
+        publishSharedSystemState();
+    });
+    connect(this, &SubsystemManager::systemHealthChanged,
+            exporter, [this]() { publishSharedSystemState(); });
+    connect(this, &SubsystemManager::subsystemsChanged,
+            exporter, [this]() { publishSharedSystemState(); });
+    connect(m_faultManager, &FaultManager::faultsChanged,
+            exporter, [this]() { publishSharedSystemState(); });
+    publishSharedSystemState();
+    return true;
+}
+
+void SubsystemManager::disableSharedStateExport()
+{
+    if (!m_sharedStateExporter) {
+        return;
+    }
+    delete m_sharedStateExporter;
+    m_sharedStateExporter = nullptr;
+}
+
+void SubsystemManager::publishSharedSystemState()
+{
+    if (!m_sharedStateExporter) {
+        return;
+    }
+    // Live counts rather than the values last published to QML
+    HealthState state;
+    double score;
+    evaluateSystemHealth(&state, &score);
+    m_sharedStateExporter->publishSystem(state, score, m_subsystems.size(), m_healthyCount,
+                                         m_degradedCount, m_failedCount,
+                                         m_faultManager->getTotalActiveFaults());
+}
+
+int SubsystemManager::getBatchConcurrency() const
+{
+    return m_batchPool->maxThreadCount();
+}
+
+void SubsystemManager::setBatchConcurrency(int threads)
+{
+    m_batchPool->setMaxThreadCount(qMax(1, threads));
+}
+
 void SubsystemManager::setUpdateInterval(int msec)
 {
-    m_updateInterval = qMax(50, msec);  // Minimum 50ms throttle
+    SignalCoalescer::instance()->setFrameInterval(qMax(1, msec));
 }
 
 int SubsystemManager::getUpdateInterval() const
 {
-    return m_updateInterval;
+    return SignalCoalescer::instance()->getFrameInterval();
 }
 
 void SubsystemManager::startUpdates()
 {
-    // No-op now - updates are driven by HealthSimulator and throttled
+    // No-op now - updates are driven by HealthSimulator and the frame clock
 }
 
 void SubsystemManager::stopUpdates()
 {
-    m_throttleTimer->stop();
+    m_healthUpdatePending = false;
+    SignalCoalescer::instance()->unschedule(this);
 }
 
 void SubsystemManager::scheduleHealthUpdate()
 {
-    // Mark that an update is needed
-    m_healthUpdatePending = true;
-    
-    // CRITICAL FIX: Only start timer if not already active
-    // This prevents timer restart spam which was causing event queue buildup
-    // Previous behavior: Timer would restart on EVERY call, delaying actual processing
-    // New behavior: Once scheduled, we wait for the timer to fire naturally
-    if (!m_throttleTimer->isActive()) {
-        m_throttleTimer->start(m_updateInterval);
+    if (m_healthUpdatePending) {
+        return;
     }
-    // If timer is already running, the pending flag ensures we process when it fires
+    
+    // One publish per frame no matter how many subsystems changed; runs
+    // after the frame's subsystem notifications
+    m_healthUpdatePending = true;
+    SignalCoalescer::instance()->schedule(this, [this]() {
+        onFrameUpdate();
+    });
 }
 
-void SubsystemManager::onThrottledUpdate()
+void SubsystemManager::onFrameUpdate()
 {
     if (!m_healthUpdatePending) {
         return;
@@ -275,11 +684,9 @@ void SubsystemManager::onThrottledUpdate()
     // Compute health state
     computeSystemHealth();
     
-    // OPTIMIZATION: Only refresh models if there are active subsystems
-    // Refreshing empty models was wasting CPU cycles
-    if (m_activeModel->count() > 0) {
-        m_subsystemModel->refreshAll();
-    }
+    // Only rows/roles marked dirty since the last frame are re-read by
+    // QML; the active model forwards the subset it shows
+    m_subsystemModel->flushChanges();
 }
 
 void SubsystemManager::resetAll()
@@ -295,8 +702,18 @@ void SubsystemManager::onSubsystemHealthChanged()
 {
     RadarSubsystem* subsystem = qobject_cast<RadarSubsystem*>(sender());
     if (subsystem) {
+        // Already reported by applyBatch() unless it changed again since
+        auto batched = m_batchEpochs.find(subsystem);
+        if (batched != m_batchEpochs.end()) {
+            bool covered = subsystem->isUnchangedSince(batched.value());
+            m_batchEpochs.erase(batched);
+            if (covered) {
+                return;
+            }
+        }
+        
+        refreshContribution(subsystem);
         emit subsystemHealthChanged(subsystem->getId());
-        m_activeModel->refreshSubsystem(subsystem->getId());
     }
     scheduleHealthUpdate();
 }
@@ -309,12 +726,16 @@ void SubsystemManager::onSubsystemFaultOccurred(const QString& faultCode, const
         fault.code = faultCode;
         fault.description = description;
         fault.subsystemId = subsystem->getId();
-        fault.timestamp = QDateTime::currentDateTime();
+        fault.timestamp = Timestamp::now();
         fault.active = true;
         fault.severity = FaultSeverity::WARNING;
         
         m_faultManager->registerFault(fault);
-        emit subsystemFaultOccurred(subsystem->getId(), faultCode);
+        
+        // Consequences of an active upstream fault stay quiet
+        if (!m_faultManager->isConsequential(fault.subsystemId, faultCode)) {
+            emit subsystemFaultOccurred(subsystem->getId(), faultCode);
+        }
     }
 }
 
@@ -336,55 +757,35 @@ void SubsystemManager::connectSubsystemSignals(RadarSubsystem* subsystem)
                 }, Qt::QueuedConnection);
             },
             Qt::QueuedConnection);
+    // Enabling/disabling moves the score in or out of the average even
+    // when the health state itself does not change
+    connect(subsystem, &RadarSubsystem::enabledChanged,
+            this, [this, subsystem]() {
+                refreshContribution(subsystem);
+                scheduleHealthUpdate();
+            },
+            Qt::QueuedConnection);
 }
 
 void SubsystemManager::computeSystemHealth()
 {
-    // Update cached counts
-    updateCachedCounts();
+    // Counts and score sum are kept current by the contribution helpers
+    // below; this only publishes them
+    m_cachedHealthyCount = m_healthyCount;
+    m_cachedDegradedCount = m_degradedCount;
+    m_cachedFailedCount = m_failedCount;
     
-    int activeCount = m_activeModel->count();
+    HealthState newState;
+    double newScore;
+    evaluateSystemHealth(&newState, &newScore);
     
-    if (activeCount == 0) {
-        m_systemHealthState = HealthState::UNKNOWN;
-        m_systemHealthScore = 100.0;
+    if (m_activeModel->count() == 0) {
+        m_systemHealthState = newState;
+        m_systemHealthScore = newScore;
         emit systemHealthChanged();
         return;
     }
     
-    // Compute aggregate health
-    double totalScore = 0;
-    int enabledCount = 0;
-    
-    for (int i = 0; i < m_subsystemModel->rowCount(); ++i) {
-        RadarSubsystem* sub = m_subsystemModel->getSubsystem(i);
-        if (!sub || !m_subsystemModel->isOnCanvas(sub->getId())) {
-            continue;
-        }
-        
-        if (!sub->isEnabled()) {
-            continue;
-        }
-        
-        enabledCount++;
-        totalScore += sub->getHealthScore();
-    }
-    
-    // Determine overall state based on cached counts
-    HealthState newState;
-    if (m_cachedFailedCount > 0) {
-        newState = HealthState::FAIL;
-    } else if (m_cachedDegradedCount > 0) {
-        newState = HealthState::DEGRADED;
-    } else if (enabledCount > 0) {
-        newState = HealthState::OK;
-    } else {
-        newState = HealthState::UNKNOWN;
-    }
-    
-    // Compute average score
-    double newScore = enabledCount > 0 ? totalScore / enabledCount : 100.0;
-    
     // Only emit if changed
     if (newState != m_systemHealthState || qAbs(newScore - m_systemHealthScore) > 0.01) {
         m_systemHealthState = newState;
@@ -393,36 +794,106 @@ void SubsystemManager::computeSystemHealth()
     }
 }
 
-void SubsystemManager::updateCachedCounts()
+void SubsystemManager::evaluateSystemHealth(HealthState* state, double* score) const
 {
-    int healthy = 0;
-    int degraded = 0;
-    int failed = 0;
+    if (m_activeModel->count() == 0) {
+        *state = HealthState::UNKNOWN;
+        *score = 100.0;
+        return;
+    }
     
-    for (int i = 0; i < m_subsystemModel->rowCount(); ++i) {
-        RadarSubsystem* sub = m_subsystemModel->getSubsystem(i);
-        if (!sub || !m_subsystemModel->isOnCanvas(sub->getId())) {
-            continue;
-        }
+    // Determine overall state based on the live counts
+    if (m_failedCount > 0) {
+        *state = HealthState::FAIL;
+    } else if (m_degradedCount > 0) {
+        *state = HealthState::DEGRADED;
+    } else if (m_enabledCount > 0) {
+        *state = HealthState::OK;
+    } else {
+        *state = HealthState::UNKNOWN;
+    }
+    
+    // Compute average score
+    *score = m_enabledCount > 0 ? m_scoreSum / m_enabledCount : 100.0;
+}
+
+void SubsystemManager::applyContribution(const Contribution& contribution, int sign)
+{
+    if (!contribution.onCanvas) {
+        return;
+    }
+    
+    switch (contribution.state) {
+        case HealthState::OK:
+            m_healthyCount += sign;
+            break;
+        case HealthState::DEGRADED:
+            m_degradedCount += sign;
+            break;
+        case HealthState::FAIL:
+            m_failedCount += sign;
+            break;
+        default:
+            break;
+    }
+    
+    if (contribution.enabled) {
+        m_enabledCount += sign;
+        m_scoreSum += sign * contribution.score;
         
-        switch (sub->getHealthState()) {
-            case HealthState::OK:
-                healthy++;
-                break;
-            case HealthState::DEGRADED:
-                degraded++;
-                break;
-            case HealthState::FAIL:
-                failed++;
-                break;
-            default:
-                break;
+        // Drop accumulated rounding error whenever the sum empties
+        if (m_enabledCount == 0) {
+            m_scoreSum = 0.0;
         }
     }
+}
+
+void SubsystemManager::setContribution(RadarSubsystem* subsystem, const Contribution& contribution)
+{
+    auto it = m_contributions.find(subsystem);
+    if (it == m_contributions.end()) {
+        return;
+    }
+    
+    applyContribution(it.value(), -1);
+    it.value() = contribution;
+    applyContribution(contribution, +1);
+    
+    // Hierarchy covers every placed subsystem, not just the canvas
+    m_rollup->updateLeaf(subsystem->getId(), contribution.state, contribution.score,
+                         contribution.enabled);
+}
+
+void SubsystemManager::refreshContribution(RadarSubsystem* subsystem)
+{
+    auto it = m_contributions.constFind(subsystem);
+    if (it == m_contributions.constEnd()) {
+        return;
+    }
+    
+    // One shared snapshot instead of a locked getter per field
+    const HealthSnapshotPtr snapshot = subsystem->healthSnapshot();
+    
+    Contribution contribution;
+    contribution.state = snapshot->state;
+    contribution.score = snapshot->healthScore;
+    contribution.enabled = subsystem->isEnabled();
+    contribution.onCanvas = it.value().onCanvas;
+    setContribution(subsystem, contribution);
+    
+    m_index.updateState(subsystem, snapshot->state);
+}
+
+void SubsystemManager::setContributionOnCanvas(RadarSubsystem* subsystem, bool onCanvas)
+{
+    auto it = m_contributions.constFind(subsystem);
+    if (it == m_contributions.constEnd() || it.value().onCanvas == onCanvas) {
+        return;
+    }
     
-    m_cachedHealthyCount = healthy;
-    m_cachedDegradedCount = degraded;
-    m_cachedFailedCount = failed;
+    Contribution contribution = it.value();
+    contribution.onCanvas = onCanvas;
+    setContribution(subsystem, contribution);
 }
 
 } // namespace RadarRMP
@@ -1,78 +1,529 @@
 #include "core/TelemetryData.h"
+#include <QMutex>
+#include <QMutexLocker>
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <cmath>
+#include <limits>
 
 namespace RadarRMP {
 
+// ============================================================================
+// TelemetryParameterInfo
+// ============================================================================
+
+double TelemetryParameterInfo::limitValue(Limit limit) const
+{
+    switch (limit) {
+        case Nominal:      return nominal;
+        case Min:          return minValue;
+        case Max:          return maxValue;
+        case WarningLow:   return warningLow;
+        case WarningHigh:  return warningHigh;
+        case CriticalLow:  return criticalLow;
+        case CriticalHigh: return criticalHigh;
+    }
+    return 0.0;
+}
+
+TelemetryParameterInfo TelemetryParameterInfo::fromParameter(const TelemetryParameter& param)
+{
+    TelemetryParameterInfo info;
+    info.name = param.name;
+    info.displayName = param.displayName;
+    info.unit = param.unit;
+
+    auto take = [&info](const QVariant& source, double& target, Limit flag) {
+        if (source.isValid()) {
+            target = source.toDouble();
+            info.limits |= flag;
+        }
+    };
+    take(param.nominal, info.nominal, Nominal);
+    take(param.minValue, info.minValue, Min);
+    take(param.maxValue, info.maxValue, Max);
+    take(param.warningLow, info.warningLow, WarningLow);
+    take(param.warningHigh, info.warningHigh, WarningHigh);
+    take(param.criticalLow, info.criticalLow, CriticalLow);
+    take(param.criticalHigh, info.criticalHigh, CriticalHigh);
+
+    return info;
+}
+
+bool TelemetryParameterInfo::operator==(const TelemetryParameterInfo& other) const
+{
+    return name == other.name
+        && displayName == other.displayName
+        && unit == other.unit
+        && limits == other.limits
+        && nominal == other.nominal
+        && minValue == other.minValue
+        && maxValue == other.maxValue
+        && warningLow == other.warningLow
+        && warningHigh == other.warningHigh
+        && criticalLow == other.criticalLow
+        && criticalHigh == other.criticalHigh;
+}
+
+// ============================================================================
+// TelemetrySchema
+// ============================================================================
+
+namespace {
+
+struct SchemaRegistry {
+    QMutex mutex;
+    QHash<QString, TelemetrySchemaPtr> schemas;   // Longest published table per key
+};
+
+SchemaRegistry& schemaRegistry()
+{
+    static SchemaRegistry s_registry;
+    return s_registry;
+}
+
+bool samePrefix(const TelemetrySchema& a, const TelemetrySchema& b, int count)
+{
+    if (a.parameters.size() < count || b.parameters.size() < count) {
+        return false;
+    }
+    for (int i = 0; i < count; ++i) {
+        if (a.parameters.at(i) != b.parameters.at(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+std::shared_ptr<TelemetrySchema> TelemetrySchema::copyPrefix(int count) const
+{
+    auto copy = std::make_shared<TelemetrySchema>();
+    copy->parameters = parameters.mid(0, count);
+    copy->rebuildIndices();
+    return copy;
+}
+
+void TelemetrySchema::append(const TelemetryParameterInfo& info)
+{
+    indices.insert(info.name, parameters.size());
+    parameters.append(info);
+}
+
+void TelemetrySchema::rebuildIndices()
+{
+    indices.clear();
+    for (int i = 0; i < parameters.size(); ++i) {
+        indices.insert(parameters.at(i).name, i);
+    }
+}
+
+TelemetrySchemaPtr TelemetrySchema::shared(const QString& key)
+{
+    SchemaRegistry& registry = schemaRegistry();
+    QMutexLocker locker(&registry.mutex);
+    TelemetrySchemaPtr& schema = registry.schemas[key];
+    if (!schema) {
+        schema = std::make_shared<const TelemetrySchema>();
+    }
+    return schema;
+}
+
+TelemetrySchemaPtr TelemetrySchema::extend(const QString& key, const TelemetrySchemaPtr& base,
+                                           int count, const TelemetryParameterInfo& info)
+{
+    SchemaRegistry& registry = schemaRegistry();
+    QMutexLocker locker(&registry.mutex);
+    TelemetrySchemaPtr& published = registry.schemas[key];
+
+    // Registration-time only, so comparing prefixes here is affordable
+    const bool followsPublished = published && samePrefix(*published, *base, count);
+    if (followsPublished && published->parameters.size() > count
+            && published->parameters.at(count) == info) {
+        return published;
+    }
+
+    std::shared_ptr<TelemetrySchema> extended = base->copyPrefix(count);
+    extended->append(info);
+
+    // Only the tip grows the shared table; others keep their own branch
+    if (!published || (followsPublished && published->parameters.size() == count)) {
+        published = extended;
+    }
+    return extended;
+}
+
+// ============================================================================
+// TelemetryData
+// ============================================================================
+
 TelemetryData::TelemetryData(QObject* parent)
     : QObject(parent)
-    , m_lastUpdate(QDateTime::currentDateTime())
+    , m_schema(std::make_shared<const TelemetrySchema>())
+    , m_historyCapacity(0)
+    , m_lastUpdate(Timestamp::now())
 {
 }
 
+void TelemetryData::useSharedSchema(const QString& key)
+{
+    QWriteLocker locker(&m_lock);
+
+    // Only before registration; existing columns would not line up
+    if (m_values.isEmpty()) {
+        m_schema = TelemetrySchema::shared(key);
+        m_schemaKey = key;
+    }
+}
+
+std::shared_ptr<TelemetrySchema> TelemetryData::detachSchema()
+{
+    // Private copy holding only this instance's parameters; the caller
+    // edits it before it replaces m_schema
+    std::shared_ptr<TelemetrySchema> copy = m_schema->copyPrefix(m_values.size());
+    m_schema = copy;
+    m_schemaKey.clear();
+    return copy;
+}
+
 void TelemetryData::addParameter(const TelemetryParameter& param)
 {
-    m_parameters[param.name] = param;
-    m_lastUpdate = QDateTime::currentDateTime();
+    QWriteLocker locker(&m_lock);
+
+    TelemetryParameterInfo info = TelemetryParameterInfo::fromParameter(param);
+    const int count = m_values.size();
+    int index = m_schema->indexOf(param.name);
+
+    if (index >= 0 && index < count) {
+        // Re-registration (reset) - metadata normally unchanged
+        if (m_schema->parameters.at(index) != info) {
+            detachSchema()->parameters[index] = info;
+        }
+    } else {
+        bool followsShared = index == count && m_schema->parameters.at(index) == info;
+        if (!followsShared) {
+            // Never in place: other instances may be reading this schema
+            if (!m_schemaKey.isEmpty()) {
+                m_schema = TelemetrySchema::extend(m_schemaKey, m_schema, count, info);
+            } else {
+                std::shared_ptr<TelemetrySchema> extended = m_schema->copyPrefix(count);
+                extended->append(info);
+                m_schema = extended;
+            }
+            index = count;
+        }
+
+        m_values.append(QVariant());
+        m_timestamps.append(Timestamp());
+        m_valid.append(0);
+        if (m_historyCapacity > 0) {
+            m_history.append(RingBuffer<TelemetrySample>(m_historyCapacity));
+        }
+    }
+
+    m_values[index] = param.value;
+    m_timestamps[index] = Timestamp::fromDateTime(param.timestamp);
+    m_valid[index] = param.isValid ? 1 : 0;
+
+    m_lastUpdate = Timestamp::now();
+    locker.unlock();
     emit dataChanged();
 }
 
 void TelemetryData::removeParameter(const QString& name)
 {
-    if (m_parameters.remove(name) > 0) {
-        emit dataChanged();
+    QWriteLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    if (index < 0) {
+        return;
     }
+
+    std::shared_ptr<TelemetrySchema> schema = detachSchema();
+    schema->parameters.remove(index);
+    schema->rebuildIndices();
+    m_values.remove(index);
+    m_timestamps.remove(index);
+    m_valid.remove(index);
+    if (!m_history.isEmpty()) {
+        m_history.remove(index);
+    }
+
+    locker.unlock();
+    emit dataChanged();
 }
 
 bool TelemetryData::hasParameter(const QString& name) const
 {
-    return m_parameters.contains(name);
+    return indexOf(name) >= 0;
 }
 
 TelemetryParameter TelemetryData::getParameter(const QString& name) const
 {
-    return m_parameters.value(name);
+    QReadLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    if (index < 0) {
+        return TelemetryParameter();
+    }
+
+    const TelemetryParameterInfo& info = m_schema->parameters.at(index);
+    TelemetryParameter param(info.name, info.displayName, info.unit);
+    param.value = m_values.at(index);
+    param.nominal = info.limitVariant(TelemetryParameterInfo::Nominal);
+    param.minValue = info.limitVariant(TelemetryParameterInfo::Min);
+    param.maxValue = info.limitVariant(TelemetryParameterInfo::Max);
+    param.warningLow = info.limitVariant(TelemetryParameterInfo::WarningLow);
+    param.warningHigh = info.limitVariant(TelemetryParameterInfo::WarningHigh);
+    param.criticalLow = info.limitVariant(TelemetryParameterInfo::CriticalLow);
+    param.criticalHigh = info.limitVariant(TelemetryParameterInfo::CriticalHigh);
+    param.timestamp = m_timestamps.at(index).toDateTime();
+    param.isValid = m_valid.at(index) != 0;
+    return param;
 }
 
 QStringList TelemetryData::getParameterNames() const
 {
-    return m_parameters.keys();
+    QReadLocker locker(&m_lock);
+
+    QStringList names;
+    names.reserve(m_values.size());
+    for (int i = 0; i < m_values.size(); ++i) {
+        names.append(m_schema->parameters.at(i).name);
+    }
+    return names;
 }
 
-QVariant TelemetryData::getValue(const QString& name) const
+TelemetryParameterInfo TelemetryData::parameterInfo(const QString& name) const
+{
+    QReadLocker locker(&m_lock);
+
+    // A copy: a concurrent addParameter() or limit edit replaces m_schema
+    int index = findIndex(name);
+    return index >= 0 ? m_schema->parameters.at(index) : TelemetryParameterInfo();
+}
+
+const TelemetryParameterInfo& TelemetryData::infoAt(int index) const
+{
+    return m_schema->parameters.at(index);
+}
+
+QVariantMap TelemetryData::getParameterMetadata(const QString& name) const
+{
+    QReadLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    return index >= 0 ? metadataAt(index) : TelemetryParameter().toVariantMap();
+}
+
+QVariantMap TelemetryData::metadataAt(int index) const
+{
+    const TelemetryParameterInfo& info = m_schema->parameters.at(index);
+
+    // Same keys as TelemetryParameter::toVariantMap()
+    QVariantMap map;
+    map["name"] = info.name;
+    map["displayName"] = info.displayName;
+    map["unit"] = info.unit;
+    map["value"] = m_values.at(index);
+    map["nominal"] = info.limitVariant(TelemetryParameterInfo::Nominal);
+    map["minValue"] = info.limitVariant(TelemetryParameterInfo::Min);
+    map["maxValue"] = info.limitVariant(TelemetryParameterInfo::Max);
+    map["warningLow"] = info.limitVariant(TelemetryParameterInfo::WarningLow);
+    map["warningHigh"] = info.limitVariant(TelemetryParameterInfo::WarningHigh);
+    map["criticalLow"] = info.limitVariant(TelemetryParameterInfo::CriticalLow);
+    map["criticalHigh"] = info.limitVariant(TelemetryParameterInfo::CriticalHigh);
+    map["timestamp"] = m_timestamps.at(index).toDateTime();
+    map["isValid"] = m_valid.at(index) != 0;
+    return map;
+}
+
+int TelemetryData::indexOf(const QString& name) const
+{
+    QReadLocker locker(&m_lock);
+    return findIndex(name);
+}
+
+int TelemetryData::findIndex(const QString& name) const
+{
+    // Entries past our column count belong to instances sharing the schema
+    int index = m_schema->indexOf(name);
+    return index < m_values.size() ? index : -1;
+}
+
+QString TelemetryData::nameAt(int index) const
+{
+    QReadLocker locker(&m_lock);
+
+    if (index < 0 || index >= m_values.size()) {
+        return QString();
+    }
+    return m_schema->parameters.at(index).name;
+}
+
+int TelemetryData::parameterCount() const
+{
+    QReadLocker locker(&m_lock);
+
+    return m_values.size();
+}
+
+void TelemetryData::setHistoryCapacity(int samples)
+{
+    QWriteLocker locker(&m_lock);
+
+    samples = qMax(0, samples);
+    if (samples == m_historyCapacity) {
+        return;
+    }
+
+    m_historyCapacity = samples;
+    m_history.clear();
+    if (samples > 0) {
+        m_history.fill(RingBuffer<TelemetrySample>(samples), m_values.size());
+    }
+}
+
+TelemetryHistorySpan TelemetryData::history(int index) const
+{
+    if (index < 0 || index >= m_history.size()) {
+        return TelemetryHistorySpan();
+    }
+    return m_history.at(index).span();
+}
+
+TelemetryHistorySpan TelemetryData::history(const QString& name) const
+{
+    return history(findIndex(name));
+}
+
+QVector<TelemetrySample> TelemetryData::historySamples(const QString& name, int maxSamples) const
+{
+    QReadLocker locker(&m_lock);
+
+    TelemetryHistorySpan span = history(findIndex(name));
+    int first = (maxSamples > 0 && maxSamples < span.size()) ? span.size() - maxSamples : 0;
+
+    QVector<TelemetrySample> samples;
+    samples.reserve(span.size() - first);
+    for (int i = first; i < span.size(); ++i) {
+        samples.append(span[i]);
+    }
+    return samples;
+}
+
+void TelemetryData::recordSample(int index, Timestamp timestamp, double value)
+{
+    // Numeric parameters only; strings have nothing to plot
+    if (m_history.isEmpty() || std::isnan(value)) {
+        return;
+    }
+
+    TelemetrySample sample;
+    sample.timestamp = timestamp;
+    sample.value = value;
+    m_history[index].push(sample);
+}
+
+double TelemetryData::numericValue(const QVariant& value)
 {
-    if (m_parameters.contains(name)) {
-        return m_parameters[name].value;
+    if (value.userType() == QMetaType::QString || !value.canConvert<double>()) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return value.toDouble();
+}
+
+quint8 TelemetryData::thresholdZone(const TelemetryParameterInfo& info, double v)
+{
+    if (std::isnan(v)) {
+        return TelemetryChange::Normal;
+    }
+
+    // Same precedence as the thresholdExceeded checks in setValue()
+    if (info.has(TelemetryParameterInfo::CriticalLow)
+        && TelemetryParameterInfo::belowLimit(v, info.criticalLow)) {
+        return TelemetryChange::CriticalLow;
+    }
+    if (info.has(TelemetryParameterInfo::CriticalHigh)
+        && TelemetryParameterInfo::aboveLimit(v, info.criticalHigh)) {
+        return TelemetryChange::CriticalHigh;
+    }
+    if (info.has(TelemetryParameterInfo::WarningLow)
+        && TelemetryParameterInfo::belowLimit(v, info.warningLow)) {
+        return TelemetryChange::WarningLow;
+    }
+    if (info.has(TelemetryParameterInfo::WarningHigh)
+        && TelemetryParameterInfo::aboveLimit(v, info.warningHigh)) {
+        return TelemetryChange::WarningHigh;
     }
-    return QVariant();
+    return TelemetryChange::Normal;
+}
+
+QVariant TelemetryData::getValue(const QString& name) const
+{
+    QReadLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    return index >= 0 ? m_values.at(index) : QVariant();
 }
 
 void TelemetryData::setValue(const QString& name, const QVariant& value)
 {
-    if (!m_parameters.contains(name)) {
+    QWriteLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    if (index < 0) {
         return;
     }
-    
-    TelemetryParameter& param = m_parameters[name];
-    QVariant oldValue = param.value;
-    param.value = value;
-    param.timestamp = QDateTime::currentDateTime();
-    m_lastUpdate = param.timestamp;
-    
+
+    // Like setValues(): an unchanged value is no change and no history sample
+    if (m_values.at(index) == value) {
+        return;
+    }
+
+    const TelemetryParameterInfo& info = m_schema->parameters.at(index);
+
+    TelemetryChange change;
+    change.index = index;
+    change.oldValue = numericValue(m_values.at(index));
+    change.newValue = numericValue(value);
+    change.oldZone = thresholdZone(info, change.oldValue);
+    change.newZone = thresholdZone(info, change.newValue);
+
+    m_lastUpdate = Timestamp::now();
+    m_values[index] = value;
+    m_timestamps[index] = m_lastUpdate;
+    recordSample(index, m_lastUpdate, change.newValue);
+
+    TelemetryChangeSet changeSet;
+    changeSet.timestamp = m_lastUpdate;
+    changeSet.changes.append(change);
+
+    // Signals go out unlocked so slots can read back
+    locker.unlock();
+
     // Check thresholds
-    if (value.canConvert<double>()) {
-        double v = value.toDouble();
-        
-        if (param.criticalLow.isValid() && v < param.criticalLow.toDouble()) {
+    switch (change.newZone) {
+        case TelemetryChange::CriticalLow:
             emit thresholdExceeded(name, "criticalLow");
-        } else if (param.criticalHigh.isValid() && v > param.criticalHigh.toDouble()) {
+            break;
+        case TelemetryChange::CriticalHigh:
             emit thresholdExceeded(name, "criticalHigh");
-        } else if (param.warningLow.isValid() && v < param.warningLow.toDouble()) {
+            break;
+        case TelemetryChange::WarningLow:
             emit thresholdExceeded(name, "warningLow");
-        } else if (param.warningHigh.isValid() && v > param.warningHigh.toDouble()) {
+            break;
+        case TelemetryChange::WarningHigh:
             emit thresholdExceeded(name, "warningHigh");
-        }
+            break;
+        default:
+            break;
     }
-    
+
     emit parameterChanged(name, value);
+    emit valuesChanged(changeSet);
+
     emit dataChanged();
 }
 
@@ -81,168 +532,190 @@ void TelemetryData::setValues(const QVariantMap& values)
     if (values.isEmpty()) {
         return;
     }
-    
-    bool anyChanged = false;
-    QDateTime now = QDateTime::currentDateTime();
-    
+
+    TelemetryChangeSet changeSet;
+    changeSet.timestamp = Timestamp::now();
+    changeSet.changes.reserve(values.size());
+    const Timestamp timestamp = changeSet.timestamp;
+
+    QWriteLocker locker(&m_lock);
+
     for (auto it = values.begin(); it != values.end(); ++it) {
-        if (m_parameters.contains(it.key())) {
-            TelemetryParameter& param = m_parameters[it.key()];
-            // Only update if value actually changed
-            if (param.value != it.value()) {
-                param.value = it.value();
-                param.timestamp = now;
-                anyChanged = true;
-            }
+        int index = findIndex(it.key());
+        if (index < 0) {
+            continue;
+        }
+
+        QVariant& current = m_values[index];
+        // Only update if value actually changed
+        if (current == it.value()) {
+            continue;
         }
+
+        const TelemetryParameterInfo& info = m_schema->parameters.at(index);
+
+        TelemetryChange change;
+        change.index = index;
+        change.oldValue = numericValue(current);
+        change.newValue = numericValue(it.value());
+        change.oldZone = thresholdZone(info, change.oldValue);
+        change.newZone = thresholdZone(info, change.newValue);
+        changeSet.changes.append(change);
+
+        current = it.value();
+        m_timestamps[index] = timestamp;
+        recordSample(index, timestamp, change.newValue);
     }
-    
-    // Only emit signal if something actually changed
-    if (anyChanged) {
-        m_lastUpdate = now;
+
+    // One change set per call, and only if something actually changed
+    if (!changeSet.isEmpty()) {
+        m_lastUpdate = changeSet.timestamp;
+        locker.unlock();
+        emit valuesChanged(changeSet);
         emit dataChanged();
     }
 }
 
 bool TelemetryData::isWithinLimits(const QString& name) const
 {
-    if (!m_parameters.contains(name)) {
+    QReadLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    if (index < 0) {
         return true;
     }
-    
-    const TelemetryParameter& param = m_parameters[name];
-    if (!param.value.canConvert<double>()) {
+
+    const TelemetryParameterInfo& info = m_schema->parameters.at(index);
+    double v = numericValue(m_values.at(index));
+    if (std::isnan(v)) {
         return true;
     }
-    
-    double v = param.value.toDouble();
-    
-    if (param.minValue.isValid() && v < param.minValue.toDouble()) {
+
+    if (info.has(TelemetryParameterInfo::Min) && v < info.minValue) {
         return false;
     }
-    if (param.maxValue.isValid() && v > param.maxValue.toDouble()) {
+    if (info.has(TelemetryParameterInfo::Max) && v > info.maxValue) {
         return false;
     }
-    
+
     return true;
 }
 
 bool TelemetryData::isWarning(const QString& name) const
 {
-    if (!m_parameters.contains(name)) {
-        return false;
-    }
-    
-    const TelemetryParameter& param = m_parameters[name];
-    if (!param.value.canConvert<double>()) {
+    QReadLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    if (index < 0) {
         return false;
     }
-    
-    double v = param.value.toDouble();
-    
-    bool warning = false;
-    if (param.warningLow.isValid() && v < param.warningLow.toDouble()) {
-        warning = true;
-    }
-    if (param.warningHigh.isValid() && v > param.warningHigh.toDouble()) {
-        warning = true;
-    }
-    
+
     // Not warning if critical
-    if (isCritical(name)) {
-        return false;
-    }
-    
-    return warning;
+    quint8 zone = thresholdZone(m_schema->parameters.at(index), numericValue(m_values.at(index)));
+    return zone == TelemetryChange::WarningLow || zone == TelemetryChange::WarningHigh;
 }
 
 bool TelemetryData::isCritical(const QString& name) const
 {
-    if (!m_parameters.contains(name)) {
-        return false;
-    }
-    
-    const TelemetryParameter& param = m_parameters[name];
-    if (!param.value.canConvert<double>()) {
+    QReadLocker locker(&m_lock);
+
+    int index = findIndex(name);
+    if (index < 0) {
         return false;
     }
-    
-    double v = param.value.toDouble();
-    
-    if (param.criticalLow.isValid() && v < param.criticalLow.toDouble()) {
-        return true;
-    }
-    if (param.criticalHigh.isValid() && v > param.criticalHigh.toDouble()) {
-        return true;
-    }
-    
-    return false;
+
+    quint8 zone = thresholdZone(m_schema->parameters.at(index), numericValue(m_values.at(index)));
+    return zone == TelemetryChange::CriticalLow || zone == TelemetryChange::CriticalHigh;
 }
 
 QVariantMap TelemetryData::getData() const
 {
+    QReadLocker locker(&m_lock);
+
     QVariantMap data;
-    for (auto it = m_parameters.begin(); it != m_parameters.end(); ++it) {
-        data[it.key()] = it.value().value;
+    for (int i = 0; i < m_values.size(); ++i) {
+        data.insert(m_schema->parameters.at(i).name, m_values.at(i));
     }
     return data;
 }
 
+TelemetrySnapshot TelemetryData::snapshot() const
+{
+    QReadLocker locker(&m_lock);
+
+    TelemetrySnapshot snapshot;
+    snapshot.schema = m_schema;
+    snapshot.values = m_values;
+    snapshot.valid = m_valid;
+    return snapshot;
+}
+
 QVariantMap TelemetryData::getMetadata() const
 {
+    QReadLocker locker(&m_lock);
+
     QVariantMap metadata;
-    for (auto it = m_parameters.begin(); it != m_parameters.end(); ++it) {
-        metadata[it.key()] = it.value().toVariantMap();
+    for (int i = 0; i < m_values.size(); ++i) {
+        metadata.insert(m_schema->parameters.at(i).name, metadataAt(i));
     }
     return metadata;
 }
 
 QDateTime TelemetryData::getLastUpdate() const
 {
+    QReadLocker locker(&m_lock);
+    return m_lastUpdate.toDateTime();
+}
+
+Timestamp TelemetryData::lastUpdate() const
+{
+    QReadLocker locker(&m_lock);
     return m_lastUpdate;
 }
 
 void TelemetryData::validate()
 {
-    for (auto it = m_parameters.begin(); it != m_parameters.end(); ++it) {
-        TelemetryParameter& param = it.value();
-        bool wasValid = param.isValid;
-        
-        // Check if value is within physical limits
-        if (param.value.canConvert<double>()) {
-            double v = param.value.toDouble();
-            param.isValid = true;
-            
-            if (param.minValue.isValid() && v < param.minValue.toDouble()) {
-                param.isValid = false;
-            }
-            if (param.maxValue.isValid() && v > param.maxValue.toDouble()) {
-                param.isValid = false;
-            }
+    QList<QPair<QString, bool>> changed;
+
+    QWriteLocker locker(&m_lock);
+    for (int i = 0; i < m_values.size(); ++i) {
+        double v = numericValue(m_values.at(i));
+        if (std::isnan(v)) {
+            continue;
         }
-        
-        if (wasValid != param.isValid) {
-            emit validityChanged(param.name, param.isValid);
+
+        // Check if value is within physical limits
+        const TelemetryParameterInfo& info = m_schema->parameters.at(i);
+        bool valid = !(info.has(TelemetryParameterInfo::Min) && v < info.minValue)
+                  && !(info.has(TelemetryParameterInfo::Max) && v > info.maxValue);
+
+        if (valid != (m_valid.at(i) != 0)) {
+            m_valid[i] = valid ? 1 : 0;
+            changed.append(qMakePair(info.name, valid));
         }
     }
+    locker.unlock();
+
+    for (const auto& entry : std::as_const(changed)) {
+        emit validityChanged(entry.first, entry.second);
+    }
 }
 
 bool TelemetryData::isAllValid() const
 {
-    for (const auto& param : m_parameters) {
-        if (!param.isValid) {
-            return false;
-        }
-    }
-    return true;
+    QReadLocker locker(&m_lock);
+
+    return !m_valid.contains(0);
 }
 
 QStringList TelemetryData::getInvalidParameters() const
 {
+    QReadLocker locker(&m_lock);
+
     QStringList invalid;
-    for (const auto& param : m_parameters) {
-        if (!param.isValid) {
-            invalid.append(param.name);
+    for (int i = 0; i < m_valid.size(); ++i) {
+        if (!m_valid.at(i)) {
+            invalid.append(m_schema->parameters.at(i).name);
         }
     }
     return invalid;
@@ -0,0 +1,255 @@
+#include "core/TelemetryListModel.h"
+#include "core/SignalCoalescer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RadarRMP {
+
+namespace {
+
+bool isNumber(const QVariant& value)
+{
+    switch (value.userType()) {
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+        case QMetaType::Float:
+            return true;
+        case QMetaType::Double:
+            return !std::isnan(value.toDouble());
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+TelemetryListModel::TelemetryListModel(RadarSubsystem* subsystem, QObject* parent)
+    : QAbstractListModel(parent)
+    , m_subsystem(subsystem)
+    , m_subsystemId(subsystem ? subsystem->getId() : QString())
+{
+    if (m_subsystem) {
+        // Auto connection: queued when telemetry is written off the GUI thread
+        connect(m_subsystem, &RadarSubsystem::telemetryValuesChanged,
+                this, &TelemetryListModel::onValuesChanged);
+    }
+    reload();
+}
+
+int TelemetryListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_rows.size();
+}
+
+QVariant TelemetryListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() < 0 || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const Row& row = m_rows.at(index.row());
+    switch (role) {
+        case NameRole:
+        case Qt::DisplayRole:
+            return row.info.name;
+        case DisplayNameRole:
+            return row.info.displayName;
+        case UnitRole:
+            return row.info.unit;
+        case ValueRole:
+            return row.value;
+        case IsNumericRole:
+            return isNumber(row.value);
+        case NominalRole:
+            return row.info.limitVariant(TelemetryParameterInfo::Nominal);
+        case MinValueRole:
+            return row.info.limitVariant(TelemetryParameterInfo::Min);
+        case MaxValueRole:
+            return row.info.limitVariant(TelemetryParameterInfo::Max);
+        case WarningLowRole:
+            return row.info.limitVariant(TelemetryParameterInfo::WarningLow);
+        case WarningHighRole:
+            return row.info.limitVariant(TelemetryParameterInfo::WarningHigh);
+        case CriticalLowRole:
+            return row.info.limitVariant(TelemetryParameterInfo::CriticalLow);
+        case CriticalHighRole:
+            return row.info.limitVariant(TelemetryParameterInfo::CriticalHigh);
+        case AlarmStateRole:
+            return alarmStateString(row.zone);
+        case RatioRole:
+            return ratio(row);
+        default:
+            return QVariant();
+    }
+}
+
+QHash<int, QByteArray> TelemetryListModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[NameRole] = "name";
+    roles[DisplayNameRole] = "displayName";
+    roles[UnitRole] = "unit";
+    roles[ValueRole] = "value";
+    roles[IsNumericRole] = "isNumeric";
+    roles[NominalRole] = "nominal";
+    roles[MinValueRole] = "minValue";
+    roles[MaxValueRole] = "maxValue";
+    roles[WarningLowRole] = "warningLow";
+    roles[WarningHighRole] = "warningHigh";
+    roles[CriticalLowRole] = "criticalLow";
+    roles[CriticalHighRole] = "criticalHigh";
+    roles[AlarmStateRole] = "alarmState";
+    roles[RatioRole] = "ratio";
+    return roles;
+}
+
+void TelemetryListModel::reload()
+{
+    const int oldCount = m_rows.size();
+
+    beginResetModel();
+    m_rows.clear();
+    if (m_subsystem) {
+        const QStringList names = m_subsystem->getTelemetryParameters();
+        m_rows.resize(names.size());
+        for (int i = 0; i < names.size(); ++i) {
+            loadRow(m_rows[i], names.at(i));
+        }
+    }
+    m_dirty.fill(0, m_rows.size());
+    m_dirtyRows.clear();
+    endResetModel();
+
+    if (m_rows.size() != oldCount) {
+        emit countChanged();
+    }
+}
+
+void TelemetryListModel::loadRow(Row& row, const QString& name) const
+{
+    // The metadata map is taken under the telemetry lock in one read
+    const QVariantMap metadata = m_subsystem->getTelemetryMetadata(name);
+
+    TelemetryParameter param;
+    param.name = name;
+    param.displayName = metadata.value("displayName").toString();
+    param.unit = metadata.value("unit").toString();
+    param.nominal = metadata.value("nominal");
+    param.minValue = metadata.value("minValue");
+    param.maxValue = metadata.value("maxValue");
+    param.warningLow = metadata.value("warningLow");
+    param.warningHigh = metadata.value("warningHigh");
+    param.criticalLow = metadata.value("criticalLow");
+    param.criticalHigh = metadata.value("criticalHigh");
+
+    row.info = TelemetryParameterInfo::fromParameter(param);
+    row.value = metadata.value("value");
+    row.zone = TelemetryData::thresholdZone(row.info, TelemetryData::numericValue(row.value));
+}
+
+void TelemetryListModel::onValuesChanged(const TelemetryChangeSet& changes)
+{
+    for (const TelemetryChange& change : changes.changes) {
+        if (change.index >= 0 && change.index < m_rows.size()) {
+            markDirty(change.index);
+        }
+    }
+}
+
+void TelemetryListModel::markDirty(int row)
+{
+    if (m_dirty.at(row)) {
+        return;
+    }
+    m_dirty[row] = 1;
+    m_dirtyRows.append(row);
+
+    if (m_dirtyRows.size() == 1) {
+        SignalCoalescer::instance()->schedule(this, [this]() {
+            flushChanges();
+        });
+    }
+}
+
+void TelemetryListModel::flushChanges()
+{
+    if (m_dirtyRows.isEmpty()) {
+        return;
+    }
+
+    // Re-read the latest value: several change sets may have been merged
+    QVector<int> changed;
+    changed.reserve(m_dirtyRows.size());
+    for (int rowIndex : std::as_const(m_dirtyRows)) {
+        m_dirty[rowIndex] = 0;
+
+        Row& row = m_rows[rowIndex];
+        const QVariant value = m_subsystem
+            ? m_subsystem->getTelemetryValue(row.info.name) : QVariant();
+        if (value == row.value) {
+            continue;
+        }
+        row.value = value;
+        row.zone = TelemetryData::thresholdZone(row.info, TelemetryData::numericValue(value));
+        changed.append(rowIndex);
+    }
+    m_dirtyRows.clear();
+
+    if (changed.isEmpty()) {
+        return;
+    }
+
+    // One dataChanged per contiguous run, value roles only
+    static const QVector<int> valueRoles = {
+        ValueRole, IsNumericRole, AlarmStateRole, RatioRole
+    };
+    std::sort(changed.begin(), changed.end());
+
+    int first = changed.first();
+    int last = first;
+    for (int i = 1; i <= changed.size(); ++i) {
+        if (i < changed.size() && changed.at(i) == last + 1) {
+            last = changed.at(i);
+            continue;
+        }
+        emit dataChanged(index(first), index(last), valueRoles);
+        if (i < changed.size()) {
+            first = last = changed.at(i);
+        }
+    }
+}
+
+QString TelemetryListModel::alarmStateString(quint8 zone)
+{
+    switch (zone) {
+        case TelemetryChange::CriticalLow:
+        case TelemetryChange::CriticalHigh:
+            return "critical";
+        case TelemetryChange::WarningLow:
+        case TelemetryChange::WarningHigh:
+            return "warning";
+        default:
+            return "normal";
+    }
+}
+
+double TelemetryListModel::ratio(const Row& row)
+{
+    if (!isNumber(row.value)) {
+        return 0.0;
+    }
+
+    const double min = row.info.limitOr(TelemetryParameterInfo::Min, 0.0);
+    const double max = row.info.limitOr(TelemetryParameterInfo::Max, 100.0);
+    if (max == min) {
+        return 0.5;
+    }
+    return qBound(0.0, (row.value.toDouble() - min) / (max - min), 1.0);
+}
+
+} // namespace RadarRMP
@@ -1,13 +1,25 @@
+#ifdef RMP_HEADLESS
+#include <QCoreApplication>
+#else
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
 #include <QQmlContext>
 #include <QQuickStyle>
+#include <QQuickWindow>
 #include <QtQml>
+#endif
+#include <QCommandLineParser>
+#include <QElapsedTimer>
 
 #include "core/SubsystemManager.h"
 #include "core/SubsystemListModel.h"
+#include "core/TelemetryListModel.h"
 #include "core/HealthDataPipeline.h"
 #include "core/FaultManager.h"
+#include "core/FaultListModel.h"
+#include "core/FleetStore.h"
+#include "core/SignalCoalescer.h"
+#include "core/StateServer.h"
 
 #include "subsystems/TransmitterSubsystem.h"
 #include "subsystems/ReceiverSubsystem.h"
@@ -25,35 +37,96 @@
 
 #include "analytics/HealthAnalytics.h"
 #include "analytics/TrendAnalyzer.h"
+#ifndef RMP_HEADLESS
+#include "analytics/ChartFeeder.h"
+#endif
 #include "analytics/UptimeTracker.h"
 
 using namespace RadarRMP;
 
 int main(int argc, char *argv[])
 {
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+    
+#ifdef RMP_HEADLESS
+    // Display-less node: no Qt GUI/Quick, no scene graph or render thread
+    QCoreApplication app(argc, argv);
+#else
     QGuiApplication app(argc, argv);
+#endif
     
     app.setApplicationName("Radar Maintenance Processor");
     app.setApplicationVersion("1.0.0");
     app.setOrganizationName("RadarRMP");
     
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption fleetOption("fleet",
+        "Reserve <count> lightweight fleet instances in the struct-of-arrays store. "
+        "Rows stay UNKNOWN until an ingest source writes them; they are not simulated.", "count", "0");
+    parser.addOption(fleetOption);
+#ifdef RMP_HEADLESS
+    QCommandLineOption historyOption("history",
+        "Keep the last <samples> changes of each telemetry parameter. Default: off.", "samples", "0");
+#else
+    // The Trends tab reads these rings, so the GUI keeps them by default
+    QCommandLineOption historyOption("history",
+        "Keep the last <samples> changes of each telemetry parameter for the Trends view; 0 turns it off.",
+        "samples", "300");
+#endif
+    parser.addOption(historyOption);
+    QCommandLineOption shmOption("shm",
+        "Publish live subsystem state to the POSIX shared-memory segment <name> for external readers.", "name");
+    parser.addOption(shmOption);
+#ifdef RMP_HEADLESS
+    QCommandLineOption serveOption("serve",
+        "Serve JSON state to remote viewers over HTTP on <port>.", "port",
+        QString::number(StateServer::DEFAULT_PORT));
+#else
+    QCommandLineOption serveOption("serve",
+        "Also serve JSON state to remote viewers over HTTP on <port>.", "port");
+#endif
+    parser.addOption(serveOption);
+    QCommandLineOption bindOption("bind",
+        "Address the state server listens on. Default: localhost only; the server has no authentication.",
+        "address", QHostAddress(QHostAddress::LocalHost).toString());
+    parser.addOption(bindOption);
+    parser.process(app);
+    
+#ifndef RMP_HEADLESS
     // Set the Quick Controls style
     QQuickStyle::setStyle("Universal");
+#endif
     
     // Register meta types
     qRegisterMetaType<RadarRMP::HealthState>("RadarRMP::HealthState");
     qRegisterMetaType<RadarRMP::FaultSeverity>("RadarRMP::FaultSeverity");
     qRegisterMetaType<RadarRMP::SubsystemType>("RadarRMP::SubsystemType");
+    qRegisterMetaType<RadarRMP::Timestamp>("RadarRMP::Timestamp");
     qRegisterMetaType<RadarRMP::FaultCode>("RadarRMP::FaultCode");
+    qRegisterMetaType<RadarRMP::TelemetryChangeSet>("RadarRMP::TelemetryChangeSet");
     
+#ifndef RMP_HEADLESS
     // Register QML types for model access
     qmlRegisterUncreatableType<RadarRMP::SubsystemListModel>("RadarRMP", 1, 0, "SubsystemListModel",
         "SubsystemListModel is managed by SubsystemManager");
     qmlRegisterUncreatableType<RadarRMP::ActiveSubsystemModel>("RadarRMP", 1, 0, "ActiveSubsystemModel",
         "ActiveSubsystemModel is managed by SubsystemManager");
+    qmlRegisterUncreatableType<RadarRMP::FleetSubsystemView>("RadarRMP", 1, 0, "FleetSubsystemView",
+        "FleetSubsystemView is managed by FleetStore");
+    qmlRegisterUncreatableType<RadarRMP::TelemetryListModel>("RadarRMP", 1, 0, "TelemetryListModel",
+        "TelemetryListModel is managed by SubsystemManager");
+    qmlRegisterUncreatableType<RadarRMP::FaultListModel>("RadarRMP", 1, 0, "FaultListModel",
+        "FaultListModel is managed by FaultManager");
+    qmlRegisterUncreatableType<RadarRMP::SelfTestOperation>("RadarRMP", 1, 0, "SelfTestOperation",
+        "SelfTestOperation is created by SubsystemManager::runSystemSelfTest");
+#endif
     
     // Create subsystem manager
     SubsystemManager* subsystemManager = new SubsystemManager();
+    subsystemManager->setTelemetryHistoryCapacity(parser.value(historyOption).toInt());
     
     // Create and register all subsystems
     TransmitterSubsystem* tx = new TransmitterSubsystem("TX-001", "Main Transmitter");
@@ -78,6 +151,12 @@ int main(int argc, char *argv[])
     subsystemManager->registerSubsystem(timing);
     subsystemManager->registerSubsystem(net);
     
+    // Loss of power takes the rest of the chain with it; report it once
+    const QStringList poweredByPsu = { "TX-001", "RX-001", "COOL-001", "SP-001", "DP-001" };
+    for (const QString& downstream : poweredByPsu) {
+        subsystemManager->getFaultManager()->addDependency(downstream, "PSU-001");
+    }
+    
     // Add default subsystems to canvas
     subsystemManager->addToCanvas("TX-001");
     subsystemManager->addToCanvas("RX-001");
@@ -85,6 +164,27 @@ int main(int argc, char *argv[])
     subsystemManager->addToCanvas("PSU-001");
     subsystemManager->addToCanvas("COOL-001");
     
+    if (parser.isSet(shmOption)) {
+        subsystemManager->enableSharedStateExport(parser.value(shmOption));
+    }
+    
+    // Large fleets live in the struct-of-arrays store; the ten full
+    // subsystems above act as per-type prototypes for names and limits
+    FleetStore* fleetStore = new FleetStore();
+    const QList<RadarSubsystem*> prototypes = { tx, rx, ant, rf, sp, dp, psu, cool, timing, net };
+    for (RadarSubsystem* prototype : prototypes) {
+        fleetStore->defineLayout(prototype->getType(), prototype);
+    }
+    
+    int fleetSize = parser.value(fleetOption).toInt();
+    if (fleetSize > 0) {
+        fleetStore->reserve(fleetSize);
+        for (int i = 0; i < prototypes.size(); ++i) {
+            int share = fleetSize / prototypes.size() + (i < fleetSize % prototypes.size() ? 1 : 0);
+            fleetStore->populate(prototypes.at(i)->getType(), share);
+        }
+    }
+    
     // Create health data pipeline
     HealthDataPipeline* pipeline = new HealthDataPipeline();
     
@@ -97,7 +197,13 @@ int main(int argc, char *argv[])
     // Create analytics
     HealthAnalytics* analytics = new HealthAnalytics(subsystemManager);
     TrendAnalyzer* trendAnalyzer = new TrendAnalyzer();
+    for (RadarSubsystem* subsystem : prototypes) {
+        trendAnalyzer->trackSubsystem(subsystem);
+    }
     UptimeTracker* uptimeTracker = new UptimeTracker();
+#ifndef RMP_HEADLESS
+    ChartFeeder* chartFeeder = new ChartFeeder(subsystemManager, analytics, trendAnalyzer);
+#endif
     
     // PERFORMANCE FIX: Removed registration loop to reduce initialization overhead
     // Previously this looped through all subsystems to register them with uptime tracker
@@ -110,6 +216,31 @@ int main(int argc, char *argv[])
     // 
     // This improves application responsiveness by reducing background processing
     
+    // Remote viewers poll JSON state; on by default when headless
+    StateServer* stateServer = nullptr;
+    if (!parser.value(serveOption).isEmpty()) {
+        const QHostAddress address(parser.value(bindOption));
+        if (address.isNull()) {
+            qCritical() << "Invalid --bind address" << parser.value(bindOption);
+            return 1;
+        }
+        stateServer = new StateServer(subsystemManager, analytics, &app);
+        const quint16 port = static_cast<quint16>(parser.value(serveOption).toUInt());
+        if (!stateServer->listen(address, port)) {
+            qCritical() << "State server could not listen on" << address.toString() << "port" << port << ":"
+                        << stateServer->getErrorString();
+            return 1;
+        }
+        qInfo() << "Serving state on" << address.toString() << "port" << stateServer->serverPort();
+    }
+    
+#ifdef RMP_HEADLESS
+    // Live for the whole run; without QML nothing else holds them
+    Q_UNUSED(pipeline);
+    Q_UNUSED(faultInjector);
+    Q_UNUSED(uptimeTracker);
+    Q_UNUSED(fleetStore);
+#else
     // Create QML engine
     QQmlApplicationEngine engine;
     
@@ -124,6 +255,8 @@ int main(int argc, char *argv[])
     engine.rootContext()->setContextProperty("healthAnalytics", analytics);
     engine.rootContext()->setContextProperty("trendAnalyzer", trendAnalyzer);
     engine.rootContext()->setContextProperty("uptimeTracker", uptimeTracker);
+    engine.rootContext()->setContextProperty("chartFeeder", chartFeeder);
+    engine.rootContext()->setContextProperty("fleetStore", fleetStore);
     
     // Load QML
     const QUrl url(QStringLiteral("qrc:/qml/Main.qml"));
@@ -136,9 +269,24 @@ int main(int argc, char *argv[])
     
     engine.load(url);
     
+    // C++ -> QML notifications are published once per rendered frame of the
+    // main window (a timer stands in while it is hidden)
+    if (!engine.rootObjects().isEmpty()) {
+        if (auto* window = qobject_cast<QQuickWindow*>(engine.rootObjects().first())) {
+            SignalCoalescer::instance()->attachToWindow(window);
+        }
+    }
+#endif
+    
     // Start the simulator - this now drives all updates
-    // SubsystemManager uses throttled updates triggered by subsystem signals
     simulator->start();
     
+    const qint64 startupMs = startupTimer.elapsed();
+    if (stateServer) {
+        stateServer->setStartupTime(startupMs);
+    }
+    qInfo() << "Startup took" << startupMs << "ms, resident memory"
+            << StateServer::residentMemoryKb() << "kB";
+    
     return app.exec();
 }
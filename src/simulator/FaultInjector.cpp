@@ -249,7 +249,7 @@ void FaultInjector::doInjectFault(const FaultConfig& config)
         fault.description = QString("Injected fault: %1").arg(config.faultCode);
         fault.severity = config.severity;
         fault.subsystemId = config.subsystemId;
-        fault.timestamp = QDateTime::currentDateTime();
+        fault.timestamp = Timestamp::now();
         fault.active = true;
         
         // Use reflection to add fault
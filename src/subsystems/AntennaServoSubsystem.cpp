@@ -6,7 +6,13 @@ AntennaServoSubsystem::AntennaServoSubsystem(const QString& id, const QString& n
     : RadarSubsystem(id, name, SubsystemType::AntennaServo, parent)
 {
     setDescription("Antenna positioning system with azimuth/elevation servo control");
+    registerFaultCodes({
+        FAULT_MOTOR_OVERCURRENT, FAULT_MOTOR_OVERTEMP, FAULT_POSITION_ERROR,
+        FAULT_SERVO_FAIL, FAULT_AZ_LIMIT, FAULT_EL_LIMIT,
+        FAULT_ENCODER_FAIL, FAULT_STALL
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void AntennaServoSubsystem::initializeTelemetryParameters()
@@ -117,95 +123,53 @@ bool AntennaServoSubsystem::isElLimitReached() const
     return getTelemetryValue("elLimitReached").toBool();
 }
 
-HealthState AntennaServoSubsystem::computeHealthState() const
+void AntennaServoSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    double current = getMotorCurrent();
-    double temp = getMotorTemperature();
-    double error = getPositionError();
-    
-    if (current >= CURRENT_CRITICAL || temp >= MOTOR_TEMP_CRITICAL || 
-        error >= POSITION_ERROR_CRITICAL) {
-        return HealthState::FAIL;
-    }
-    
-    if (current >= CURRENT_WARNING || temp >= MOTOR_TEMP_WARNING || 
-        error >= POSITION_ERROR_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (isAzLimitReached() || isElLimitReached()) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double AntennaServoSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    double current = getMotorCurrent();
-    if (current >= CURRENT_CRITICAL) {
-        score -= 35;
-    } else if (current >= CURRENT_WARNING) {
-        score -= 15 * (current - CURRENT_WARNING) / (CURRENT_CRITICAL - CURRENT_WARNING);
-    }
-    
-    double temp = getMotorTemperature();
-    if (temp >= MOTOR_TEMP_CRITICAL) {
-        score -= 30;
-    } else if (temp >= MOTOR_TEMP_WARNING) {
-        score -= 15 * (temp - MOTOR_TEMP_WARNING) / (MOTOR_TEMP_CRITICAL - MOTOR_TEMP_WARNING);
-    }
-    
-    double error = getPositionError();
-    if (error >= POSITION_ERROR_CRITICAL) {
-        score -= 25;
-    } else if (error >= POSITION_ERROR_WARNING) {
-        score -= 10 * (error - POSITION_ERROR_WARNING) / (POSITION_ERROR_CRITICAL - POSITION_ERROR_WARNING);
-    }
-    
-    if (isAzLimitReached() || isElLimitReached()) {
-        score -= 10;
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    // Limits are inherited from the telemetry parameters above
+    HealthRule current = HealthRule::threshold("motorCurrent", 35, 15);
+    current.faultCode = FAULT_MOTOR_OVERCURRENT;
+    current.faultDescription = "Motor overcurrent";
+    current.criticalMessage = "CRITICAL: Motor overcurrent";
+    addHealthRule(current);
+    
+    HealthRule temp = HealthRule::threshold("motorTemperature", 30, 15);
+    temp.faultCode = FAULT_MOTOR_OVERTEMP;
+    temp.faultDescription = "Motor overtemperature";
+    temp.criticalMessage = "CRITICAL: Motor overheating";
+    addHealthRule(temp);
+    
+    HealthRule error = HealthRule::threshold("positionError", 25, 10);
+    error.faultCode = FAULT_POSITION_ERROR;
+    error.faultDescription = "Position servo error";
+    error.criticalMessage = "CRITICAL: Position servo error";
+    addHealthRule(error);
+    
+    // Either travel limit degrades once, not per axis
+    HealthRule azLimit = HealthRule::boolean("azLimitReached", false, HealthRule::Warning);
+    azLimit.affectsHealth = false;
+    azLimit.warningMessage = "WARNING: Azimuth limit reached";
+    addHealthRule(azLimit);
+    
+    HealthRule elLimit = HealthRule::boolean("elLimitReached", false, HealthRule::Warning);
+    elLimit.affectsHealth = false;
+    elLimit.warningMessage = "WARNING: Elevation limit reached";
+    addHealthRule(elLimit);
+    
+    HealthRule travelLimit = HealthRule::combination("travelLimit",
+        HealthRule::Combine::Any, {"azLimitReached", "elLimitReached"});
+    travelLimit.warningPenalty = 10;
+    addHealthRule(travelLimit);
 }
 
 QString AntennaServoSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Antenna servo disabled";
     }
     
-    if (getMotorCurrent() >= CURRENT_CRITICAL) {
-        return "CRITICAL: Motor overcurrent";
-    }
-    
-    if (getMotorTemperature() >= MOTOR_TEMP_CRITICAL) {
-        return "CRITICAL: Motor overheating";
-    }
-    
-    if (getPositionError() >= POSITION_ERROR_CRITICAL) {
-        return "CRITICAL: Position servo error";
-    }
-    
-    if (isAzLimitReached()) {
-        return "WARNING: Azimuth limit reached";
-    }
-    
-    if (isElLimitReached()) {
-        return "WARNING: Elevation limit reached";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("%1 - Az: %2°, El: %3°")
@@ -214,37 +178,4 @@ QString AntennaServoSubsystem::computeStatusMessage() const
            .arg(getElevation(), 0, 'f', 1);
 }
 
-void AntennaServoSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("motorCurrent")) {
-        double current = data["motorCurrent"].toDouble();
-        if (current >= CURRENT_CRITICAL) {
-            addFault(FaultCode(FAULT_MOTOR_OVERCURRENT, "Motor overcurrent", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_MOTOR_OVERCURRENT);
-        }
-    }
-    
-    if (data.contains("motorTemperature")) {
-        double temp = data["motorTemperature"].toDouble();
-        if (temp >= MOTOR_TEMP_CRITICAL) {
-            addFault(FaultCode(FAULT_MOTOR_OVERTEMP, "Motor overtemperature", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_MOTOR_OVERTEMP);
-        }
-    }
-    
-    if (data.contains("positionError")) {
-        double error = data["positionError"].toDouble();
-        if (error >= POSITION_ERROR_CRITICAL) {
-            addFault(FaultCode(FAULT_POSITION_ERROR, "Position servo error", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_POSITION_ERROR);
-        }
-    }
-}
-
 } // namespace RadarRMP
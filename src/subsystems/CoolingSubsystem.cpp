@@ -6,7 +6,13 @@ CoolingSubsystem::CoolingSubsystem(const QString& id, const QString& name, QObje
     : RadarSubsystem(id, name, SubsystemType::Cooling, parent)
 {
     setDescription("Thermal management system with liquid cooling and HVAC");
+    registerFaultCodes({
+        FAULT_COOLANT_TEMP_HIGH, FAULT_COOLANT_FLOW_LOW, FAULT_FAN_FAIL,
+        FAULT_COMPRESSOR_FAIL, FAULT_AMBIENT_HIGH, FAULT_EFFICIENCY_LOW,
+        FAULT_COOLANT_LOW, FAULT_HEAT_EXCHANGER
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void CoolingSubsystem::initializeTelemetryParameters()
@@ -122,133 +128,47 @@ bool CoolingSubsystem::isCompressorRunning() const
     return getTelemetryValue("compressorRunning").toBool();
 }
 
-HealthState CoolingSubsystem::computeHealthState() const
+void CoolingSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    double coolantT = getCoolantTemp();
-    double flow = getCoolantFlow();
-    double ambient = getAmbientTemp();
-    double eff = getEfficiency();
-    
-    if (coolantT >= COOLANT_TEMP_CRITICAL || flow <= FLOW_CRITICAL_LOW * 0.2 ||
-        ambient >= AMBIENT_CRITICAL || eff <= EFFICIENCY_CRITICAL) {
-        return HealthState::FAIL;
-    }
-    
-    if (coolantT >= COOLANT_TEMP_WARNING || flow <= FLOW_WARNING_LOW * 0.2 ||
-        ambient >= AMBIENT_WARNING || eff <= EFFICIENCY_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double CoolingSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    double coolantT = getCoolantTemp();
-    if (coolantT >= COOLANT_TEMP_CRITICAL) {
-        score -= 35;
-    } else if (coolantT >= COOLANT_TEMP_WARNING) {
-        score -= 15 * (coolantT - COOLANT_TEMP_WARNING) / (COOLANT_TEMP_CRITICAL - COOLANT_TEMP_WARNING);
-    }
-    
-    double flowPct = getCoolantFlow() / 20.0 * 100.0;  // Relative to nominal
-    if (flowPct <= FLOW_CRITICAL_LOW) {
-        score -= 30;
-    } else if (flowPct <= FLOW_WARNING_LOW) {
-        score -= 15 * (FLOW_WARNING_LOW - flowPct) / (FLOW_WARNING_LOW - FLOW_CRITICAL_LOW);
-    }
-    
-    double ambient = getAmbientTemp();
-    if (ambient >= AMBIENT_CRITICAL) {
-        score -= 20;
-    } else if (ambient >= AMBIENT_WARNING) {
-        score -= 10 * (ambient - AMBIENT_WARNING) / (AMBIENT_CRITICAL - AMBIENT_WARNING);
-    }
-    
-    double eff = getEfficiency();
-    if (eff <= EFFICIENCY_CRITICAL) {
-        score -= 15;
-    } else if (eff <= EFFICIENCY_WARNING) {
-        score -= 8 * (EFFICIENCY_WARNING - eff) / (EFFICIENCY_WARNING - EFFICIENCY_CRITICAL);
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    // Limits are inherited from the telemetry parameters above
+    HealthRule coolantTemp = HealthRule::threshold("coolantTemp", 35, 15);
+    coolantTemp.faultCode = FAULT_COOLANT_TEMP_HIGH;
+    coolantTemp.faultDescription = "Coolant overtemperature";
+    coolantTemp.warningMessage = "WARNING: Elevated coolant temperature";
+    coolantTemp.criticalMessage = "CRITICAL: Coolant overtemperature";
+    addHealthRule(coolantTemp);
+    
+    HealthRule flow = HealthRule::threshold("coolantFlow", 30, 15);
+    flow.faultCode = FAULT_COOLANT_FLOW_LOW;
+    flow.faultDescription = "Low coolant flow";
+    flow.warningMessage = "WARNING: Reduced coolant flow";
+    flow.criticalMessage = "CRITICAL: Low coolant flow";
+    addHealthRule(flow);
+    
+    addHealthRule(HealthRule::threshold("ambientTemp", 20, 10));
+    
+    HealthRule efficiency = HealthRule::threshold("efficiency", 15, 8);
+    efficiency.faultCode = FAULT_EFFICIENCY_LOW;
+    efficiency.faultDescription = "Cooling efficiency degraded";
+    efficiency.faultSeverity = FaultSeverity::WARNING;
+    addHealthRule(efficiency);
 }
 
 QString CoolingSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Cooling System disabled";
     }
     
-    double coolantT = getCoolantTemp();
-    if (coolantT >= COOLANT_TEMP_CRITICAL) {
-        return "CRITICAL: Coolant overtemperature";
-    }
-    
-    double flowPct = getCoolantFlow() / 20.0 * 100.0;
-    if (flowPct <= FLOW_CRITICAL_LOW) {
-        return "CRITICAL: Low coolant flow";
-    }
-    
-    if (coolantT >= COOLANT_TEMP_WARNING) {
-        return "WARNING: Elevated coolant temperature";
-    }
-    
-    if (flowPct <= FLOW_WARNING_LOW) {
-        return "WARNING: Reduced coolant flow";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("%1 Mode - Coolant: %2°C, Flow: %3 L/min")
            .arg(getCoolingMode())
-           .arg(coolantT, 0, 'f', 1)
+           .arg(getCoolantTemp(), 0, 'f', 1)
            .arg(getCoolantFlow(), 0, 'f', 1);
 }
 
-void CoolingSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("coolantTemp")) {
-        double temp = data["coolantTemp"].toDouble();
-        if (temp >= COOLANT_TEMP_CRITICAL) {
-            addFault(FaultCode(FAULT_COOLANT_TEMP_HIGH, "Coolant overtemperature", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_COOLANT_TEMP_HIGH);
-        }
-    }
-    
-    if (data.contains("coolantFlow")) {
-        double flow = data["coolantFlow"].toDouble();
-        double flowPct = flow / 20.0 * 100.0;
-        if (flowPct <= FLOW_CRITICAL_LOW) {
-            addFault(FaultCode(FAULT_COOLANT_FLOW_LOW, "Low coolant flow", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_COOLANT_FLOW_LOW);
-        }
-    }
-    
-    if (data.contains("efficiency")) {
-        double eff = data["efficiency"].toDouble();
-        if (eff <= EFFICIENCY_CRITICAL) {
-            addFault(FaultCode(FAULT_EFFICIENCY_LOW, "Cooling efficiency degraded", 
-                              FaultSeverity::WARNING, getId()));
-        } else {
-            clearFault(FAULT_EFFICIENCY_LOW);
-        }
-    }
-}
-
 } // namespace RadarRMP
@@ -6,7 +6,13 @@ DataProcessorSubsystem::DataProcessorSubsystem(const QString& id, const QString&
     : RadarSubsystem(id, name, SubsystemType::DataProcessor, parent)
 {
     setDescription("Data processing and track management unit");
+    registerFaultCodes({
+        FAULT_CPU_OVERLOAD, FAULT_MEMORY_FULL, FAULT_TRACK_OVERFLOW,
+        FAULT_QUALITY_LOW, FAULT_LATENCY_HIGH, FAULT_DATA_LOSS,
+        FAULT_ALGORITHM_ERROR
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void DataProcessorSubsystem::initializeTelemetryParameters()
@@ -110,92 +116,46 @@ int DataProcessorSubsystem::getDroppedDetections() const
     return getTelemetryValue("droppedDetections").toInt();
 }
 
-HealthState DataProcessorSubsystem::computeHealthState() const
+void DataProcessorSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    double cpu = getCpuLoad();
-    double mem = getMemoryUsage();
-    double lat = getProcessingLatency();
-    double trackCapacity = (double)getActiveTracks() / getMaxTracks() * 100.0;
-    
-    if (cpu >= CPU_CRITICAL || mem >= MEMORY_CRITICAL || 
-        lat >= LATENCY_CRITICAL || trackCapacity >= TRACK_CAPACITY_CRITICAL) {
-        return HealthState::FAIL;
-    }
-    
-    if (cpu >= CPU_WARNING || mem >= MEMORY_WARNING || 
-        lat >= LATENCY_WARNING || trackCapacity >= TRACK_CAPACITY_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double DataProcessorSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    double cpu = getCpuLoad();
-    if (cpu >= CPU_CRITICAL) {
-        score -= 25;
-    } else if (cpu >= CPU_WARNING) {
-        score -= 12 * (cpu - CPU_WARNING) / (CPU_CRITICAL - CPU_WARNING);
-    }
-    
-    double mem = getMemoryUsage();
-    if (mem >= MEMORY_CRITICAL) {
-        score -= 25;
-    } else if (mem >= MEMORY_WARNING) {
-        score -= 12 * (mem - MEMORY_WARNING) / (MEMORY_CRITICAL - MEMORY_WARNING);
-    }
-    
-    double lat = getProcessingLatency();
-    if (lat >= LATENCY_CRITICAL) {
-        score -= 25;
-    } else if (lat >= LATENCY_WARNING) {
-        score -= 12 * (lat - LATENCY_WARNING) / (LATENCY_CRITICAL - LATENCY_WARNING);
-    }
-    
-    double trackCapacity = (double)getActiveTracks() / getMaxTracks() * 100.0;
-    if (trackCapacity >= TRACK_CAPACITY_CRITICAL) {
-        score -= 20;
-    } else if (trackCapacity >= TRACK_CAPACITY_WARNING) {
-        score -= 10 * (trackCapacity - TRACK_CAPACITY_WARNING) / (TRACK_CAPACITY_CRITICAL - TRACK_CAPACITY_WARNING);
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    // Limits are inherited from the telemetry parameters above
+    HealthRule cpu = HealthRule::threshold("cpuLoad", 25, 12);
+    cpu.faultCode = FAULT_CPU_OVERLOAD;
+    cpu.faultDescription = "CPU overload";
+    cpu.criticalMessage = "CRITICAL: CPU overload";
+    addHealthRule(cpu);
+    
+    HealthRule memory = HealthRule::threshold("memoryUsage", 25, 12);
+    memory.faultCode = FAULT_MEMORY_FULL;
+    memory.faultDescription = "Memory exhausted";
+    memory.criticalMessage = "CRITICAL: Memory exhausted";
+    addHealthRule(memory);
+    
+    addHealthRule(HealthRule::threshold("processingLatency", 25, 12));
+    
+    // Track load as a percentage of capacity
+    HealthRule tracks = HealthRule::threshold("activeTracks", 20, 10);
+    tracks.id = "trackCapacity";
+    tracks.ratioOf = "maxTracks";
+    tracks.bound = HealthRule::Bound::High;
+    tracks.warningHigh = 80.0;
+    tracks.criticalHigh = 95.0;
+    tracks.faultCode = FAULT_TRACK_OVERFLOW;
+    tracks.faultDescription = "Track capacity exceeded";
+    tracks.warningMessage = "WARNING: High track load";
+    tracks.criticalMessage = "CRITICAL: Track capacity exceeded";
+    addHealthRule(tracks);
 }
 
 QString DataProcessorSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Data Processor disabled";
     }
     
-    if (getCpuLoad() >= CPU_CRITICAL) {
-        return "CRITICAL: CPU overload";
-    }
-    
-    if (getMemoryUsage() >= MEMORY_CRITICAL) {
-        return "CRITICAL: Memory exhausted";
-    }
-    
-    double trackCapacity = (double)getActiveTracks() / getMaxTracks() * 100.0;
-    if (trackCapacity >= TRACK_CAPACITY_CRITICAL) {
-        return "CRITICAL: Track capacity exceeded";
-    }
-    
-    if (trackCapacity >= TRACK_CAPACITY_WARNING) {
-        return "WARNING: High track load";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("Tracking %1/%2 targets, Quality: %3%")
@@ -204,38 +164,4 @@ QString DataProcessorSubsystem::computeStatusMessage() const
            .arg(getTrackQuality(), 0, 'f', 0);
 }
 
-void DataProcessorSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("cpuLoad")) {
-        double cpu = data["cpuLoad"].toDouble();
-        if (cpu >= CPU_CRITICAL) {
-            addFault(FaultCode(FAULT_CPU_OVERLOAD, "CPU overload", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_CPU_OVERLOAD);
-        }
-    }
-    
-    if (data.contains("memoryUsage")) {
-        double mem = data["memoryUsage"].toDouble();
-        if (mem >= MEMORY_CRITICAL) {
-            addFault(FaultCode(FAULT_MEMORY_FULL, "Memory exhausted", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_MEMORY_FULL);
-        }
-    }
-    
-    if (data.contains("activeTracks") && data.contains("maxTracks")) {
-        int active = data["activeTracks"].toInt();
-        int max = data["maxTracks"].toInt();
-        if (max > 0 && (double)active / max * 100.0 >= TRACK_CAPACITY_CRITICAL) {
-            addFault(FaultCode(FAULT_TRACK_OVERFLOW, "Track capacity exceeded", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_TRACK_OVERFLOW);
-        }
-    }
-}
-
 } // namespace RadarRMP
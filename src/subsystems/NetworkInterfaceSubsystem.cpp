@@ -6,7 +6,13 @@ NetworkInterfaceSubsystem::NetworkInterfaceSubsystem(const QString& id, const QS
     : RadarSubsystem(id, name, SubsystemType::NetworkInterface, parent)
 {
     setDescription("Network communication interface for C2 connectivity");
+    registerFaultCodes({
+        FAULT_LINK_DOWN, FAULT_HIGH_PACKET_LOSS, FAULT_HIGH_LATENCY,
+        FAULT_BANDWIDTH_EXCEEDED, FAULT_C2_DISCONNECT, FAULT_BUFFER_OVERFLOW,
+        FAULT_CRC_ERRORS, FAULT_INTERFACE_ERROR
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void NetworkInterfaceSubsystem::initializeTelemetryParameters()
@@ -132,140 +138,65 @@ int NetworkInterfaceSubsystem::getActiveConnections() const
     return getTelemetryValue("activeConnections").toInt();
 }
 
-HealthState NetworkInterfaceSubsystem::computeHealthState() const
+void NetworkInterfaceSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    if (!isLinkUp()) {
-        return HealthState::FAIL;
-    }
-    
-    double loss = getPacketLoss();
-    double lat = getLatency();
-    double util = getUtilization();
-    
-    if (loss >= PACKET_LOSS_CRITICAL || lat >= LATENCY_CRITICAL ||
-        util >= UTILIZATION_CRITICAL) {
-        return HealthState::FAIL;
-    }
-    
-    if (loss >= PACKET_LOSS_WARNING || lat >= LATENCY_WARNING ||
-        util >= UTILIZATION_WARNING) {
-        return HealthState::DEGRADED;
-    }
+    // A down link zeroes the score on its own
+    HealthRule link = HealthRule::boolean("linkUp", true);
+    link.criticalPenalty = 100;
+    link.faultCode = FAULT_LINK_DOWN;
+    link.faultDescription = "Network link down";
+    link.criticalMessage = "CRITICAL: Link down";
+    addHealthRule(link);
     
-    if (getConnectionStatus() == "DEGRADED") {
-        return HealthState::DEGRADED;
-    }
+    // Limits are inherited from the telemetry parameters above
+    HealthRule loss = HealthRule::threshold("packetLoss", 35, 15);
+    loss.faultCode = FAULT_HIGH_PACKET_LOSS;
+    loss.faultDescription = "High packet loss";
+    loss.warningMessage = "WARNING: Packet loss (%1%)";
+    loss.criticalMessage = "CRITICAL: High packet loss (%1%)";
+    loss.precision = 2;
+    addHealthRule(loss);
     
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
+    HealthRule latency = HealthRule::threshold("latency", 30, 15);
+    latency.faultCode = FAULT_HIGH_LATENCY;
+    latency.faultDescription = "High network latency";
+    latency.faultSeverity = FaultSeverity::WARNING;
+    latency.warningMessage = "WARNING: Elevated latency (%1 ms)";
+    latency.criticalMessage = "CRITICAL: High latency (%1 ms)";
+    latency.precision = 0;
+    addHealthRule(latency);
     
-    return HealthState::OK;
+    addHealthRule(HealthRule::threshold("utilization", 25, 12));
 }
 
-double NetworkInterfaceSubsystem::computeHealthScore() const
+HealthState NetworkInterfaceSubsystem::computeHealthState() const
 {
-    double score = 100.0;
-    
-    if (!isLinkUp()) {
-        return 0.0;
-    }
-    
-    double loss = getPacketLoss();
-    if (loss >= PACKET_LOSS_CRITICAL) {
-        score -= 35;
-    } else if (loss >= PACKET_LOSS_WARNING) {
-        score -= 15 * (loss - PACKET_LOSS_WARNING) / (PACKET_LOSS_CRITICAL - PACKET_LOSS_WARNING);
-    }
-    
-    double lat = getLatency();
-    if (lat >= LATENCY_CRITICAL) {
-        score -= 30;
-    } else if (lat >= LATENCY_WARNING) {
-        score -= 15 * (lat - LATENCY_WARNING) / (LATENCY_CRITICAL - LATENCY_WARNING);
-    }
-    
-    double util = getUtilization();
-    if (util >= UTILIZATION_CRITICAL) {
-        score -= 25;
-    } else if (util >= UTILIZATION_WARNING) {
-        score -= 12 * (util - UTILIZATION_WARNING) / (UTILIZATION_CRITICAL - UTILIZATION_WARNING);
+    // Connection status is a string, which the numeric rule inputs don't carry
+    HealthState state = RadarSubsystem::computeHealthState();
+    if (state == HealthState::OK && getConnectionStatus() == "DEGRADED") {
+        return HealthState::DEGRADED;
     }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    return state;
 }
 
 QString NetworkInterfaceSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Network Interface disabled";
     }
     
-    if (!isLinkUp()) {
-        return "CRITICAL: Link down";
-    }
-    
-    double loss = getPacketLoss();
-    if (loss >= PACKET_LOSS_CRITICAL) {
-        return QString("CRITICAL: High packet loss (%1%)").arg(loss, 0, 'f', 2);
-    }
-    
-    double lat = getLatency();
-    if (lat >= LATENCY_CRITICAL) {
-        return QString("CRITICAL: High latency (%1 ms)").arg(lat, 0, 'f', 0);
-    }
-    
-    if (loss >= PACKET_LOSS_WARNING) {
-        return QString("WARNING: Packet loss (%1%)").arg(loss, 0, 'f', 2);
-    }
-    
-    if (lat >= LATENCY_WARNING) {
-        return QString("WARNING: Elevated latency (%1 ms)").arg(lat, 0, 'f', 0);
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("Connected - %1 Mbps, Latency: %2 ms")
            .arg(getBandwidth(), 0, 'f', 0)
-           .arg(lat, 0, 'f', 1);
+           .arg(getLatency(), 0, 'f', 1);
 }
 
 void NetworkInterfaceSubsystem::onDataUpdate(const QVariantMap& data)
 {
-    if (data.contains("linkUp")) {
-        bool up = data["linkUp"].toBool();
-        if (!up) {
-            addFault(FaultCode(FAULT_LINK_DOWN, "Network link down", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_LINK_DOWN);
-        }
-    }
-    
-    if (data.contains("packetLoss")) {
-        double loss = data["packetLoss"].toDouble();
-        if (loss >= PACKET_LOSS_CRITICAL) {
-            addFault(FaultCode(FAULT_HIGH_PACKET_LOSS, "High packet loss", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_HIGH_PACKET_LOSS);
-        }
-    }
-    
-    if (data.contains("latency")) {
-        double lat = data["latency"].toDouble();
-        if (lat >= LATENCY_CRITICAL) {
-            addFault(FaultCode(FAULT_HIGH_LATENCY, "High network latency", 
-                              FaultSeverity::WARNING, getId()));
-        } else {
-            clearFault(FAULT_HIGH_LATENCY);
-        }
-    }
-    
     if (data.contains("connectionStatus")) {
         QString status = data["connectionStatus"].toString();
         if (status == "DISCONNECTED") {
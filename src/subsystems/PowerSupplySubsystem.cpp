@@ -6,7 +6,13 @@ PowerSupplySubsystem::PowerSupplySubsystem(const QString& id, const QString& nam
     : RadarSubsystem(id, name, SubsystemType::PowerSupply, parent)
 {
     setDescription("Power distribution unit with UPS and battery backup");
+    registerFaultCodes({
+        FAULT_INPUT_LOW, FAULT_INPUT_HIGH, FAULT_OUTPUT_LOW,
+        FAULT_OUTPUT_HIGH, FAULT_OVERCURRENT, FAULT_OVERTEMP,
+        FAULT_BATTERY_LOW, FAULT_BATTERY_FAIL, FAULT_UPS_FAIL
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void PowerSupplySubsystem::initializeTelemetryParameters()
@@ -142,99 +148,70 @@ QString PowerSupplySubsystem::getPsuMode() const
     return getTelemetryValue("psuMode").toString();
 }
 
-HealthState PowerSupplySubsystem::computeHealthState() const
-{
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    double inputV = getInputVoltage();
-    double battery = getBatteryLevel();
-    double temp = getTemperature();
-    
-    if (inputV <= INPUT_VOLTAGE_LOW_CRITICAL || inputV >= INPUT_VOLTAGE_HIGH_CRITICAL ||
-        temp >= TEMP_CRITICAL || (isOnBattery() && battery <= BATTERY_CRITICAL)) {
-        return HealthState::FAIL;
-    }
-    
-    if (inputV <= INPUT_VOLTAGE_LOW_WARNING || inputV >= INPUT_VOLTAGE_HIGH_WARNING ||
-        temp >= TEMP_WARNING || (isOnBattery() && battery <= BATTERY_WARNING)) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (isOnBattery()) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double PowerSupplySubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    double inputV = getInputVoltage();
-    if (inputV <= INPUT_VOLTAGE_LOW_CRITICAL || inputV >= INPUT_VOLTAGE_HIGH_CRITICAL) {
-        score -= 35;
-    } else if (inputV <= INPUT_VOLTAGE_LOW_WARNING) {
-        score -= 15 * (INPUT_VOLTAGE_LOW_WARNING - inputV) / (INPUT_VOLTAGE_LOW_WARNING - INPUT_VOLTAGE_LOW_CRITICAL);
-    } else if (inputV >= INPUT_VOLTAGE_HIGH_WARNING) {
-        score -= 15 * (inputV - INPUT_VOLTAGE_HIGH_WARNING) / (INPUT_VOLTAGE_HIGH_CRITICAL - INPUT_VOLTAGE_HIGH_WARNING);
-    }
-    
-    double temp = getTemperature();
-    if (temp >= TEMP_CRITICAL) {
-        score -= 30;
-    } else if (temp >= TEMP_WARNING) {
-        score -= 15 * (temp - TEMP_WARNING) / (TEMP_CRITICAL - TEMP_WARNING);
-    }
-    
-    if (isOnBattery()) {
-        double battery = getBatteryLevel();
-        score -= 10;  // Penalty for running on battery
-        if (battery <= BATTERY_CRITICAL) {
-            score -= 25;
-        } else if (battery <= BATTERY_WARNING) {
-            score -= 15 * (BATTERY_WARNING - battery) / (BATTERY_WARNING - BATTERY_CRITICAL);
-        }
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+void PowerSupplySubsystem::initializeHealthRules()
+{
+    // Running on battery degrades regardless of charge
+    HealthRule onBattery = HealthRule::boolean("onBattery", false, HealthRule::Warning);
+    onBattery.warningPenalty = 10;
+    onBattery.warningMessage = "WARNING: Running on battery";
+    addHealthRule(onBattery);
+    
+    // Battery charge only matters while discharging
+    HealthRule batteryInUse = HealthRule::boolean("onBattery", false);
+    batteryInUse.id = "batteryInUse";
+    batteryInUse.affectsHealth = false;
+    addHealthRule(batteryInUse);
+    
+    HealthRule batteryLevel = HealthRule::threshold("batteryLevel");
+    batteryLevel.affectsHealth = false;
+    addHealthRule(batteryLevel);
+    
+    HealthRule battery = HealthRule::combination("batteryDepleted",
+        HealthRule::Combine::All, {"batteryInUse", "batteryLevel"});
+    battery.parameter = "batteryLevel";
+    battery.criticalPenalty = 25;
+    battery.warningPenalty = 15;
+    battery.faultCode = FAULT_BATTERY_LOW;
+    battery.faultDescription = "Battery critically low";
+    battery.criticalMessage = "CRITICAL: Battery low (%1%)";
+    battery.precision = 0;
+    addHealthRule(battery);
+    
+    // Limits are inherited from the telemetry parameters above; each side
+    // of the input window has its own fault code
+    HealthRule inputLow = HealthRule::threshold("inputVoltage", 35, 15);
+    inputLow.id = "inputVoltageLow";
+    inputLow.bound = HealthRule::Bound::Low;
+    inputLow.faultCode = FAULT_INPUT_LOW;
+    inputLow.faultDescription = "Input voltage low";
+    inputLow.warningMessage = "WARNING: Input voltage low";
+    inputLow.criticalMessage = "CRITICAL: Input voltage low";
+    addHealthRule(inputLow);
+    
+    HealthRule inputHigh = HealthRule::threshold("inputVoltage", 35, 15);
+    inputHigh.id = "inputVoltageHigh";
+    inputHigh.bound = HealthRule::Bound::High;
+    inputHigh.faultCode = FAULT_INPUT_HIGH;
+    inputHigh.faultDescription = "Input voltage high";
+    inputHigh.warningMessage = "WARNING: Input voltage high";
+    inputHigh.criticalMessage = "CRITICAL: Input voltage high";
+    addHealthRule(inputHigh);
+    
+    HealthRule temp = HealthRule::threshold("temperature", 30, 15);
+    temp.faultCode = FAULT_OVERTEMP;
+    temp.faultDescription = "PSU overtemperature";
+    addHealthRule(temp);
 }
 
 QString PowerSupplySubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Power Supply disabled";
     }
     
-    double inputV = getInputVoltage();
-    if (inputV <= INPUT_VOLTAGE_LOW_CRITICAL) {
-        return "CRITICAL: Input voltage low";
-    }
-    if (inputV >= INPUT_VOLTAGE_HIGH_CRITICAL) {
-        return "CRITICAL: Input voltage high";
-    }
-    
-    if (isOnBattery()) {
-        double battery = getBatteryLevel();
-        if (battery <= BATTERY_CRITICAL) {
-            return QString("CRITICAL: Battery low (%1%)").arg(battery, 0, 'f', 0);
-        }
-        return QString("Running on battery - %1% remaining").arg(battery, 0, 'f', 0);
-    }
-    
-    if (inputV <= INPUT_VOLTAGE_LOW_WARNING) {
-        return "WARNING: Input voltage low";
-    }
-    if (inputV >= INPUT_VOLTAGE_HIGH_WARNING) {
-        return "WARNING: Input voltage high";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("Normal - %1 kW @ %2% efficiency")
@@ -242,44 +219,4 @@ QString PowerSupplySubsystem::computeStatusMessage() const
            .arg(getEfficiency(), 0, 'f', 0);
 }
 
-void PowerSupplySubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("inputVoltage")) {
-        double v = data["inputVoltage"].toDouble();
-        if (v <= INPUT_VOLTAGE_LOW_CRITICAL) {
-            addFault(FaultCode(FAULT_INPUT_LOW, "Input voltage low", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_INPUT_LOW);
-        }
-        if (v >= INPUT_VOLTAGE_HIGH_CRITICAL) {
-            addFault(FaultCode(FAULT_INPUT_HIGH, "Input voltage high", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_INPUT_HIGH);
-        }
-    }
-    
-    if (data.contains("batteryLevel") && data.contains("onBattery")) {
-        double battery = data["batteryLevel"].toDouble();
-        bool onBattery = data["onBattery"].toBool();
-        if (onBattery && battery <= BATTERY_CRITICAL) {
-            addFault(FaultCode(FAULT_BATTERY_LOW, "Battery critically low", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_BATTERY_LOW);
-        }
-    }
-    
-    if (data.contains("temperature")) {
-        double temp = data["temperature"].toDouble();
-        if (temp >= TEMP_CRITICAL) {
-            addFault(FaultCode(FAULT_OVERTEMP, "PSU overtemperature", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_OVERTEMP);
-        }
-    }
-}
-
 } // namespace RadarRMP
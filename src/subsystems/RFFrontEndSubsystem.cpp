@@ -6,7 +6,13 @@ RFFrontEndSubsystem::RFFrontEndSubsystem(const QString& id, const QString& name,
     : RadarSubsystem(id, name, SubsystemType::RFFrontEnd, parent)
 {
     setDescription("RF front-end with frequency synthesizer, mixers, and T/R switching");
+    registerFaultCodes({
+        FAULT_PLL_UNLOCK, FAULT_IF_LEVEL, FAULT_LO_LEVEL,
+        FAULT_TR_SWITCH, FAULT_PHASE_CAL, FAULT_AMP_CAL,
+        FAULT_OVERTEMP
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void RFFrontEndSubsystem::initializeTelemetryParameters()
@@ -115,77 +121,39 @@ double RFFrontEndSubsystem::getAmplitudeError() const
     return getTelemetryValue("amplitudeError").toDouble();
 }
 
-HealthState RFFrontEndSubsystem::computeHealthState() const
+void RFFrontEndSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    double pll = getPhaseLock();
-    double temp = getTemperature();
-    
-    if (pll <= PHASE_LOCK_CRITICAL || temp >= TEMP_CRITICAL || !isTrSwitchOk()) {
-        return HealthState::FAIL;
-    }
-    
-    if (pll <= PHASE_LOCK_WARNING || temp >= TEMP_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double RFFrontEndSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    double pll = getPhaseLock();
-    if (pll <= PHASE_LOCK_CRITICAL) {
-        score -= 40;
-    } else if (pll <= PHASE_LOCK_WARNING) {
-        score -= 20 * (PHASE_LOCK_WARNING - pll) / (PHASE_LOCK_WARNING - PHASE_LOCK_CRITICAL);
-    }
-    
-    double temp = getTemperature();
-    if (temp >= TEMP_CRITICAL) {
-        score -= 30;
-    } else if (temp >= TEMP_WARNING) {
-        score -= 15 * (temp - TEMP_WARNING) / (TEMP_CRITICAL - TEMP_WARNING);
-    }
-    
-    if (!isTrSwitchOk()) {
-        score -= 30;
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    // Limits are inherited from the telemetry parameters above
+    HealthRule pll = HealthRule::threshold("phaseLock", 40, 20);
+    pll.faultCode = FAULT_PLL_UNLOCK;
+    pll.faultDescription = "PLL unlocked";
+    pll.warningMessage = "WARNING: PLL marginal";
+    pll.criticalMessage = "CRITICAL: PLL unlocked";
+    addHealthRule(pll);
+    
+    HealthRule trSwitch = HealthRule::boolean("trSwitchOk", true);
+    trSwitch.criticalPenalty = 30;
+    trSwitch.faultCode = FAULT_TR_SWITCH;
+    trSwitch.faultDescription = "T/R switch failure";
+    trSwitch.criticalMessage = "CRITICAL: T/R switch failure";
+    addHealthRule(trSwitch);
+    
+    HealthRule temp = HealthRule::threshold("temperature", 30, 15);
+    temp.faultCode = FAULT_OVERTEMP;
+    temp.faultDescription = "RF overtemperature";
+    temp.criticalMessage = "CRITICAL: Overtemperature";
+    addHealthRule(temp);
 }
 
 QString RFFrontEndSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "RF Front-End disabled";
     }
     
-    if (getPhaseLock() <= PHASE_LOCK_CRITICAL) {
-        return "CRITICAL: PLL unlocked";
-    }
-    
-    if (!isTrSwitchOk()) {
-        return "CRITICAL: T/R switch failure";
-    }
-    
-    if (getTemperature() >= TEMP_CRITICAL) {
-        return "CRITICAL: Overtemperature";
-    }
-    
-    if (getPhaseLock() <= PHASE_LOCK_WARNING) {
-        return "WARNING: PLL marginal";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("Locked - %1 GHz, Phase error: %2°")
@@ -193,37 +161,4 @@ QString RFFrontEndSubsystem::computeStatusMessage() const
            .arg(getPhaseError(), 0, 'f', 1);
 }
 
-void RFFrontEndSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("phaseLock")) {
-        double pll = data["phaseLock"].toDouble();
-        if (pll <= PHASE_LOCK_CRITICAL) {
-            addFault(FaultCode(FAULT_PLL_UNLOCK, "PLL unlocked", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_PLL_UNLOCK);
-        }
-    }
-    
-    if (data.contains("trSwitchOk")) {
-        bool ok = data["trSwitchOk"].toBool();
-        if (!ok) {
-            addFault(FaultCode(FAULT_TR_SWITCH, "T/R switch failure", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_TR_SWITCH);
-        }
-    }
-    
-    if (data.contains("temperature")) {
-        double temp = data["temperature"].toDouble();
-        if (temp >= TEMP_CRITICAL) {
-            addFault(FaultCode(FAULT_OVERTEMP, "RF overtemperature", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_OVERTEMP);
-        }
-    }
-}
-
 } // namespace RadarRMP
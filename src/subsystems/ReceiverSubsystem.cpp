@@ -6,7 +6,13 @@ ReceiverSubsystem::ReceiverSubsystem(const QString& id, const QString& name, QOb
     : RadarSubsystem(id, name, SubsystemType::Receiver, parent)
 {
     setDescription("Low-noise RF receiver with LNA, AGC, and digital conversion");
+    registerFaultCodes({
+        FAULT_NOISE_FIGURE_HIGH, FAULT_GAIN_LOW, FAULT_LNA_FAIL,
+        FAULT_AGC_FAIL, FAULT_ADC_ERROR, FAULT_OVERTEMP,
+        FAULT_SATURATION
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void ReceiverSubsystem::initializeTelemetryParameters()
@@ -111,121 +117,43 @@ double ReceiverSubsystem::getSensitivity() const
     return getTelemetryValue("sensitivity").toDouble();
 }
 
-HealthState ReceiverSubsystem::computeHealthState() const
+void ReceiverSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    double nf = getNoiseFigure();
-    double gain = getGain();
-    double temp = getTemperature();
-    
-    if (nf >= NOISE_FIGURE_CRITICAL || gain <= GAIN_CRITICAL_LOW || temp >= TEMP_CRITICAL) {
-        return HealthState::FAIL;
-    }
-    
-    if (nf >= NOISE_FIGURE_WARNING || gain <= GAIN_WARNING_LOW || temp >= TEMP_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double ReceiverSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    double nf = getNoiseFigure();
-    if (nf >= NOISE_FIGURE_CRITICAL) {
-        score -= 35;
-    } else if (nf >= NOISE_FIGURE_WARNING) {
-        score -= 15 * (nf - NOISE_FIGURE_WARNING) / (NOISE_FIGURE_CRITICAL - NOISE_FIGURE_WARNING);
-    }
-    
-    double gain = getGain();
-    if (gain <= GAIN_CRITICAL_LOW) {
-        score -= 35;
-    } else if (gain <= GAIN_WARNING_LOW) {
-        score -= 15 * (GAIN_WARNING_LOW - gain) / (GAIN_WARNING_LOW - GAIN_CRITICAL_LOW);
-    }
-    
-    double temp = getTemperature();
-    if (temp >= TEMP_CRITICAL) {
-        score -= 30;
-    } else if (temp >= TEMP_WARNING) {
-        score -= 15 * (temp - TEMP_WARNING) / (TEMP_CRITICAL - TEMP_WARNING);
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    // Limits are inherited from the telemetry parameters above
+    HealthRule nf = HealthRule::threshold("noiseFigure", 35, 15);
+    nf.faultCode = FAULT_NOISE_FIGURE_HIGH;
+    nf.faultDescription = "High noise figure";
+    nf.warningMessage = "WARNING: Elevated noise figure";
+    nf.criticalMessage = "CRITICAL: High noise figure";
+    addHealthRule(nf);
+    
+    HealthRule gain = HealthRule::threshold("gain", 35, 15);
+    gain.faultCode = FAULT_GAIN_LOW;
+    gain.faultDescription = "Low receiver gain";
+    gain.warningMessage = "WARNING: Reduced gain";
+    gain.criticalMessage = "CRITICAL: Low gain - LNA failure";
+    addHealthRule(gain);
+    
+    HealthRule temp = HealthRule::threshold("temperature", 30, 15);
+    temp.faultCode = FAULT_OVERTEMP;
+    temp.faultDescription = "Receiver overtemperature";
+    addHealthRule(temp);
 }
 
 QString ReceiverSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Receiver disabled";
     }
     
-    double nf = getNoiseFigure();
-    if (nf >= NOISE_FIGURE_CRITICAL) {
-        return "CRITICAL: High noise figure";
-    }
-    
-    double gain = getGain();
-    if (gain <= GAIN_CRITICAL_LOW) {
-        return "CRITICAL: Low gain - LNA failure";
-    }
-    
-    if (nf >= NOISE_FIGURE_WARNING) {
-        return "WARNING: Elevated noise figure";
-    }
-    
-    if (gain <= GAIN_WARNING_LOW) {
-        return "WARNING: Reduced gain";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("Receiving - NF: %1 dB, Gain: %2 dB")
-           .arg(nf, 0, 'f', 1)
-           .arg(gain, 0, 'f', 1);
-}
-
-void ReceiverSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("noiseFigure")) {
-        double nf = data["noiseFigure"].toDouble();
-        if (nf >= NOISE_FIGURE_CRITICAL) {
-            addFault(FaultCode(FAULT_NOISE_FIGURE_HIGH, "High noise figure", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_NOISE_FIGURE_HIGH);
-        }
-    }
-    
-    if (data.contains("gain")) {
-        double gain = data["gain"].toDouble();
-        if (gain <= GAIN_CRITICAL_LOW) {
-            addFault(FaultCode(FAULT_GAIN_LOW, "Low receiver gain", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_GAIN_LOW);
-        }
-    }
-    
-    if (data.contains("temperature")) {
-        double temp = data["temperature"].toDouble();
-        if (temp >= TEMP_CRITICAL) {
-            addFault(FaultCode(FAULT_OVERTEMP, "Receiver overtemperature", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_OVERTEMP);
-        }
-    }
+           .arg(getNoiseFigure(), 0, 'f', 1)
+           .arg(getGain(), 0, 'f', 1);
 }
 
 } // namespace RadarRMP
@@ -6,7 +6,13 @@ SignalProcessorSubsystem::SignalProcessorSubsystem(const QString& id, const QStr
     : RadarSubsystem(id, name, SubsystemType::SignalProcessor, parent)
 {
     setDescription("Digital signal processing unit with FPGA-based pulse compression and Doppler processing");
+    registerFaultCodes({
+        FAULT_CPU_OVERLOAD, FAULT_MEMORY_FULL, FAULT_FPGA_ERROR,
+        FAULT_DSP_ERROR, FAULT_THROUGHPUT_LOW, FAULT_LATENCY_HIGH,
+        FAULT_OVERTEMP, FAULT_DATA_LOSS
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void SignalProcessorSubsystem::initializeTelemetryParameters()
@@ -117,99 +123,44 @@ double SignalProcessorSubsystem::getDspUtilization() const
     return getTelemetryValue("dspUtilization").toDouble();
 }
 
-HealthState SignalProcessorSubsystem::computeHealthState() const
+void SignalProcessorSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    double cpu = getCpuLoad();
-    double mem = getMemoryUsage();
-    double temp = getTemperature();
-    double lat = getLatency();
-    
-    if (cpu >= CPU_CRITICAL || mem >= MEMORY_CRITICAL || 
-        temp >= TEMP_CRITICAL || lat >= LATENCY_CRITICAL || !isFpgaHealthy()) {
-        return HealthState::FAIL;
-    }
-    
-    if (cpu >= CPU_WARNING || mem >= MEMORY_WARNING || 
-        temp >= TEMP_WARNING || lat >= LATENCY_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double SignalProcessorSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    double cpu = getCpuLoad();
-    if (cpu >= CPU_CRITICAL) {
-        score -= 25;
-    } else if (cpu >= CPU_WARNING) {
-        score -= 12 * (cpu - CPU_WARNING) / (CPU_CRITICAL - CPU_WARNING);
-    }
-    
-    double mem = getMemoryUsage();
-    if (mem >= MEMORY_CRITICAL) {
-        score -= 25;
-    } else if (mem >= MEMORY_WARNING) {
-        score -= 12 * (mem - MEMORY_WARNING) / (MEMORY_CRITICAL - MEMORY_WARNING);
-    }
-    
-    double temp = getTemperature();
-    if (temp >= TEMP_CRITICAL) {
-        score -= 25;
-    } else if (temp >= TEMP_WARNING) {
-        score -= 12 * (temp - TEMP_WARNING) / (TEMP_CRITICAL - TEMP_WARNING);
-    }
-    
-    double lat = getLatency();
-    if (lat >= LATENCY_CRITICAL) {
-        score -= 20;
-    } else if (lat >= LATENCY_WARNING) {
-        score -= 10 * (lat - LATENCY_WARNING) / (LATENCY_CRITICAL - LATENCY_WARNING);
-    }
-    
-    if (!isFpgaHealthy()) {
-        score -= 30;
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    HealthRule fpga = HealthRule::boolean("fpgaHealthy", true);
+    fpga.criticalPenalty = 30;
+    fpga.faultCode = FAULT_FPGA_ERROR;
+    fpga.faultDescription = "FPGA error";
+    fpga.faultSeverity = FaultSeverity::FATAL;
+    fpga.criticalMessage = "CRITICAL: FPGA error";
+    addHealthRule(fpga);
+    
+    // Limits are inherited from the telemetry parameters above
+    HealthRule cpu = HealthRule::threshold("cpuLoad", 25, 12);
+    cpu.faultCode = FAULT_CPU_OVERLOAD;
+    cpu.faultDescription = "CPU overload";
+    cpu.warningMessage = "WARNING: High CPU load";
+    cpu.criticalMessage = "CRITICAL: CPU overload";
+    addHealthRule(cpu);
+    
+    HealthRule memory = HealthRule::threshold("memoryUsage", 25, 12);
+    memory.faultCode = FAULT_MEMORY_FULL;
+    memory.faultDescription = "Memory exhausted";
+    memory.warningMessage = "WARNING: High memory usage";
+    memory.criticalMessage = "CRITICAL: Memory exhausted";
+    addHealthRule(memory);
+    
+    addHealthRule(HealthRule::threshold("temperature", 25, 12));
+    addHealthRule(HealthRule::threshold("latency", 20, 10));
 }
 
 QString SignalProcessorSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Signal Processor disabled";
     }
     
-    if (!isFpgaHealthy()) {
-        return "CRITICAL: FPGA error";
-    }
-    
-    if (getCpuLoad() >= CPU_CRITICAL) {
-        return "CRITICAL: CPU overload";
-    }
-    
-    if (getMemoryUsage() >= MEMORY_CRITICAL) {
-        return "CRITICAL: Memory exhausted";
-    }
-    
-    if (getCpuLoad() >= CPU_WARNING) {
-        return "WARNING: High CPU load";
-    }
-    
-    if (getMemoryUsage() >= MEMORY_WARNING) {
-        return "WARNING: High memory usage";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("Processing - %1 MSPS, Lat: %2ms")
@@ -217,37 +168,4 @@ QString SignalProcessorSubsystem::computeStatusMessage() const
            .arg(getLatency(), 0, 'f', 1);
 }
 
-void SignalProcessorSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("cpuLoad")) {
-        double cpu = data["cpuLoad"].toDouble();
-        if (cpu >= CPU_CRITICAL) {
-            addFault(FaultCode(FAULT_CPU_OVERLOAD, "CPU overload", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_CPU_OVERLOAD);
-        }
-    }
-    
-    if (data.contains("memoryUsage")) {
-        double mem = data["memoryUsage"].toDouble();
-        if (mem >= MEMORY_CRITICAL) {
-            addFault(FaultCode(FAULT_MEMORY_FULL, "Memory exhausted", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_MEMORY_FULL);
-        }
-    }
-    
-    if (data.contains("fpgaHealthy")) {
-        bool healthy = data["fpgaHealthy"].toBool();
-        if (!healthy) {
-            addFault(FaultCode(FAULT_FPGA_ERROR, "FPGA error", 
-                              FaultSeverity::FATAL, getId()));
-        } else {
-            clearFault(FAULT_FPGA_ERROR);
-        }
-    }
-}
-
 } // namespace RadarRMP
@@ -6,7 +6,13 @@ TimingSyncSubsystem::TimingSyncSubsystem(const QString& id, const QString& name,
     : RadarSubsystem(id, name, SubsystemType::TimingSync, parent)
 {
     setDescription("Timing and synchronization unit with GPS and OCXO");
+    registerFaultCodes({
+        FAULT_GPS_UNLOCK, FAULT_LOW_SATELLITES, FAULT_OCXO_DRIFT,
+        FAULT_PPS_INVALID, FAULT_TIME_ACCURACY, FAULT_ANTENNA_FAIL,
+        FAULT_OVERTEMP, FAULT_HOLDOVER
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void TimingSyncSubsystem::initializeTelemetryParameters()
@@ -133,148 +139,63 @@ double TimingSyncSubsystem::getDop() const
     return getTelemetryValue("dop").toDouble();
 }
 
-HealthState TimingSyncSubsystem::computeHealthState() const
-{
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    int sats = getSatelliteCount();
-    double accuracy = getTimeAccuracy();
-    double stability = getOcxoStability();
-    double temp = getTemperature();
-    
-    if (!isGpsLocked() || sats < SATELLITE_CRITICAL || 
-        accuracy >= ACCURACY_CRITICAL || stability >= STABILITY_CRITICAL ||
-        temp >= TEMP_CRITICAL || !isPpsValid()) {
-        return HealthState::FAIL;
-    }
-    
-    if (sats < SATELLITE_WARNING || accuracy >= ACCURACY_WARNING ||
-        stability >= STABILITY_WARNING || temp >= TEMP_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double TimingSyncSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    if (!isGpsLocked()) {
-        score -= 30;
-    }
-    
-    int sats = getSatelliteCount();
-    if (sats < SATELLITE_CRITICAL) {
-        score -= 25;
-    } else if (sats < SATELLITE_WARNING) {
-        score -= 12 * (SATELLITE_WARNING - sats) / (SATELLITE_WARNING - SATELLITE_CRITICAL);
-    }
-    
-    double accuracy = getTimeAccuracy();
-    if (accuracy >= ACCURACY_CRITICAL) {
-        score -= 25;
-    } else if (accuracy >= ACCURACY_WARNING) {
-        score -= 12 * (accuracy - ACCURACY_WARNING) / (ACCURACY_CRITICAL - ACCURACY_WARNING);
-    }
-    
-    double stability = getOcxoStability();
-    if (stability >= STABILITY_CRITICAL) {
-        score -= 20;
-    } else if (stability >= STABILITY_WARNING) {
-        score -= 10 * (stability - STABILITY_WARNING) / (STABILITY_CRITICAL - STABILITY_WARNING);
-    }
-    
-    if (!isPpsValid()) {
-        score -= 20;
-    }
-    
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+void TimingSyncSubsystem::initializeHealthRules()
+{
+    HealthRule gps = HealthRule::boolean("gpsLocked", true);
+    gps.criticalPenalty = 30;
+    gps.faultCode = FAULT_GPS_UNLOCK;
+    gps.faultDescription = "GPS unlocked";
+    gps.criticalMessage = "CRITICAL: GPS unlocked";
+    addHealthRule(gps);
+    
+    HealthRule pps = HealthRule::boolean("ppsValid", true);
+    pps.criticalPenalty = 20;
+    pps.faultCode = FAULT_PPS_INVALID;
+    pps.faultDescription = "PPS signal invalid";
+    pps.criticalMessage = "CRITICAL: PPS invalid";
+    addHealthRule(pps);
+    
+    // Limits are inherited from the telemetry parameters above; the
+    // satellite limits are the first count that is still acceptable
+    HealthRule sats = HealthRule::threshold("satelliteCount", 25, 12);
+    sats.inclusive = false;
+    sats.faultCode = FAULT_LOW_SATELLITES;
+    sats.faultDescription = "Low satellite count";
+    sats.faultSeverity = FaultSeverity::WARNING;
+    sats.warningMessage = "WARNING: Low satellites (%1)";
+    sats.criticalMessage = "CRITICAL: Low satellites (%1)";
+    sats.precision = 0;
+    addHealthRule(sats);
+    
+    HealthRule accuracy = HealthRule::threshold("timeAccuracy", 25, 12);
+    accuracy.criticalMessage = "CRITICAL: Time accuracy degraded";
+    addHealthRule(accuracy);
+    
+    HealthRule stability = HealthRule::threshold("ocxoStability", 20, 10);
+    stability.faultCode = FAULT_OCXO_DRIFT;
+    stability.faultDescription = "OCXO frequency drift";
+    stability.faultSeverity = FaultSeverity::WARNING;
+    addHealthRule(stability);
+    
+    // Temperature affects state only
+    addHealthRule(HealthRule::threshold("temperature"));
 }
 
 QString TimingSyncSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Timing System disabled";
     }
     
-    if (!isGpsLocked()) {
-        return "CRITICAL: GPS unlocked";
-    }
-    
-    if (!isPpsValid()) {
-        return "CRITICAL: PPS invalid";
-    }
-    
-    int sats = getSatelliteCount();
-    if (sats < SATELLITE_CRITICAL) {
-        return QString("CRITICAL: Low satellites (%1)").arg(sats);
-    }
-    
-    double accuracy = getTimeAccuracy();
-    if (accuracy >= ACCURACY_CRITICAL) {
-        return "CRITICAL: Time accuracy degraded";
-    }
-    
-    if (sats < SATELLITE_WARNING) {
-        return QString("WARNING: Low satellites (%1)").arg(sats);
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("%1 - %2 sats, Accuracy: %3 ns")
            .arg(getSyncSource())
-           .arg(sats)
-           .arg(accuracy, 0, 'f', 0);
-}
-
-void TimingSyncSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    if (data.contains("gpsLocked")) {
-        bool locked = data["gpsLocked"].toBool();
-        if (!locked) {
-            addFault(FaultCode(FAULT_GPS_UNLOCK, "GPS unlocked", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_GPS_UNLOCK);
-        }
-    }
-    
-    if (data.contains("satelliteCount")) {
-        int sats = data["satelliteCount"].toInt();
-        if (sats < SATELLITE_CRITICAL) {
-            addFault(FaultCode(FAULT_LOW_SATELLITES, "Low satellite count", 
-                              FaultSeverity::WARNING, getId()));
-        } else {
-            clearFault(FAULT_LOW_SATELLITES);
-        }
-    }
-    
-    if (data.contains("ppsValid")) {
-        bool valid = data["ppsValid"].toBool();
-        if (!valid) {
-            addFault(FaultCode(FAULT_PPS_INVALID, "PPS signal invalid", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_PPS_INVALID);
-        }
-    }
-    
-    if (data.contains("ocxoStability")) {
-        double stability = data["ocxoStability"].toDouble();
-        if (stability >= STABILITY_CRITICAL) {
-            addFault(FaultCode(FAULT_OCXO_DRIFT, "OCXO frequency drift", 
-                              FaultSeverity::WARNING, getId()));
-        } else {
-            clearFault(FAULT_OCXO_DRIFT);
-        }
-    }
+           .arg(getSatelliteCount())
+           .arg(getTimeAccuracy(), 0, 'f', 0);
 }
 
 } // namespace RadarRMP
@@ -6,7 +6,13 @@ TransmitterSubsystem::TransmitterSubsystem(const QString& id, const QString& nam
     : RadarSubsystem(id, name, SubsystemType::Transmitter, parent)
 {
     setDescription("High-power RF transmitter unit with modulator and HV power supply");
+    registerFaultCodes({
+        FAULT_RF_POWER_LOW, FAULT_RF_POWER_HIGH, FAULT_VSWR_HIGH,
+        FAULT_OVERTEMP, FAULT_HV_FAIL, FAULT_MODULATOR,
+        FAULT_ARC_DETECT, FAULT_INTERLOCK
+    });
     initializeTelemetryParameters();
+    initializeHealthRules();
 }
 
 void TransmitterSubsystem::initializeTelemetryParameters()
@@ -135,91 +141,51 @@ double TransmitterSubsystem::getPrf() const
     return getTelemetryValue("prf").toDouble();
 }
 
-HealthState TransmitterSubsystem::computeHealthState() const
+void TransmitterSubsystem::initializeHealthRules()
 {
-    if (!isEnabled()) {
-        return HealthState::UNKNOWN;
-    }
-    
-    // Check for critical conditions
-    double temp = getTemperature();
-    double vswr = getVswr();
-    double rfPower = getRfPower();
-    double hvVoltage = getHvVoltage();
-    
-    // Critical failures
-    if (temp >= TEMP_CRITICAL) {
-        return HealthState::FAIL;
-    }
-    if (vswr >= VSWR_CRITICAL) {
-        return HealthState::FAIL;
-    }
-    if (rfPower <= RF_POWER_CRITICAL_LOW) {
-        return HealthState::FAIL;
-    }
-    if (hvVoltage <= HV_CRITICAL_LOW * 0.25) {  // 80% of nominal 25kV
-        return HealthState::FAIL;
-    }
-    
-    // Check for degraded conditions
-    if (temp >= TEMP_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    if (vswr >= VSWR_WARNING) {
-        return HealthState::DEGRADED;
-    }
-    if (rfPower <= RF_POWER_WARNING_LOW) {
-        return HealthState::DEGRADED;
-    }
-    if (hvVoltage <= HV_WARNING_LOW * 0.25) {
-        return HealthState::DEGRADED;
-    }
-    
-    // Check for active faults
-    if (hasFaults()) {
-        return HealthState::DEGRADED;
-    }
-    
-    return HealthState::OK;
-}
-
-double TransmitterSubsystem::computeHealthScore() const
-{
-    double score = 100.0;
-    
-    // Temperature score
-    double temp = getTemperature();
-    if (temp >= TEMP_CRITICAL) {
-        score -= 40;
-    } else if (temp >= TEMP_WARNING) {
-        score -= 20 * (temp - TEMP_WARNING) / (TEMP_CRITICAL - TEMP_WARNING);
-    }
-    
-    // VSWR score
-    double vswr = getVswr();
-    if (vswr >= VSWR_CRITICAL) {
-        score -= 30;
-    } else if (vswr >= VSWR_WARNING) {
-        score -= 15 * (vswr - VSWR_WARNING) / (VSWR_CRITICAL - VSWR_WARNING);
-    }
-    
-    // RF Power score
-    double rfPower = getRfPower();
-    if (rfPower <= RF_POWER_CRITICAL_LOW) {
-        score -= 30;
-    } else if (rfPower <= RF_POWER_WARNING_LOW) {
-        score -= 15 * (RF_POWER_WARNING_LOW - rfPower) / (RF_POWER_WARNING_LOW - RF_POWER_CRITICAL_LOW);
-    }
-    
-    // Fault penalty
-    score -= getFaultCount() * 5;
-    
-    return qMax(0.0, qMin(100.0, score));
+    // Limits are inherited from the telemetry parameters above
+    HealthRule temp = HealthRule::threshold("temperature", 40, 20);
+    temp.faultCode = FAULT_OVERTEMP;
+    temp.faultDescription = "Transmitter overtemperature";
+    temp.warningMessage = "WARNING: Elevated temperature";
+    temp.criticalMessage = "CRITICAL: Over temperature";
+    addHealthRule(temp);
+    
+    HealthRule vswr = HealthRule::threshold("vswr", 30, 15);
+    vswr.faultCode = FAULT_VSWR_HIGH;
+    vswr.faultDescription = "High VSWR detected";
+    vswr.warningMessage = "WARNING: VSWR above normal";
+    vswr.criticalMessage = "CRITICAL: High VSWR - Check antenna";
+    addHealthRule(vswr);
+    
+    HealthRule rfPower = HealthRule::threshold("rfPower", 30, 15);
+    rfPower.warningMessage = "WARNING: RF power below nominal";
+    rfPower.criticalMessage = "CRITICAL: Low RF output";
+    addHealthRule(rfPower);
+    
+    // HV sag affects state only
+    HealthRule hvVoltage = HealthRule::threshold("hvVoltage");
+    hvVoltage.bound = HealthRule::Bound::Low;
+    addHealthRule(hvVoltage);
+    
+    // Boolean rules fire on a mismatch: expecting HV off, this one fires
+    // while HV is on. Low RF output is only a fault then.
+    HealthRule hvOn = HealthRule::boolean("hvEnabled", false);
+    hvOn.id = "hvOn";
+    hvOn.affectsHealth = false;
+    addHealthRule(hvOn);
+    
+    HealthRule rfPowerFault = HealthRule::combination("rfPowerLowWhileHvOn",
+        HealthRule::Combine::All, {"rfPower", "hvOn"});
+    rfPowerFault.affectsHealth = false;
+    rfPowerFault.faultCode = FAULT_RF_POWER_LOW;
+    rfPowerFault.faultDescription = "Low RF output power";
+    addHealthRule(rfPowerFault);
 }
 
 QString TransmitterSubsystem::computeStatusMessage() const
 {
-    if (!isEnabled()) {
+    if (!m_enabled) {
         return "Transmitter disabled";
     }
     
@@ -227,74 +193,14 @@ QString TransmitterSubsystem::computeStatusMessage() const
         return "HV off - Standby mode";
     }
     
-    double temp = getTemperature();
-    if (temp >= TEMP_CRITICAL) {
-        return "CRITICAL: Over temperature";
-    }
-    
-    double vswr = getVswr();
-    if (vswr >= VSWR_CRITICAL) {
-        return "CRITICAL: High VSWR - Check antenna";
-    }
-    
-    double rfPower = getRfPower();
-    if (rfPower <= RF_POWER_CRITICAL_LOW) {
-        return "CRITICAL: Low RF output";
-    }
-    
-    if (temp >= TEMP_WARNING) {
-        return "WARNING: Elevated temperature";
-    }
-    
-    if (vswr >= VSWR_WARNING) {
-        return "WARNING: VSWR above normal";
-    }
-    
-    if (rfPower <= RF_POWER_WARNING_LOW) {
-        return "WARNING: RF power below nominal";
+    QString alarm = healthRuleMessage();
+    if (!alarm.isEmpty()) {
+        return alarm;
     }
     
     return QString("Transmitting - %1 kW @ %2 Hz PRF")
-           .arg(rfPower, 0, 'f', 1)
+           .arg(getRfPower(), 0, 'f', 1)
            .arg(getPrf(), 0, 'f', 0);
 }
 
-void TransmitterSubsystem::onDataUpdate(const QVariantMap& data)
-{
-    // Check for fault conditions after data update
-    
-    // VSWR fault
-    if (data.contains("vswr")) {
-        double vswr = data["vswr"].toDouble();
-        if (vswr >= VSWR_CRITICAL) {
-            addFault(FaultCode(FAULT_VSWR_HIGH, "High VSWR detected", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_VSWR_HIGH);
-        }
-    }
-    
-    // Temperature fault
-    if (data.contains("temperature")) {
-        double temp = data["temperature"].toDouble();
-        if (temp >= TEMP_CRITICAL) {
-            addFault(FaultCode(FAULT_OVERTEMP, "Transmitter overtemperature", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_OVERTEMP);
-        }
-    }
-    
-    // RF Power fault
-    if (data.contains("rfPower")) {
-        double power = data["rfPower"].toDouble();
-        if (power <= RF_POWER_CRITICAL_LOW && isHvEnabled()) {
-            addFault(FaultCode(FAULT_RF_POWER_LOW, "Low RF output power", 
-                              FaultSeverity::CRITICAL, getId()));
-        } else {
-            clearFault(FAULT_RF_POWER_LOW);
-        }
-    }
-}
-
 } // namespace RadarRMP
@@ -0,0 +1,177 @@
+#include "core/SubsystemManager.h"
+#include "core/SignalCoalescer.h"
+#include "subsystems/CoolingSubsystem.h"
+#include <QPointer>
+#include <QSemaphore>
+#include <QSignalSpy>
+#include <QtTest>
+#include <atomic>
+
+using namespace RadarRMP;
+
+namespace {
+
+/**
+ * @brief Cooling subsystem whose worker can be held inside updateData()
+ */
+class BlockingCooling : public CoolingSubsystem {
+public:
+    explicit BlockingCooling(const QString& id)
+        : CoolingSubsystem(id)
+    {
+    }
+
+    std::atomic<bool> hold{false};
+    QSemaphore entered;
+    QSemaphore gate;
+
+protected:
+    void onDataUpdate(const QVariantMap& data) override
+    {
+        if (hold.exchange(false)) {
+            entered.release();
+            gate.acquire();
+        }
+        CoolingSubsystem::onDataUpdate(data);
+    }
+};
+
+qint64 evaluationCount(RadarSubsystem* subsystem)
+{
+    return subsystem->getHealthRuleStats().value("evaluationCount").toLongLong();
+}
+
+} // namespace
+
+/**
+ * @brief applyBatch() on the worker pool, two cooling subsystems on the canvas
+ */
+class TestBatchApply : public QObject {
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void parallelBatchEmitsOneAggregate();
+    void repeatedIdsAreMerged();
+    void unregisterDuringBatchDefersDelete();
+
+private:
+    void settle();
+    void add(RadarSubsystem* subsystem);
+
+    SubsystemManager* m_manager = nullptr;
+};
+
+void TestBatchApply::init()
+{
+    m_manager = new SubsystemManager();
+    add(new CoolingSubsystem("COOL-A"));
+    add(new CoolingSubsystem("COOL-B"));
+    settle();
+}
+
+void TestBatchApply::cleanup()
+{
+    delete m_manager;
+    m_manager = nullptr;
+}
+
+void TestBatchApply::settle()
+{
+    SignalCoalescer::instance()->flush();
+    QCoreApplication::processEvents();
+}
+
+void TestBatchApply::add(RadarSubsystem* subsystem)
+{
+    // On the canvas, systemHealthChanged() only fires when the aggregate moves
+    m_manager->registerSubsystem(subsystem);
+    m_manager->addToCanvas(subsystem->getId());
+}
+
+void TestBatchApply::parallelBatchEmitsOneAggregate()
+{
+    QSignalSpy system(m_manager, &SubsystemManager::systemHealthChanged);
+    QSignalSpy perSubsystem(m_manager, &SubsystemManager::subsystemHealthChanged);
+    QSignalSpy applied(m_manager, &SubsystemManager::batchApplied);
+    const double before = m_manager->getSystemHealthScore();
+
+    const SubsystemUpdateBatch batch{
+        {"COOL-A", {{"coolantTemp", 50.0}}},
+        {"COOL-B", {{"coolantTemp", 50.0}}},
+    };
+    QCOMPARE(m_manager->applyBatch(batch, true), 2);
+
+    // The aggregate is published by the last worker, never before it
+    QCOMPARE(system.count(), 0);
+    QVERIFY(applied.wait(5000));
+
+    // Let the subsystems' queued notifications and any frame land too
+    QTest::qWait(100);
+    settle();
+    QCOMPARE(system.count(), 1);
+    QCOMPARE(perSubsystem.count(), 0);
+    QCOMPARE(applied.count(), 1);
+    QCOMPARE(applied.first().at(0).toStringList().size(), 2);
+    QVERIFY(m_manager->getSystemHealthScore() < before);
+}
+
+void TestBatchApply::repeatedIdsAreMerged()
+{
+    RadarSubsystem* a = m_manager->getSubsystem("COOL-A");
+    const qint64 evaluated = evaluationCount(a);
+    QSignalSpy applied(m_manager, &SubsystemManager::batchApplied);
+
+    const SubsystemUpdateBatch batch{
+        {"COOL-A", {{"coolantTemp", 40.0}, {"coolantFlow", 16.0}}},
+        {"COOL-B", {{"coolantTemp", 30.0}}},
+        {"COOL-A", {{"coolantTemp", 42.0}}},
+    };
+    QCOMPARE(m_manager->applyBatch(batch, true), 2);
+    QVERIFY(applied.wait(5000));
+
+    // Later fields win, earlier ones survive, and A is evaluated once
+    QCOMPARE(a->getTelemetryValue("coolantTemp").toDouble(), 42.0);
+    QCOMPARE(a->getTelemetryValue("coolantFlow").toDouble(), 16.0);
+    QCOMPARE(evaluationCount(a), evaluated + 1);
+
+    QStringList ids = applied.first().at(0).toStringList();
+    ids.sort();
+    QCOMPARE(ids, QStringList({"COOL-A", "COOL-B"}));
+}
+
+void TestBatchApply::unregisterDuringBatchDefersDelete()
+{
+    auto* blocking = new BlockingCooling("COOL-C");
+    add(blocking);
+    settle();
+
+    QPointer<RadarSubsystem> guard(blocking);
+    QSignalSpy applied(m_manager, &SubsystemManager::batchApplied);
+
+    blocking->hold = true;
+    const SubsystemUpdateBatch batch{
+        {"COOL-C", {{"coolantTemp", 30.0}}},
+        {"COOL-A", {{"coolantTemp", 30.0}}},
+    };
+    QCOMPARE(m_manager->applyBatch(batch, true), 2);
+    QVERIFY(blocking->entered.tryAcquire(1, 5000));
+
+    // Its worker is still inside updateData(): gone from the manager, not deleted
+    m_manager->unregisterSubsystem("COOL-C");
+    QVERIFY(!m_manager->getSubsystem("COOL-C"));
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    QVERIFY(guard);
+
+    blocking->gate.release();
+    QVERIFY(applied.wait(5000));
+    QCOMPARE(applied.first().at(0).toStringList(), QStringList({"COOL-A"}));
+
+    // finishBatch() hands it to deleteLater() rather than forgetting it
+    QTRY_VERIFY(guard.isNull());
+}
+
+QTEST_GUILESS_MAIN(TestBatchApply)
+#include "tst_batchapply.moc"
@@ -0,0 +1,180 @@
+#include "core/FaultManager.h"
+#include "core/SignalCoalescer.h"
+#include <QSignalSpy>
+#include <QtTest>
+#include <memory>
+
+using namespace RadarRMP;
+
+namespace {
+
+FaultCode makeFault(const QString& subsystemId, const QString& code,
+                    FaultSeverity severity = FaultSeverity::CRITICAL)
+{
+    return FaultCode(code, code + " fault", severity, subsystemId);
+}
+
+} // namespace
+
+/**
+ * @brief Root/consequential classification over PSU -> TX -> SP, COOL apart
+ */
+class TestFaultClassification : public QObject {
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void faultBelowActiveRootIsConsequential();
+    void causeIsNearestFaultedUpstream();
+    void newRootDemotesDownstreamFaults();
+    void clearingRootPromotesItsConsequences();
+    void clearingConsequentialFaultsNotifies_data();
+    void clearingConsequentialFaultsNotifies();
+    void dependencyEditsReclassify();
+
+private:
+    void publish() { SignalCoalescer::instance()->flush(); }
+
+    std::unique_ptr<FaultManager> m_faults;
+};
+
+void TestFaultClassification::init()
+{
+    m_faults = std::make_unique<FaultManager>();
+    QVERIFY(m_faults->addDependency("TX-001", "PSU-001"));
+    QVERIFY(m_faults->addDependency("SP-001", "TX-001"));
+}
+
+void TestFaultClassification::cleanup()
+{
+    m_faults.reset();
+}
+
+void TestFaultClassification::faultBelowActiveRootIsConsequential()
+{
+    QSignalSpy registered(m_faults.get(), &FaultManager::faultRegistered);
+
+    m_faults->registerFault(makeFault("PSU-001", "PSU-001"));
+    m_faults->registerFault(makeFault("TX-001", "TX-004"));
+    m_faults->registerFault(makeFault("COOL-001", "CL-001"));
+
+    QVERIFY(!m_faults->isConsequential("PSU-001", "PSU-001"));
+    QVERIFY(m_faults->isConsequential("TX-001", "TX-004"));
+    QVERIFY(!m_faults->isConsequential("COOL-001", "CL-001"));
+    QCOMPARE(m_faults->getFault("TX-004").causedBy, QString("PSU-001"));
+
+    // The consequence is queryable but surfaces nowhere else
+    QCOMPARE(m_faults->getTotalActiveFaults(), 2);
+    QCOMPARE(m_faults->getCriticalFaultCount(), 2);
+    QCOMPARE(m_faults->getSuppressedFaultCount(), 1);
+    QCOMPARE(m_faults->getConsequentialCount("PSU-001"), 1);
+    QCOMPARE(m_faults->getFaultCount("TX-001"), 0);
+    QCOMPARE(m_faults->getFaultCount("PSU-001"), 1);
+    QCOMPARE(m_faults->getFaultHistory().size(), 2);
+    QCOMPARE(registered.count(), 2);
+    QCOMPARE(m_faults->getConsequentialFaultsVariant("PSU-001").size(), 1);
+}
+
+void TestFaultClassification::causeIsNearestFaultedUpstream()
+{
+    m_faults->registerFault(makeFault("PSU-001", "PSU-001"));
+
+    // TX has no fault of its own, so SP's cause is two hops up
+    m_faults->registerFault(makeFault("SP-001", "SP-002"));
+    QCOMPARE(m_faults->getFault("SP-002").causedBy, QString("PSU-001"));
+
+    // A consequential TX fault does not become SP's cause
+    m_faults->registerFault(makeFault("TX-001", "TX-004"));
+    m_faults->registerFault(makeFault("SP-001", "SP-003"));
+    QCOMPARE(m_faults->getFault("SP-003").causedBy, QString("PSU-001"));
+    QCOMPARE(m_faults->getConsequentialCount("PSU-001"), 3);
+}
+
+void TestFaultClassification::newRootDemotesDownstreamFaults()
+{
+    m_faults->registerFault(makeFault("TX-001", "TX-004"));
+    m_faults->registerFault(makeFault("SP-001", "SP-002"));
+    QCOMPARE(m_faults->getFault("SP-002").causedBy, QString("TX-001"));
+    QCOMPARE(m_faults->getTotalActiveFaults(), 1);
+
+    m_faults->registerFault(makeFault("PSU-001", "PSU-001"));
+    QCOMPARE(m_faults->getFault("TX-004").causedBy, QString("PSU-001"));
+    QCOMPARE(m_faults->getFault("SP-002").causedBy, QString("PSU-001"));
+    QCOMPARE(m_faults->getTotalActiveFaults(), 1);
+    QCOMPARE(m_faults->getSuppressedFaultCount(), 2);
+}
+
+void TestFaultClassification::clearingRootPromotesItsConsequences()
+{
+    m_faults->registerFault(makeFault("PSU-001", "PSU-001"));
+    m_faults->registerFault(makeFault("TX-001", "TX-004"));
+    m_faults->registerFault(makeFault("SP-001", "SP-002"));
+
+    QSignalSpy registered(m_faults.get(), &FaultManager::faultRegistered);
+    m_faults->clearFault("PSU-001", "PSU-001");
+
+    // TX is promoted and announced; SP is now explained by TX instead
+    QVERIFY(!m_faults->isConsequential("TX-001", "TX-004"));
+    QCOMPARE(m_faults->getFault("SP-002").causedBy, QString("TX-001"));
+    QCOMPARE(registered.count(), 1);
+    QCOMPARE(registered.first().at(0).toString(), QString("TX-001"));
+    QCOMPARE(m_faults->getTotalActiveFaults(), 1);
+    QCOMPARE(m_faults->getSuppressedFaultCount(), 1);
+    QCOMPARE(m_faults->getConsequentialCount("PSU-001"), 0);
+    QCOMPARE(m_faults->getConsequentialCount("TX-001"), 1);
+}
+
+void TestFaultClassification::clearingConsequentialFaultsNotifies_data()
+{
+    QTest::addColumn<bool>("clearAll");
+    QTest::newRow("clearFault") << false;
+    QTest::newRow("clearAllFaults") << true;
+}
+
+void TestFaultClassification::clearingConsequentialFaultsNotifies()
+{
+    QFETCH(bool, clearAll);
+
+    m_faults->registerFault(makeFault("PSU-001", "PSU-001"));
+    m_faults->registerFault(makeFault("TX-001", "TX-004"));
+    publish();
+
+    QSignalSpy changed(m_faults.get(), &FaultManager::faultsChanged);
+    QSignalSpy cleared(m_faults.get(), &FaultManager::faultCleared);
+    if (clearAll) {
+        m_faults->clearAllFaults("TX-001");
+    } else {
+        m_faults->clearFault("TX-004", "TX-001");
+    }
+    publish();
+
+    // Nothing to retract, but suppressedFaultCount moved
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(cleared.count(), 0);
+    QCOMPARE(m_faults->getSuppressedFaultCount(), 0);
+    QCOMPARE(m_faults->getTotalActiveFaults(), 1);
+}
+
+void TestFaultClassification::dependencyEditsReclassify()
+{
+    m_faults->registerFault(makeFault("PSU-001", "PSU-001"));
+    m_faults->registerFault(makeFault("COOL-001", "CL-001"));
+    QCOMPARE(m_faults->getTotalActiveFaults(), 2);
+
+    QVERIFY(m_faults->addDependency("COOL-001", "PSU-001"));
+    QVERIFY(m_faults->isConsequential("COOL-001", "CL-001"));
+    QCOMPARE(m_faults->getTotalActiveFaults(), 1);
+
+    QVERIFY(m_faults->removeDependency("COOL-001", "PSU-001"));
+    QVERIFY(!m_faults->isConsequential("COOL-001", "CL-001"));
+    QCOMPARE(m_faults->getTotalActiveFaults(), 2);
+
+    // Closing a cycle is refused and leaves the classification alone
+    QVERIFY(!m_faults->addDependency("PSU-001", "SP-001"));
+    QVERIFY(!m_faults->isConsequential("PSU-001", "PSU-001"));
+}
+
+QTEST_GUILESS_MAIN(TestFaultClassification)
+#include "tst_faultclassification.moc"
@@ -0,0 +1,133 @@
+#include "core/HealthRollup.h"
+#include <QSignalSpy>
+#include <QtTest>
+
+using namespace RadarRMP;
+
+class TestHealthRollup : public QObject {
+    Q_OBJECT
+
+private slots:
+    void kOfNState_data();
+    void kOfNState();
+    void kOfNFailsWhenDetachingDropsBelowQuorum();
+    void worstOfTakesWorstChildAndWeightedScore();
+    void unchangedLeafStopsPropagation();
+};
+
+void TestHealthRollup::kOfNState_data()
+{
+    QTest::addColumn<QList<HealthState>>("leaves");
+    QTest::addColumn<HealthState>("expected");
+
+    const HealthState ok = HealthState::OK;
+    const HealthState degraded = HealthState::DEGRADED;
+    const HealthState fail = HealthState::FAIL;
+    const HealthState unknown = HealthState::UNKNOWN;
+
+    // Quorum 2 of 3: DEGRADED and OK both count as available
+    QTest::newRow("all ok") << QList<HealthState>{ok, ok, ok} << ok;
+    QTest::newRow("one degraded") << QList<HealthState>{ok, ok, degraded} << degraded;
+    QTest::newRow("one failed") << QList<HealthState>{ok, ok, fail} << degraded;
+    QTest::newRow("quorum of degraded") << QList<HealthState>{degraded, degraded, fail} << degraded;
+    QTest::newRow("below quorum") << QList<HealthState>{ok, fail, fail} << fail;
+    QTest::newRow("all failed") << QList<HealthState>{fail, fail, fail} << fail;
+    QTest::newRow("one unreported") << QList<HealthState>{ok, ok, unknown} << degraded;
+    QTest::newRow("nothing reported") << QList<HealthState>{unknown, unknown, unknown} << unknown;
+}
+
+void TestHealthRollup::kOfNState()
+{
+    QFETCH(QList<HealthState>, leaves);
+    QFETCH(HealthState, expected);
+
+    HealthRollup rollup;
+    QVERIFY(rollup.addNode("rack", "Transmitter rack", QString(), HealthRollup::KOfN, 2));
+    for (int i = 0; i < leaves.size(); ++i) {
+        const QString id = QString("TX-%1").arg(i + 1);
+        QVERIFY(rollup.attachLeaf(id, "rack"));
+        rollup.updateLeaf(id, leaves.at(i), 100.0, true);
+    }
+
+    QCOMPARE(rollup.nodeState("rack"), expected);
+}
+
+void TestHealthRollup::kOfNFailsWhenDetachingDropsBelowQuorum()
+{
+    HealthRollup rollup;
+    rollup.addNode("rack", "Transmitter rack", QString(), HealthRollup::KOfN, 2);
+    for (const QString& id : {QString("TX-1"), QString("TX-2"), QString("TX-3")}) {
+        rollup.attachLeaf(id, "rack");
+        rollup.updateLeaf(id, HealthState::OK, 100.0, true);
+    }
+    QCOMPARE(rollup.nodeState("rack"), HealthState::OK);
+
+    rollup.detachLeaf("TX-3");
+    QCOMPARE(rollup.nodeState("rack"), HealthState::OK);
+
+    rollup.detachLeaf("TX-2");
+    QCOMPARE(rollup.nodeState("rack"), HealthState::FAIL);
+}
+
+void TestHealthRollup::worstOfTakesWorstChildAndWeightedScore()
+{
+    // site (WorstOf) -> rack (KOfN 2 of 3, weight 1) + PSU leaf (weight 3)
+    HealthRollup rollup;
+    rollup.addNode("site", "Site", QString());
+    rollup.addNode("rack", "Transmitter rack", "site", HealthRollup::KOfN, 2);
+    rollup.attachLeaf("TX-1", "rack");
+    rollup.attachLeaf("TX-2", "rack");
+    rollup.attachLeaf("TX-3", "rack");
+    rollup.attachLeaf("PSU-1", "site", 3.0);
+
+    rollup.updateLeaf("TX-1", HealthState::OK, 90.0, true);
+    rollup.updateLeaf("TX-2", HealthState::DEGRADED, 60.0, true);
+    rollup.updateLeaf("TX-3", HealthState::FAIL, 30.0, true);
+    rollup.updateLeaf("PSU-1", HealthState::OK, 100.0, true);
+
+    // The rack's failed member is absorbed by its quorum, not passed up
+    QCOMPARE(rollup.nodeState("rack"), HealthState::DEGRADED);
+    QCOMPARE(rollup.nodeScore("rack"), 60.0);
+    QCOMPARE(rollup.nodeState("site"), HealthState::DEGRADED);
+    QCOMPARE(rollup.nodeScore("site"), (1.0 * 60.0 + 3.0 * 100.0) / 4.0);
+
+    rollup.updateLeaf("PSU-1", HealthState::FAIL, 20.0, true);
+    QCOMPARE(rollup.nodeState("site"), HealthState::FAIL);
+    QCOMPARE(rollup.nodeScore("site"), (1.0 * 60.0 + 3.0 * 20.0) / 4.0);
+
+    // A disabled subsystem keeps its state but drops out of the score
+    rollup.updateLeaf("PSU-1", HealthState::FAIL, 20.0, false);
+    QCOMPARE(rollup.nodeScore("site"), 60.0);
+}
+
+void TestHealthRollup::unchangedLeafStopsPropagation()
+{
+    HealthRollup rollup;
+    rollup.addNode("site", "Site", QString());
+    rollup.addNode("rack", "Transmitter rack", "site", HealthRollup::KOfN, 1);
+    rollup.attachLeaf("TX-1", "rack");
+    rollup.attachLeaf("TX-2", "rack");
+    rollup.attachLeaf("PSU-1", "site");
+    rollup.updateLeaf("TX-1", HealthState::OK, 100.0, true);
+    rollup.updateLeaf("TX-2", HealthState::OK, 100.0, true);
+    rollup.updateLeaf("PSU-1", HealthState::OK, 100.0, true);
+
+    QSignalSpy changed(&rollup, &HealthRollup::nodeChanged);
+
+    rollup.updateLeaf("TX-1", HealthState::OK, 100.0, true);
+    QCOMPARE(changed.count(), 0);
+
+    // A sibling of the rack changes: only the site is re-evaluated
+    rollup.updateLeaf("PSU-1", HealthState::DEGRADED, 70.0, true);
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(changed.takeFirst().at(0).toString(), QString("site"));
+
+    // Rack state moves (OK -> DEGRADED) and the change reaches the site
+    rollup.updateLeaf("TX-2", HealthState::FAIL, 100.0, true);
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(changed.takeFirst().at(0).toString(), QString("rack"));
+    QCOMPARE(rollup.nodeState("site"), HealthState::DEGRADED);
+}
+
+QTEST_GUILESS_MAIN(TestHealthRollup)
+#include "tst_healthrollup.moc"
@@ -0,0 +1,163 @@
+#include "core/RadarSubsystem.h"
+#include <QSignalSpy>
+#include <QtTest>
+
+using namespace RadarRMP;
+
+namespace {
+
+const QString FAULT_OVERTEMP = QStringLiteral("TMP-001");
+
+/**
+ * @brief One temperature parameter and one fault-raising threshold rule
+ *
+ * inject() stands in for FaultInjector / an operator raising the rule's
+ * code by hand.
+ */
+class ProbeSubsystem : public RadarSubsystem {
+public:
+    explicit ProbeSubsystem(QObject* parent = nullptr)
+        : RadarSubsystem("PROBE-1", "Probe", SubsystemType::Cooling, parent)
+    {
+        registerFaultCodes({FAULT_OVERTEMP});
+
+        TelemetryParameter temperature("temperature", "Temperature", "°C");
+        temperature.nominal = 25.0;
+        temperature.minValue = 0.0;
+        temperature.maxValue = 120.0;
+        temperature.warningHigh = 60.0;
+        temperature.criticalHigh = 80.0;
+        temperature.value = 25.0;
+        addTelemetryParameter(temperature);
+
+        HealthRule rule = HealthRule::threshold("temperature", 40, 10);
+        rule.faultCode = FAULT_OVERTEMP;
+        rule.faultDescription = "Overtemperature";
+        addHealthRule(rule);
+    }
+
+    void inject()
+    {
+        addFault(FaultCode(FAULT_OVERTEMP, "Injected overtemperature",
+                           FaultSeverity::CRITICAL, getId()));
+    }
+
+    void setTemperature(double value) { updateData({{"temperature", value}}); }
+
+    bool hasOvertemp() const
+    {
+        const QVariantList faults = getFaults();
+        for (const QVariant& fault : faults) {
+            if (fault.toMap().value("code").toString() == FAULT_OVERTEMP) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    qint64 evaluationCount() const
+    {
+        return getHealthRuleStats().value("evaluationCount").toLongLong();
+    }
+};
+
+} // namespace
+
+class TestHealthRules : public QObject {
+    Q_OBJECT
+
+private slots:
+    void ruleRaisesAndClearsItsOwnFault();
+    void injectedFaultSurvivesRuleReturningToNormal();
+    void ruleReraisesAfterOperatorClear();
+    void unchangedInputsSkipEvaluation();
+    void limitItselfIsCrossed();
+};
+
+void TestHealthRules::ruleRaisesAndClearsItsOwnFault()
+{
+    ProbeSubsystem probe;
+    QSignalSpy raised(&probe, &RadarSubsystem::faultOccurred);
+    QSignalSpy cleared(&probe, &RadarSubsystem::faultCleared);
+
+    probe.setTemperature(90.0);
+    QVERIFY(probe.hasOvertemp());
+    QCOMPARE(probe.getHealthState(), HealthState::FAIL);
+    QCOMPARE(raised.count(), 1);
+    QCOMPARE(raised.first().at(0).toString(), FAULT_OVERTEMP);
+
+    // Still critical: the fault is not raised a second time
+    probe.setTemperature(95.0);
+    QCOMPARE(raised.count(), 1);
+
+    probe.setTemperature(30.0);
+    QVERIFY(!probe.hasOvertemp());
+    QCOMPARE(cleared.count(), 1);
+    QCOMPARE(cleared.first().at(0).toString(), FAULT_OVERTEMP);
+}
+
+void TestHealthRules::injectedFaultSurvivesRuleReturningToNormal()
+{
+    ProbeSubsystem probe;
+    probe.inject();
+    QVERIFY(probe.hasOvertemp());
+
+    // The rule finds the code already active and does not take it over
+    probe.setTemperature(90.0);
+    probe.setTemperature(30.0);
+    QVERIFY(probe.hasOvertemp());
+
+    // Whoever raised it can still clear it
+    QVERIFY(probe.clearFault(FAULT_OVERTEMP));
+    QVERIFY(!probe.hasOvertemp());
+}
+
+void TestHealthRules::ruleReraisesAfterOperatorClear()
+{
+    ProbeSubsystem probe;
+    probe.setTemperature(90.0);
+    QVERIFY(probe.clearFault(FAULT_OVERTEMP));
+    QVERIFY(!probe.hasOvertemp());
+
+    // The next critical sample raises it again, and the rule owns it again
+    probe.setTemperature(92.0);
+    QVERIFY(probe.hasOvertemp());
+    probe.setTemperature(30.0);
+    QVERIFY(!probe.hasOvertemp());
+}
+
+void TestHealthRules::unchangedInputsSkipEvaluation()
+{
+    ProbeSubsystem probe;
+    probe.setTemperature(50.0);
+    // The second identical sample still moves the previous-sample column
+    probe.setTemperature(50.0);
+    const qint64 settled = probe.evaluationCount();
+    QVERIFY(settled > 0);
+
+    probe.setTemperature(50.0);
+    probe.updateData({{"unrelated", 1.0}});
+    QCOMPARE(probe.evaluationCount(), settled);
+
+    probe.setTemperature(51.0);
+    QCOMPARE(probe.evaluationCount(), settled + 1);
+}
+
+void TestHealthRules::limitItselfIsCrossed()
+{
+    ProbeSubsystem probe;
+    probe.setTemperature(80.0);
+    QVERIFY(probe.hasOvertemp());
+
+    // The telemetry zone agrees with the rule at the limit itself
+    TelemetryParameter temperature("temperature", "Temperature", "°C");
+    temperature.warningHigh = 60.0;
+    temperature.criticalHigh = 80.0;
+    const TelemetryParameterInfo info = TelemetryParameterInfo::fromParameter(temperature);
+    QCOMPARE(TelemetryData::thresholdZone(info, 80.0), quint8(TelemetryChange::CriticalHigh));
+    QCOMPARE(TelemetryData::thresholdZone(info, 60.0), quint8(TelemetryChange::WarningHigh));
+    QCOMPARE(TelemetryData::thresholdZone(info, 59.9), quint8(TelemetryChange::Normal));
+}
+
+QTEST_GUILESS_MAIN(TestHealthRules)
+#include "tst_healthrules.moc"
@@ -0,0 +1,197 @@
+#include "core/SharedStateLayout.h"
+#include <QtTest>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+using namespace RadarRMP;
+
+namespace {
+
+/**
+ * @brief A one-slot segment on the heap, laid out as the exporter does
+ */
+class Segment {
+public:
+    Segment()
+        : m_storage(new uint64_t[SharedState::segmentSize(1) / sizeof(uint64_t) + 1]())
+    {
+        header = new (m_storage.get()) SharedState::SegmentHeader();
+        header->headerSize = sizeof(SharedState::SegmentHeader);
+        header->slotSize = sizeof(SharedState::SubsystemSlot);
+        header->slotCapacity = 1;
+        slot = new (SharedState::slotAt(header, 0)) SharedState::SubsystemSlot();
+    }
+
+    SharedState::SegmentHeader* header;
+    SharedState::SubsystemSlot* slot;
+
+private:
+    std::unique_ptr<uint64_t[]> m_storage;
+};
+
+// Every field of write n carries n, so a torn copy mixes two values
+void writeSlot(SharedState::SubsystemSlot* slot, uint64_t n)
+{
+    SharedState::beginWrite(slot->sequence);
+    SharedState::SubsystemRecord& record = slot->record;
+    record.flags = SharedState::SlotInUse;
+    record.epoch = n;
+    record.updatedNs = static_cast<int64_t>(n);
+    record.faultMask = n;
+    record.activeFaultCount = static_cast<uint32_t>(n);
+    record.score = static_cast<double>(n);
+    for (double& value : record.values) {
+        value = static_cast<double>(n);
+    }
+    SharedState::endWrite(slot->sequence);
+}
+
+void writeSystem(SharedState::SegmentHeader* header, uint64_t n)
+{
+    SharedState::beginWrite(header->sequence);
+    header->system.subsystemCount = static_cast<uint32_t>(n);
+    header->system.healthyCount = static_cast<uint32_t>(n);
+    header->system.activeFaultCount = static_cast<uint32_t>(n);
+    header->system.score = static_cast<double>(n);
+    header->system.updatedNs = static_cast<int64_t>(n);
+    SharedState::endWrite(header->sequence);
+}
+
+bool isWhole(const SharedState::SubsystemRecord& record)
+{
+    const uint64_t n = record.epoch;
+    if (static_cast<uint64_t>(record.updatedNs) != n || record.faultMask != n
+        || record.activeFaultCount != static_cast<uint32_t>(n)
+        || record.score != static_cast<double>(n)) {
+        return false;
+    }
+    for (double value : record.values) {
+        if (value != static_cast<double>(n)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool isWhole(const SharedState::SystemRecord& record)
+{
+    const uint32_t n = record.subsystemCount;
+    return record.healthyCount == n && record.activeFaultCount == n
+        && record.score == static_cast<double>(n)
+        && record.updatedNs == static_cast<int64_t>(n);
+}
+
+} // namespace
+
+class TestSharedStateLayout : public QObject {
+    Q_OBJECT
+
+private slots:
+    void readersNeverSeeTornRecords_data();
+    void readersNeverSeeTornRecords();
+    void readGivesUpWhileWriterHoldsSlot();
+    void slotsStartAfterHeader();
+};
+
+void TestSharedStateLayout::readersNeverSeeTornRecords_data()
+{
+    QTest::addColumn<int>("readerCount");
+    QTest::newRow("one reader") << 1;
+    QTest::newRow("four readers") << 4;
+}
+
+void TestSharedStateLayout::readersNeverSeeTornRecords()
+{
+    QFETCH(int, readerCount);
+    const uint64_t writes = 200000;
+
+    Segment segment;
+    writeSlot(segment.slot, 0);
+    writeSystem(segment.header, 0);
+
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+    std::atomic<int> backwards(0);
+    std::atomic<int> consistentReads(0);
+
+    // Readers only count; QTest macros are for the test thread
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readerCount; ++r) {
+        readers.emplace_back([&]() {
+            uint64_t lastEpoch = 0;
+            // At least one pass, even if the writer finished first
+            do {
+                SharedState::SubsystemRecord record;
+                if (SharedState::readSlot(segment.slot, &record)) {
+                    consistentReads.fetch_add(1, std::memory_order_relaxed);
+                    if (!isWhole(record)) {
+                        torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    if (record.epoch < lastEpoch) {
+                        backwards.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    lastEpoch = record.epoch;
+                }
+                SharedState::SystemRecord system;
+                if (SharedState::readSystem(segment.header, &system) && !isWhole(system)) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+            } while (!done.load(std::memory_order_acquire));
+        });
+    }
+
+    std::thread writer([&]() {
+        for (uint64_t n = 1; n <= writes; ++n) {
+            writeSlot(segment.slot, n);
+            writeSystem(segment.header, n);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    writer.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    QCOMPARE(torn.load(), 0);
+    QCOMPARE(backwards.load(), 0);
+    QVERIFY(consistentReads.load() > 0);
+    QCOMPARE(segment.slot->sequence.load(), 2 * (writes + 1));
+
+    // Once the writer is idle the latest write reads back in one attempt
+    SharedState::SubsystemRecord last;
+    QVERIFY(SharedState::readSlot(segment.slot, &last, 1));
+    QCOMPARE(last.epoch, writes);
+}
+
+void TestSharedStateLayout::readGivesUpWhileWriterHoldsSlot()
+{
+    Segment segment;
+    writeSlot(segment.slot, 7);
+
+    SharedState::beginWrite(segment.slot->sequence);
+    SharedState::SubsystemRecord record;
+    QVERIFY(!SharedState::readSlot(segment.slot, &record, 8));
+
+    SharedState::endWrite(segment.slot->sequence);
+    QVERIFY(SharedState::readSlot(segment.slot, &record, 1));
+    QCOMPARE(record.epoch, uint64_t(7));
+}
+
+void TestSharedStateLayout::slotsStartAfterHeader()
+{
+    // External readers find slots through headerSize/slotSize, not sizeof
+    Segment segment;
+    const char* base = reinterpret_cast<const char*>(segment.header);
+    QCOMPARE(reinterpret_cast<const char*>(segment.slot) - base,
+             static_cast<std::ptrdiff_t>(sizeof(SharedState::SegmentHeader)));
+    QCOMPARE(SharedState::segmentSize(3),
+             sizeof(SharedState::SegmentHeader) + 3 * sizeof(SharedState::SubsystemSlot));
+}
+
+QTEST_GUILESS_MAIN(TestSharedStateLayout)
+#include "tst_sharedstatelayout.moc"
@@ -0,0 +1,130 @@
+#include "subsystems/CoolingSubsystem.h"
+#include "core/SignalCoalescer.h"
+#include <QThread>
+#include <QtTest>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace RadarRMP;
+
+/**
+ * @brief Worker-thread writers against one subsystem owned by the test thread
+ *
+ * Writers alternate coolantTemp across its critical limit, so the
+ * coolant-overtemperature rule raises and clears its fault from worker
+ * threads the whole time.
+ */
+class TestSubsystemThreading : public QObject {
+    Q_OBJECT
+
+private slots:
+    void workerUpdatesEmitOnOwnerThread();
+
+private:
+    // Keeps the owner thread's event loop turning until every writer is done
+    static void waitFor(const std::vector<std::unique_ptr<QThread>>& threads);
+};
+
+void TestSubsystemThreading::waitFor(const std::vector<std::unique_ptr<QThread>>& threads)
+{
+    for (const auto& thread : threads) {
+        while (!thread->wait(5)) {
+            QCoreApplication::processEvents();
+        }
+    }
+}
+
+void TestSubsystemThreading::workerUpdatesEmitOnOwnerThread()
+{
+    const int writerCount = 4;
+    const int updatesPerWriter = 2000;
+
+    CoolingSubsystem cooling("COOL-T1");
+    QThread* owner = QThread::currentThread();
+    const QStringList codes = cooling.getRegisteredFaultCodes();
+    const int overtempBit = codes.indexOf(CoolingSubsystem::FAULT_COOLANT_TEMP_HIGH);
+    QVERIFY(overtempBit >= 0);
+
+    // Direct connections, so a handler runs on whichever thread emits
+    std::atomic<int> faultEmits(0);
+    std::atomic<int> healthEmits(0);
+    std::atomic<int> offThreadEmits(0);
+    connect(&cooling, &RadarSubsystem::faultOccurred, &cooling, [&]() {
+        faultEmits++;
+        if (QThread::currentThread() != owner) {
+            offThreadEmits++;
+        }
+    }, Qt::DirectConnection);
+    connect(&cooling, &RadarSubsystem::healthChanged, &cooling, [&]() {
+        healthEmits++;
+        if (QThread::currentThread() != owner) {
+            offThreadEmits++;
+        }
+    }, Qt::DirectConnection);
+
+    std::vector<std::unique_ptr<QThread>> writers;
+    for (int w = 0; w < writerCount; ++w) {
+        writers.emplace_back(QThread::create([&cooling, w, updatesPerWriter]() {
+            for (int i = 0; i < updatesPerWriter; ++i) {
+                const bool hot = ((i + w) % 2) == 0;
+                cooling.updateData({{"coolantTemp", hot ? 70.0 : 30.0}});
+            }
+        }));
+    }
+
+    // A reader on its own thread checks every snapshot it is handed
+    std::atomic<bool> writing(true);
+    std::atomic<int> epochRegressions(0);
+    std::atomic<int> inconsistent(0);
+    std::atomic<int> snapshots(0);
+    std::unique_ptr<QThread> reader(QThread::create([&]() {
+        quint64 lastEpoch = 0;
+        do {
+            const HealthSnapshotPtr snapshot = cooling.healthSnapshot();
+            snapshots++;
+            if (snapshot->epoch < lastEpoch) {
+                epochRegressions++;
+            }
+            lastEpoch = snapshot->epoch;
+
+            // Faults and mask are copied under one lock: they must agree
+            bool listed = false;
+            for (const FaultCode& fault : snapshot->activeFaults) {
+                listed = listed || fault.code == CoolingSubsystem::FAULT_COOLANT_TEMP_HIGH;
+            }
+            const bool masked = (snapshot->faultMask >> overtempBit) & 1;
+            if (listed != masked || snapshot->epoch > cooling.healthEpoch()) {
+                inconsistent++;
+            }
+        } while (writing.load());
+    }));
+
+    reader->start();
+    for (const auto& writer : writers) {
+        writer->start();
+    }
+    waitFor(writers);
+    writing = false;
+    reader->wait();
+
+    // Deliver what the workers queued over, then settle on a known value
+    QCoreApplication::processEvents();
+    cooling.updateData({{"coolantTemp", 30.0}});
+    SignalCoalescer::instance()->flush();
+    QCoreApplication::processEvents();
+
+    QCOMPARE(offThreadEmits.load(), 0);
+    QVERIFY(faultEmits.load() > 0);
+    QVERIFY(healthEmits.load() > 0);
+    QCOMPARE(epochRegressions.load(), 0);
+    QCOMPARE(inconsistent.load(), 0);
+    QVERIFY(snapshots.load() > 0);
+
+    const HealthSnapshotPtr settled = cooling.healthSnapshot();
+    QCOMPARE(settled->epoch, cooling.healthEpoch());
+    QCOMPARE((settled->faultMask >> overtempBit) & 1, quint64(0));
+}
+
+QTEST_GUILESS_MAIN(TestSubsystemThreading)
+#include "tst_subsystemthreading.moc"